@@ -65,6 +65,19 @@
 //---- Use legacy CRC32-adler tables (used before 1.91.6), in order to preserve old .ini data that you cannot afford to invalidate.
 //#define IMGUI_USE_LEGACY_CRC32_ADLER
 
+//---- Use a 64-bit multiply/xorshift hash (wyhash constants) for ImHashData()/ImHashStr() instead of CRC32, processing 8 bytes per step.
+// Also enables hashing of string literals at compile-time via IM_HASH_STR_LITERAL(). Changes all IDs: this will invalidate existing .ini data.
+// Compile-time hashing is only used for Dear ImGui's own internal IDs: labels passed to public functions are hashed at runtime (with the faster hash).
+//#define IMGUI_USE_FAST_HASH
+
+//---- Use an open-addressing hash table for ImGuiStorage instead of a sorted vector. Makes insertion O(1) instead of O(N), lookups faster with 100k+ keys.
+// Pairs in ImGuiStorage::Data[] are then kept in insertion order, code writing to Data[] directly needs to call BuildSortByKey() afterwards.
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Use thread local storage for the current context pointer (GImGui), so that N threads can each run their own context concurrently (e.g. rendering dashboards on a server).
+// Contexts may share a font atlas, which needs to be built and locked (ImFontAtlas::Locked = true) by its owner before starting threads. Requires IMGUI_API to be empty (no DLL export).
+//#define IMGUI_USE_THREAD_LOCAL_CONTEXT
+
 //---- Use 32-bit for ImWchar (default is 16-bit) to support Unicode planes 1-16. (e.g. point beyond 0xFFFF like emoticons, dingbats, symbols, shapes, ancient languages, etc...)
 //#define IMGUI_USE_WCHAR32
 
@@ -118,6 +131,14 @@
 // Read about ImGuiBackendFlags_RendererHasVtxOffset for details.
 //#define ImDrawIdx unsigned int
 
+//---- Use a compact 12 bytes ImDrawVert (16-bit fixed point positions, 16-bit normalized UV) instead of the default 20 bytes, to reduce vertex upload bandwidth.
+// Positions are limited to +/-8191 pixels and UV to [0,1]. Your renderer backend needs to support it (imgui_impl_opengl3 does).
+//#define IMGUI_USE_COMPACT_DRAWVERT
+
+//---- Raise maximum number of columns in a table (default is 512, maximum is 32767).
+// Only visible columns get a draw channel, but other per-column data and layout are still proportional to this count.
+//#define IMGUI_TABLE_MAX_COLUMNS 8192
+
 //---- Override ImDrawCallback signature (will need to modify renderer backends accordingly)
 //struct ImDrawList;
 //struct ImDrawCmd;
@@ -132,6 +153,9 @@
 //---- Debug Tools: Enable slower asserts
 //#define IMGUI_DEBUG_PARANOID
 
+//---- Debug Tools: Record return address of MemAlloc() callers, so a custom allocator can report allocations per call site (see imgui_allocator.h)
+//#define IMGUI_DEBUG_ALLOC_CALL_SITES
+
 //---- Tip: You can add extra functions within the ImGui:: namespace from anywhere (e.g. your own sources/header files)
 /*
 namespace ImGui
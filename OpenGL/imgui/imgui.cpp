@@ -72,7 +72,8 @@ CODE
 // [SECTION] ImGuiStorage
 // [SECTION] ImGuiTextFilter
 // [SECTION] ImGuiTextBuffer, ImGuiTextIndex
-// [SECTION] ImGuiListClipper
+// [SECTION] ImGuiTextLog
+// [SECTION] ImGuiListClipper, ImGuiListClipperHeights
 // [SECTION] STYLING
 // [SECTION] RENDER HELPERS
 // [SECTION] INITIALIZATION, SHUTDOWN
@@ -1091,6 +1092,10 @@ CODE
 // System includes
 #include <stdio.h>      // vsnprintf, sscanf, printf
 #include <stdint.h>     // intptr_t
+#if defined(IMGUI_DEBUG_ALLOC_CALL_SITES) && defined(_MSC_VER)
+#include <intrin.h>     // _ReturnAddress
+#endif
+#include <atomic>       // std::atomic (ImGuiTextLog queue)
 
 // [Windows] On non-Visual Studio compilers, we default to IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS unless explicitly enabled
 #if defined(_WIN32) && !defined(_MSC_VER) && !defined(IMGUI_ENABLE_WIN32_DEFAULT_IME_FUNCTIONS) && !defined(IMGUI_DISABLE_WIN32_DEFAULT_IME_FUNCTIONS)
@@ -1292,7 +1297,8 @@ static void             UpdateViewportsNewFrame();
 //   Change to a different context by calling ImGui::SetCurrentContext().
 // - Important: Dear ImGui functions are not thread-safe because of this pointer.
 //   If you want thread-safety to allow N threads to access N different contexts:
-//   - Change this variable to use thread local storage so each thread can refer to a different context, in your imconfig.h:
+//   - Change this variable to use thread local storage so each thread can refer to a different context: '#define IMGUI_USE_THREAD_LOCAL_CONTEXT' in your imconfig.h.
+//     Or, to define the variable yourself, in your imconfig.h:
 //         struct ImGuiContext;
 //         extern thread_local ImGuiContext* MyImGuiTLS;
 //         #define GImGui MyImGuiTLS
@@ -1301,8 +1307,12 @@ static void             UpdateViewportsNewFrame();
 //   - If you need a finite number of contexts, you may compile and use multiple instances of the ImGui code from a different namespace.
 // - DLL users: read comments above.
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+thread_local ImGuiContext* GImGui = NULL;
+#else
 ImGuiContext*   GImGui = NULL;
 #endif
+#endif
 
 // Memory Allocator functions. Use SetAllocatorFunctions() to change them.
 // - You probably don't want to modify that mid-program, and if you use global/static e.g. ImVector<> instances you may need to keep them accessible during program destruction.
@@ -1317,6 +1327,9 @@ static void    FreeWrapper(void* ptr, void* user_data)        { IM_UNUSED(user_d
 static ImGuiMemAllocFunc    GImAllocatorAllocFunc = MallocWrapper;
 static ImGuiMemFreeFunc     GImAllocatorFreeFunc = FreeWrapper;
 static void*                GImAllocatorUserData = NULL;
+#ifdef IMGUI_DEBUG_ALLOC_CALL_SITES
+static thread_local const void* GImAllocatorCallSite = NULL;  // Return address of MemAlloc(), for allocators recording where allocations come from
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] USER FACING STRUCTURES (ImGuiStyle, ImGuiIO, ImGuiPlatformIO)
@@ -1467,6 +1480,8 @@ ImGuiIO::ImGuiIO()
     ConfigWindowsCopyContentsWithCtrlC = false;
     ConfigScrollbarScrollByPage = true;
     ConfigMemoryCompactTimer = 60.0f;
+    ConfigMemoryCompactBudget = 0;
+    ConfigMemoryShrinkToFit = true;
     ConfigDebugIsDebuggerPresent = false;
     ConfigDebugHighlightIdConflicts = true;
     ConfigDebugHighlightIdConflictsShowItemPicker = true;
@@ -2037,11 +2052,51 @@ const char* ImStrbol(const char* buf_mid_line, const char* buf_begin) // find be
     return buf_mid_line;
 }
 
+#ifdef IMGUI_ENABLE_SSE2
+// Fold 16 characters to upper-case, same as ImToUpper()
+static inline __m128i ImToUpperSSE2(__m128i v)
+{
+    const __m128i is_lower = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(v, _mm_set1_epi8('z' + 1)));
+    return _mm_sub_epi8(v, _mm_and_si128(is_lower, _mm_set1_epi8(32)));
+}
+#endif
+
 const char* ImStristr(const char* haystack, const char* haystack_end, const char* needle, const char* needle_end)
 {
     if (!needle_end)
         needle_end = needle + ImStrlen(needle);
 
+#ifdef IMGUI_ENABLE_SSE2
+    // Test 16 positions at a time for a match on both first and last character of needle, then verify candidates.
+    const int needle_len = (int)(needle_end - needle);
+    if (needle_len > 0)
+    {
+        if (!haystack_end)
+            haystack_end = haystack + ImStrlen(haystack);
+        const __m128i first = _mm_set1_epi8(ImToUpper(needle[0]));
+        const __m128i last = _mm_set1_epi8(ImToUpper(needle_end[-1]));
+        for (; haystack_end - haystack >= needle_len - 1 + 16; haystack += 16)
+        {
+            const __m128i block_first = ImToUpperSSE2(_mm_loadu_si128((const __m128i*)(const void*)haystack));
+            const __m128i block_last = ImToUpperSSE2(_mm_loadu_si128((const __m128i*)(const void*)(haystack + needle_len - 1)));
+            unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+            for (int n = 0; mask != 0; n++, mask >>= 1)
+            {
+                if ((mask & 1) == 0)
+                    continue;
+                const char* b = needle + 1;
+                for (const char* a = haystack + n + 1; b < needle_end - 1; a++, b++)
+                    if (ImToUpper(*a) != ImToUpper(*b))
+                        break;
+                if (b >= needle_end - 1)
+                    return haystack + n;
+            }
+        }
+        if (haystack_end - haystack < needle_len) // Remaining haystack too short to contain needle
+            return NULL;
+    }
+#endif
+
     const char un0 = (char)ImToUpper(*needle);
     while ((!haystack_end && *haystack) || (haystack_end && haystack < haystack_end))
     {
@@ -2140,6 +2195,143 @@ int ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args)
 }
 #endif // #ifdef IMGUI_DISABLE_DEFAULT_FORMAT_FUNCTIONS
 
+// Format a double with a fixed number of decimals, same as "%.Nf" with the "C" locale, without going through printf().
+// Return -1 when the output isn't guaranteed to match printf(): precision > 9, large values, NaN/Inf, or when the value is too close
+// to half a unit of the last digit for a double-precision multiply to tell which way printf() would round. Caller should fall back to ImFormatString().
+int ImFormatFloatFixed(char* buf, int buf_size, double v, int precision)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+    if (precision < 0 || precision >= IM_ARRAYSIZE(pow10) || v != v)
+        return -1;
+    const bool negative = (v < 0.0) || (v == 0.0 && 1.0 / v < 0.0); // printf() outputs "-0.000" for -0.0
+    const double scaled = (negative ? -v : v) * pow10[precision];
+    if (!(scaled < 9007199254740992.0)) // 2^53, also rejects Inf
+        return -1;
+    ImU64 n = (ImU64)scaled;
+    const double frac = scaled - (double)n;
+    if (ImAbs(frac - 0.5) <= scaled * (1.0 / 4503599627370496.0)) // Multiply error is <= 2^-53 relative
+        return -1;
+    if (frac > 0.5)
+        n++;
+
+    char tmp[32];
+    char* p = tmp + IM_ARRAYSIZE(tmp);
+    for (int i = 0; i < precision; i++, n /= 10)
+        *--p = (char)('0' + n % 10);
+    if (precision > 0)
+        *--p = '.';
+    do { *--p = (char)('0' + n % 10); n /= 10; } while (n != 0);
+    if (negative)
+        *--p = '-';
+    const int len = (int)(tmp + IM_ARRAYSIZE(tmp) - p);
+    if (len >= buf_size)
+        return -1;
+    memcpy(buf, p, (size_t)len);
+    buf[len] = 0;
+    return len;
+}
+
+// Parse leading decimal number as [+-]digits[.digits][e[+-]digits]. Return false when it doesn't fit in a 64-bit significand.
+static bool ImParseDecimal(const char** p_str, bool* out_negative, ImU64* out_significand, int* out_exp10)
+{
+    const char* p = *p_str;
+    while (*p == ' ' || (*p >= '\t' && *p <= '\r'))
+        p++;
+    bool negative = false;
+    if (*p == '-' || *p == '+')
+        negative = (*p++ == '-');
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X'))
+        return false;
+    ImU64 significand = 0;
+    int significand_digits = 0;
+    int exp10 = 0;
+    bool any_digits = false;
+    for (bool in_fraction = false; ; p++)
+    {
+        if (*p == '.' && !in_fraction) { in_fraction = true; continue; }
+        if (*p < '0' || *p > '9')
+            break;
+        any_digits = true;
+        if (significand_digits >= 19)
+            return false;
+        significand = significand * 10 + (ImU64)(*p - '0');
+        if (significand != 0)
+            significand_digits++;
+        if (in_fraction)
+            exp10--;
+    }
+    if (!any_digits)
+        return false;
+    if (*p == 'e' || *p == 'E')
+    {
+        const char* p_exp = p + 1;
+        bool exp_negative = false;
+        if (*p_exp == '-' || *p_exp == '+')
+            exp_negative = (*p_exp++ == '-');
+        if (*p_exp >= '0' && *p_exp <= '9')
+        {
+            int exp = 0;
+            for (; *p_exp >= '0' && *p_exp <= '9'; p_exp++)
+                if (exp < 10000)
+                    exp = exp * 10 + (*p_exp - '0');
+            exp10 += exp_negative ? -exp : exp;
+            p = p_exp;
+        }
+    }
+    *p_str = p;
+    *out_negative = negative;
+    *out_significand = significand;
+    *out_exp10 = exp10;
+    return true;
+}
+
+// Parse a floating-point number, same as strtod() with the "C" locale.
+// Return pointer past the parsed number, or NULL if no number was found.
+// When the decimal significand fits in 53 bits and its power of ten is exact (up to 1e22), a single correctly rounded multiply or divide
+// gives the correctly rounded result (Clinger's fast path). Other inputs (long significands, large exponents, hexadecimal, inf/nan) use strtod().
+const char* ImParseDouble(const char* str, double* out)
+{
+    static const double pow10[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+    const char* p = str;
+    bool negative;
+    ImU64 significand;
+    int exp10;
+    if (ImParseDecimal(&p, &negative, &significand, &exp10) && significand <= ((ImU64)1 << 53) && exp10 >= -22 && exp10 <= 22)
+    {
+        const double v = (exp10 < 0) ? (double)significand / pow10[-exp10] : (double)significand * pow10[exp10];
+        *out = negative ? -v : v;
+        return p;
+    }
+    char* end;
+    const double v = strtod(str, &end);
+    if (end == str)
+        return NULL;
+    *out = v;
+    return end;
+}
+
+// Same as ImParseDouble() but rounding directly to float, same as strtof()
+const char* ImParseFloat(const char* str, float* out)
+{
+    static const float pow10[] = { 1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f };
+    const char* p = str;
+    bool negative;
+    ImU64 significand;
+    int exp10;
+    if (ImParseDecimal(&p, &negative, &significand, &exp10) && significand <= ((ImU64)1 << 24) && exp10 >= -10 && exp10 <= 10)
+    {
+        const float v = (exp10 < 0) ? (float)significand / pow10[-exp10] : (float)significand * pow10[exp10];
+        *out = negative ? -v : v;
+        return p;
+    }
+    char* end;
+    const float v = strtof(str, &end);
+    if (end == str)
+        return NULL;
+    *out = v;
+    return end;
+}
+
 void ImFormatStringToTempBuffer(const char** out_buf, const char** out_buf_end, const char* fmt, ...)
 {
     va_list args;
@@ -2183,7 +2375,7 @@ void ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end,
     }
 }
 
-#ifndef IMGUI_ENABLE_SSE4_2_CRC
+#if !defined(IMGUI_ENABLE_SSE4_2_CRC) && !defined(IMGUI_USE_FAST_HASH)
 // CRC32 needs a 1KB lookup table (not cache friendly)
 // Although the code to generate the table is simple and shorter than the table itself, using a const table allows us to easily:
 // - avoid an unnecessary branch/memory tap, - keep the ImHashXXX functions usable by static constructors, - make it thread-safe.
@@ -2229,6 +2421,58 @@ static const ImU32 GCrc32LookupTable[256] =
 };
 #endif
 
+#ifdef IMGUI_USE_FAST_HASH
+
+// Seedless 64-bit hash, processing 8 bytes per step. Must match ImHashDataRawConst() exactly, see imgui_internal.h.
+// Input is read as little-endian words so the result doesn't depend on the platform.
+ImU64 ImHashDataRaw(const void* data_p, size_t data_size)
+{
+    const unsigned char* data = (const unsigned char*)data_p;
+    const unsigned char* data_end = data + data_size;
+    ImU64 h = IM_HASH_P0;
+    for (; data + 8 <= data_end; data += 8)
+    {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        ImU64 w = ImHashLoadConst((const char*)data, 8);
+#else
+        ImU64 w;
+        memcpy(&w, data, 8);
+#endif
+        h = ImHashFastStep(h, w);
+    }
+    if (data < data_end)
+    {
+        ImU64 w = 0;
+        for (int shift = 0; data < data_end; shift += 8)
+            w |= (ImU64)*data++ << shift;
+        h = ImHashFastStep(h, w);
+    }
+    return ImHashFastFmix(h ^ (ImU64)data_size);
+}
+
+// Known size hash
+// It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
+ImGuiID ImHashData(const void* data_p, size_t data_size, ImGuiID seed)
+{
+    return ImHashFastCombine(ImHashDataRaw(data_p, data_size), seed);
+}
+
+// Zero-terminated string hash, with support for ### to reset back to seed value
+// We support a syntax of "label###id" where only "###id" is included in the hash, and only "label" gets displayed.
+// Hashing every byte then resetting on ### is equivalent to only hashing from the last ### marker, which we locate
+// with memchr() first so the hashing loop can consume full 8-byte words.
+ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
+{
+    const char* data_end = data_p + (data_size != 0 ? data_size : ImStrlen(data_p));
+    const char* hash_begin = data_p;
+    for (const char* p = data_p; data_end - p >= 3 && (p = (const char*)ImMemchr(p, '#', (size_t)(data_end - p - 2))) != NULL; p++)
+        if (p[1] == '#' && p[2] == '#')
+            hash_begin = p;
+    return ImHashFastCombine(ImHashDataRaw(hash_begin, (size_t)(data_end - hash_begin)), seed);
+}
+
+#else
+
 // Known size hash
 // It is ok to call ImHashData on a string with known length but the ### operator won't be supported.
 // FIXME-OPT: Replace with e.g. FNV1a hash? CRC32 pretty much randomly access 1KB. Need to do proper measurements.
@@ -2298,6 +2542,8 @@ ImGuiID ImHashStr(const char* data_p, size_t data_size, ImGuiID seed)
     return ~crc;
 }
 
+#endif // #ifdef IMGUI_USE_FAST_HASH
+
 //-----------------------------------------------------------------------------
 // [SECTION] MISC HELPERS/UTILITIES (File functions)
 //-----------------------------------------------------------------------------
@@ -2703,12 +2949,181 @@ static int IMGUI_CDECL PairComparerByID(const void* lhs, const void* rhs)
     return (lhs_v > rhs_v ? +1 : lhs_v < rhs_v ? -1 : 0);
 }
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+
+// Open-addressing index over ImGuiStorage::Data[], using linear probing and a load factor <= 0.75.
+// Pairs are never removed so we don't need tombstones. Keys are often sequential (e.g. selection indices) so we scramble them.
+static inline int ImGuiStorage_HashKey(ImGuiID key)
+{
+    ImU32 h = key * 0x9E3779B1u;
+    return (int)(h ^ (h >> 16));
+}
+
+static void ImGuiStorage_AddSlot(ImGuiStorage* storage, ImGuiID key, int index)
+{
+    const int mask = storage->Slots.Size - 1;
+    int slot_n = ImGuiStorage_HashKey(key) & mask;
+    while (storage->Slots.Data[slot_n].index >= 0)
+        slot_n = (slot_n + 1) & mask;
+    storage->Slots.Data[slot_n].key = key;
+    storage->Slots.Data[slot_n].index = index;
+}
+
+static void ImGuiStorage_RebuildSlots(ImGuiStorage* storage, int min_count)
+{
+    int capacity = 16;
+    while (capacity * 3 < min_count * 4)
+        capacity <<= 1;
+    storage->Slots.resize(capacity);
+    memset(storage->Slots.Data, 0xFF, (size_t)storage->Slots.size_in_bytes()); // index = -1
+    for (int n = 0; n < storage->Data.Size; n++)
+        ImGuiStorage_AddSlot(storage, storage->Data.Data[n].key, n);
+}
+
+static ImGuiStoragePair* ImGuiStorage_FindPair(const ImGuiStorage* storage, ImGuiID key)
+{
+    if (storage->Slots.Size == 0)
+        return NULL;
+    const int mask = storage->Slots.Size - 1;
+    for (int slot_n = ImGuiStorage_HashKey(key) & mask; ; slot_n = (slot_n + 1) & mask)
+    {
+        const ImGuiStorageSlot* slot = &storage->Slots.Data[slot_n];
+        if (slot->index < 0)
+            return NULL;
+        if (slot->key == key)
+        {
+            // Data[] may have been reordered or shrunk directly (e.g. ImGuiSelectionBasicStorage with PreserveOrder sorts it by value
+            // while iterating): reindex and search again. Pairs appended directly are only indexed after BuildSortByKey().
+            if (slot->index >= storage->Data.Size || storage->Data.Data[slot->index].key != key)
+            {
+                ImGuiStorage_RebuildSlots(const_cast<ImGuiStorage*>(storage), ImMax(storage->Data.Size, storage->Slots.Size * 3 / 4));
+                return ImGuiStorage_FindPair(storage, key);
+            }
+            return const_cast<ImGuiStoragePair*>(&storage->Data.Data[slot->index]);
+        }
+    }
+}
+
+static ImGuiStoragePair* ImGuiStorage_AddPair(ImGuiStorage* storage, const ImGuiStoragePair& pair)
+{
+    if ((storage->Data.Size + 1) * 4 > storage->Slots.Size * 3)
+        ImGuiStorage_RebuildSlots(storage, (storage->Data.Size + 1) * 2);
+    storage->Data.push_back(pair);
+    ImGuiStorage_AddSlot(storage, pair.key, storage->Data.Size - 1);
+    return &storage->Data.back();
+}
+
+// For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+// This also reindex everything, which is required after pairs have been appended to Data[] directly.
+void ImGuiStorage::BuildSortByKey()
+{
+    ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
+    ImGuiStorage_RebuildSlots(this, ImMax(Data.Size, Slots.Size * 3 / 4));
+}
+
+ImGuiStoragePair* ImGuiStorage::GetPair(ImGuiID key)
+{
+    return ImGuiStorage_FindPair(this, key);
+}
+
+int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
+{
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_i : default_val;
+}
+
+bool ImGuiStorage::GetBool(ImGuiID key, bool default_val) const
+{
+    return GetInt(key, default_val ? 1 : 0) != 0;
+}
+
+float ImGuiStorage::GetFloat(ImGuiID key, float default_val) const
+{
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_f : default_val;
+}
+
+void* ImGuiStorage::GetVoidPtr(ImGuiID key) const
+{
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    return it ? it->val_p : NULL;
+}
+
+// References are only valid until a new value is added to the storage. Calling a Set***() function or a Get***Ref() function invalidates the pointer.
+int* ImGuiStorage::GetIntRef(ImGuiID key, int default_val)
+{
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+    return &it->val_i;
+}
+
+bool* ImGuiStorage::GetBoolRef(ImGuiID key, bool default_val)
+{
+    return (bool*)GetIntRef(key, default_val ? 1 : 0);
+}
+
+float* ImGuiStorage::GetFloatRef(ImGuiID key, float default_val)
+{
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+    return &it->val_f;
+}
+
+void** ImGuiStorage::GetVoidPtrRef(ImGuiID key, void* default_val)
+{
+    ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key);
+    if (it == NULL)
+        it = ImGuiStorage_AddPair(this, ImGuiStoragePair(key, default_val));
+    return &it->val_p;
+}
+
+void ImGuiStorage::SetInt(ImGuiID key, int val)
+{
+    if (ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key))
+        it->val_i = val;
+    else
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+}
+
+void ImGuiStorage::SetBool(ImGuiID key, bool val)
+{
+    SetInt(key, val ? 1 : 0);
+}
+
+void ImGuiStorage::SetFloat(ImGuiID key, float val)
+{
+    if (ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key))
+        it->val_f = val;
+    else
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+}
+
+void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
+{
+    if (ImGuiStoragePair* it = ImGuiStorage_FindPair(this, key))
+        it->val_p = val;
+    else
+        ImGuiStorage_AddPair(this, ImGuiStoragePair(key, val));
+}
+
+#else // #ifdef IMGUI_USE_HASHED_STORAGE
+
 // For quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
 void ImGuiStorage::BuildSortByKey()
 {
     ImQsort(Data.Data, (size_t)Data.Size, sizeof(ImGuiStoragePair), PairComparerByID);
 }
 
+ImGuiStoragePair* ImGuiStorage::GetPair(ImGuiID key)
+{
+    ImGuiStoragePair* it = ImLowerBound(Data.Data, Data.Data + Data.Size, key);
+    if (it == Data.Data + Data.Size || it->key != key)
+        return NULL;
+    return it;
+}
+
 int ImGuiStorage::GetInt(ImGuiID key, int default_val) const
 {
     ImGuiStoragePair* it = ImLowerBound(const_cast<ImGuiStoragePair*>(Data.Data), const_cast<ImGuiStoragePair*>(Data.Data + Data.Size), key);
@@ -2801,6 +3216,8 @@ void ImGuiStorage::SetVoidPtr(ImGuiID key, void* val)
         it->val_p = val;
 }
 
+#endif // #ifdef IMGUI_USE_HASHED_STORAGE
+
 void ImGuiStorage::SetAllInt(int v)
 {
     for (int i = 0; i < Data.Size; i++)
@@ -2989,7 +3406,561 @@ void ImGuiTextIndex::append(const char* base, int old_size, int new_size)
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] ImGuiListClipper
+// [SECTION] ImGuiTextLog
+//-----------------------------------------------------------------------------
+
+// Trigrams are made of case-folded printable ASCII characters, with one extra value for all other characters.
+static const int TEXTLOG_TRIGRAM_CHARS = 96;
+
+static inline int TextLogTrigramChar(char c)
+{
+    c = ImToUpper(c);
+    return (c >= 0x20 && c < 0x7F) ? c - 0x20 : TEXTLOG_TRIGRAM_CHARS - 1;
+}
+
+static inline int TextLogTrigramKey(const char* p)
+{
+    return (TextLogTrigramChar(p[0]) * TEXTLOG_TRIGRAM_CHARS + TextLogTrigramChar(p[1])) * TEXTLOG_TRIGRAM_CHARS + TextLogTrigramChar(p[2]);
+}
+
+// Return true if the filter is made of a single search term without exclusions, which allows searching many lines at once.
+static bool TextFilterGetSingleTerm(const ImGuiTextFilter& filter, const char** out_b, const char** out_e)
+{
+    const ImGuiTextFilter::ImGuiTextRange* term = NULL;
+    for (const ImGuiTextFilter::ImGuiTextRange& f : filter.Filters)
+    {
+        if (f.empty())
+            continue;
+        if (f.b[0] == '-' || term != NULL)
+            return false;
+        term = &f;
+    }
+    if (term == NULL)
+        return false;
+    *out_b = term->b;
+    *out_e = term->e;
+    return true;
+}
+
+ImGuiTextLog::ImGuiTextLog()
+{
+    FilteredLinesScanned = 0;
+    FilteredFor[0] = 0;
+    LastScanLinesCount = 0;
+    AutoScroll = true;
+    UseTrigramIndex = false;
+    TrigramBlockLines = 256;
+    TrigramIndexedLines = 0;
+    Queue = NULL;
+}
+
+ImGuiTextLog::~ImGuiTextLog()
+{
+    Clear();
+    if (Queue)
+        IM_DELETE(Queue);
+}
+
+void ImGuiTextLog::Clear()
+{
+    for (ImGuiTextLogChunk& chunk : Chunks)
+        IM_FREE(chunk.Data);
+    Chunks.clear();
+    ChunksBySlot.clear();
+    LineOffsets.clear();
+    FilteredLines.clear();
+    FilteredLinesScanned = 0;
+    for (ImVector<int>& blocks : TrigramBlocks)
+        blocks.clear();
+    TrigramBlocks.clear();
+    TrigramHeads.clear();
+    TrigramIndexedLines = 0;
+}
+
+// Chunks are placed one after the other in offset space, so offsets stored in LineOffsets[] keep increasing.
+void ImGuiTextLog::_AddChunk(int min_capacity)
+{
+    const int slots_count = (ImMax(min_capacity, 1) + IMGUI_TEXTLOG_CHUNK_SIZE - 1) / IMGUI_TEXTLOG_CHUNK_SIZE;
+    ImGuiTextLogChunk chunk;
+    chunk.Capacity = slots_count * IMGUI_TEXTLOG_CHUNK_SIZE;
+    chunk.Data = (char*)IM_ALLOC((size_t)chunk.Capacity);
+    chunk.Size = 0;
+    chunk.Offset = ChunksBySlot.Size * IMGUI_TEXTLOG_CHUNK_SIZE;
+    for (int n = 0; n < slots_count; n++)
+        ChunksBySlot.push_back(Chunks.Size);
+    Chunks.push_back(chunk);
+}
+
+// Copy text into the last chunk and index the new lines. When text doesn't fit, only complete lines are copied
+// and the remainder goes into a new chunk, along with the incomplete last line (moved) so that lines never straddle two chunks.
+static void TextLogAppend(ImGuiTextLog* log, const char* text, const char* text_end)
+{
+    while (text < text_end)
+    {
+        ImGuiTextLogChunk* chunk = log->Chunks.Size > 0 ? &log->Chunks.back() : NULL;
+        const char* write_end = text_end;
+        if (chunk == NULL || text_end - text > chunk->Capacity - chunk->Size)
+        {
+            write_end = NULL;
+            for (const char* p = chunk ? text + (chunk->Capacity - chunk->Size) : text; p > text; p--)
+                if (p[-1] == '\n')
+                {
+                    write_end = p;
+                    break;
+                }
+            if (write_end == NULL)
+            {
+                const char* line_end = (const char*)ImMemchr(text, '\n', (size_t)(text_end - text));
+                line_end = line_end ? line_end + 1 : text_end;
+                const int tail_size = (chunk && !log->_IsLastLineComplete()) ? chunk->Offset + chunk->Size - log->LineOffsets.back() : 0;
+                log->_AddChunk(ImMax(tail_size + (int)(line_end - text), tail_size * 2)); // Grow geometrically so that a very long line being appended to isn't moved too often
+                if (tail_size > 0)
+                {
+                    ImGuiTextLogChunk* prev_chunk = &log->Chunks[log->Chunks.Size - 2];
+                    ImGuiTextLogChunk* new_chunk = &log->Chunks.back();
+                    prev_chunk->Size -= tail_size;
+                    memcpy(new_chunk->Data, prev_chunk->Data + prev_chunk->Size, (size_t)tail_size);
+                    new_chunk->Size = tail_size;
+                    log->LineOffsets.back() = new_chunk->Offset;
+                    if (prev_chunk->Size == 0) // Was holding only that line
+                    {
+                        IM_FREE(prev_chunk->Data);
+                        prev_chunk->Data = NULL;
+                        prev_chunk->Capacity = 0;
+                    }
+                }
+                continue;
+            }
+        }
+
+        // A new chunk always starts with a new line, or with the moved incomplete line
+        const bool is_line_start = (chunk->Size == 0) || (chunk->Data[chunk->Size - 1] == '\n');
+        char* dst = chunk->Data + chunk->Size;
+        char* dst_end = dst + (write_end - text);
+        memcpy(dst, text, (size_t)(write_end - text));
+        chunk->Size += (int)(write_end - text);
+        text = write_end;
+        if (is_line_start)
+            log->LineOffsets.push_back(chunk->Offset + (int)(dst - chunk->Data));
+        for (const char* p = dst; (p = (const char*)ImMemchr(p, '\n', (size_t)(dst_end - p))) != NULL; )
+            if (++p < dst_end) // Don't push a trailing offset on last \n
+                log->LineOffsets.push_back(chunk->Offset + (int)(p - chunk->Data));
+    }
+}
+
+void ImGuiTextLog::Append(const char* text, const char* text_end)
+{
+    TextLogAppend(this, text, text_end ? text_end : text + strlen(text));
+}
+
+void ImGuiTextLog::Appendf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int len = ImFormatStringV(NULL, 0, fmt, args);
+    if (len > 0)
+    {
+        char local_buf[512];
+        char* buf = (len < IM_ARRAYSIZE(local_buf)) ? local_buf : (char*)IM_ALLOC((size_t)len + 1);
+        ImFormatStringV(buf, (size_t)len + 1, fmt, args_copy);
+        TextLogAppend(this, buf, buf + len);
+        if (buf != local_buf)
+            IM_FREE(buf);
+    }
+    va_end(args_copy);
+    va_end(args);
+}
+
+// Bounded multi-producer single-consumer ring buffer of variable-size records.
+// - Producers reserve space by advancing Head with a compare-and-swap, write their payload then publish the record header.
+// - Records are 8-byte aligned: 4 bytes header (record size including header and alignment, 0 while being written, or TEXTLOG_QUEUE_PADDING),
+//   4 bytes text length, then payload. The consumer only derives the record size from the header, so payload may be larger than the text.
+// - A record never wraps around: when it wouldn't fit before the end of the ring, a padding record fills the remaining space.
+// - The consumer clears the space it read before advancing Tail, so free space always reads as uncommitted headers.
+static const ImU32 TEXTLOG_QUEUE_PADDING = 0xFFFFFFFF;
+
+struct ImGuiTextLogQueue
+{
+    char*                   Data;
+    ImU32                   Capacity;           // Power of two
+    char                    _Pad0[64];          // Keep producer and consumer counters on separate cache lines
+    std::atomic<ImU64>      Head;               // Reserved by producers
+    char                    _Pad1[64];
+    std::atomic<ImU64>      Tail;               // Read by consumer
+    std::atomic<int>        DroppedCount;
+
+    ImGuiTextLogQueue(ImU32 capacity) : Capacity(capacity), Head(0), Tail(0), DroppedCount(0) { Data = (char*)IM_ALLOC(capacity); memset(Data, 0, capacity); }
+    ~ImGuiTextLogQueue()            { IM_FREE(Data); }
+    std::atomic<ImU32>*     GetHeader(ImU64 pos) { return (std::atomic<ImU32>*)(void*)(Data + (pos & (Capacity - 1))); }
+};
+IM_STATIC_ASSERT(sizeof(std::atomic<ImU32>) == sizeof(ImU32));
+
+// Reserve a record for a payload of 'payload_len' bytes. Return header of the record, to publish by storing *out_record_size into it, or NULL if the queue is full.
+static std::atomic<ImU32>* TextLogQueueReserve(ImGuiTextLogQueue* q, int payload_len, ImU32* out_record_size)
+{
+    const ImU32 record_size = (ImU32)(8 + payload_len + 7) & ~7u;
+    *out_record_size = record_size;
+    if (record_size > q->Capacity / 2)
+        return NULL;
+    ImU64 head = q->Head.load(std::memory_order_relaxed);
+    ImU32 padding_size;
+    do
+    {
+        const ImU32 offset = (ImU32)(head & (q->Capacity - 1));
+        padding_size = (offset + record_size > q->Capacity) ? q->Capacity - offset : 0;
+        if (head + padding_size + record_size - q->Tail.load(std::memory_order_acquire) > q->Capacity)
+            return NULL;
+    }
+    while (!q->Head.compare_exchange_weak(head, head + padding_size + record_size, std::memory_order_relaxed));
+    if (padding_size > 0)
+        q->GetHeader(head)->store(TEXTLOG_QUEUE_PADDING, std::memory_order_release);
+    return q->GetHeader(head + padding_size);
+}
+
+void ImGuiTextLog::InitQueue(int size_in_bytes)
+{
+    IM_ASSERT(Queue == NULL && "InitQueue() already called!");
+    IM_ASSERT(size_in_bytes >= 64 && size_in_bytes <= (1 << 30));
+    ImU32 capacity = 64;
+    while (capacity < (ImU32)size_in_bytes)
+        capacity <<= 1;
+    Queue = IM_NEW(ImGuiTextLogQueue)(capacity);
+}
+
+bool ImGuiTextLog::QueueAppend(const char* text, const char* text_end)
+{
+    ImGuiTextLogQueue* q = Queue;
+    IM_ASSERT(q != NULL && "Call InitQueue() first!");
+    if (!text_end)
+        text_end = text + ImStrlen(text);
+    const int len = (int)(text_end - text);
+    ImU32 record_size;
+    std::atomic<ImU32>* header = TextLogQueueReserve(q, len, &record_size);
+    if (header == NULL)
+    {
+        q->DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    *(ImU32*)(void*)((char*)(void*)header + 4) = (ImU32)len;
+    memcpy((char*)(void*)header + 8, text, (size_t)len);
+    header->store(record_size, std::memory_order_release);
+    return true;
+}
+
+// Format directly into the ring buffer
+bool ImGuiTextLog::QueueAppendf(const char* fmt, ...)
+{
+    ImGuiTextLogQueue* q = Queue;
+    IM_ASSERT(q != NULL && "Call InitQueue() first!");
+    va_list args;
+    va_start(args, fmt);
+    va_list args_copy;
+    va_copy(args_copy, args);
+    const int len = ImFormatStringV(NULL, 0, fmt, args);
+    ImU32 record_size;
+    std::atomic<ImU32>* header = (len >= 0) ? TextLogQueueReserve(q, len + 1, &record_size) : NULL; // + zero-terminator written by ImFormatStringV()
+    if (header != NULL)
+    {
+        *(ImU32*)(void*)((char*)(void*)header + 4) = (ImU32)len;
+        ImFormatStringV((char*)(void*)header + 8, (size_t)len + 1, fmt, args_copy);
+        header->store(record_size, std::memory_order_release);
+    }
+    else
+    {
+        q->DroppedCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    va_end(args_copy);
+    va_end(args);
+    return header != NULL;
+}
+
+int ImGuiTextLog::DrainQueue()
+{
+    ImGuiTextLogQueue* q = Queue;
+    if (q == NULL)
+        return 0;
+    int records_count = 0;
+    // Only drain records reserved before this call, so that busy producers can't keep us here.
+    const ImU64 head = q->Head.load(std::memory_order_relaxed);
+    ImU64 tail = q->Tail.load(std::memory_order_relaxed);
+    while (tail < head)
+    {
+        // Stop on first record not published yet, so records are added in reservation order.
+        std::atomic<ImU32>* header = q->GetHeader(tail);
+        const ImU32 header_value = header->load(std::memory_order_acquire);
+        if (header_value == 0)
+            break;
+        ImU32 record_size;
+        if (header_value == TEXTLOG_QUEUE_PADDING)
+        {
+            record_size = q->Capacity - (ImU32)(tail & (q->Capacity - 1));
+        }
+        else
+        {
+            const ImU32 text_len = *(const ImU32*)(const void*)((const char*)(void*)header + 4);
+            const char* text = (const char*)(void*)header + 8;
+            TextLogAppend(this, text, text + text_len);
+            record_size = header_value;
+            records_count++;
+        }
+        header->store(0, std::memory_order_relaxed);
+        memset((char*)(void*)header + 4, 0, record_size - 4);
+        tail += record_size;
+    }
+    q->Tail.store(tail, std::memory_order_release);
+    return records_count;
+}
+
+int ImGuiTextLog::GetQueueDroppedCount() const
+{
+    return Queue ? Queue->DroppedCount.load(std::memory_order_relaxed) : 0;
+}
+
+const char* ImGuiTextLog::GetLineEnd(int line_n) const
+{
+    const ImGuiTextLogChunk& chunk = Chunks[ChunksBySlot[LineOffsets[line_n] / IMGUI_TEXTLOG_CHUNK_SIZE]];
+    if (line_n + 1 < LineOffsets.Size && LineOffsets[line_n + 1] < chunk.Offset + chunk.Size)
+        return chunk.Data + LineOffsets[line_n + 1] - chunk.Offset - 1;
+    const char* chunk_end = chunk.Data + chunk.Size; // Last line of chunk
+    return (chunk_end[-1] == '\n') ? chunk_end - 1 : chunk_end;
+}
+
+// Test lines [line_begin, line_end) and append those passing the filter to FilteredLines[]
+void ImGuiTextLog::_ScanLines(int line_begin, int line_end)
+{
+    if (line_begin >= line_end)
+        return;
+    LastScanLinesCount += line_end - line_begin;
+
+    const char* term_b;
+    const char* term_e;
+    if (!TextFilterGetSingleTerm(Filter, &term_b, &term_e))
+    {
+        for (int line_n = line_begin; line_n < line_end; line_n++)
+            if (Filter.PassFilter(GetLineBegin(line_n), GetLineEnd(line_n)))
+                FilteredLines.push_back(line_n);
+        return;
+    }
+
+    // Single search term: search the lines of each chunk at once, which is much faster than calling ImStristr() on each short line.
+    // A match can't straddle two lines as search terms can't contain '\n'.
+    for (int line_n = line_begin; line_n < line_end; )
+    {
+        // Lines [line_n, chunk_line_end) are in the same chunk
+        const ImGuiTextLogChunk& chunk = Chunks[ChunksBySlot[LineOffsets[line_n] / IMGUI_TEXTLOG_CHUNK_SIZE]];
+        int chunk_line_end = line_n + 1;
+        for (int count = line_end - chunk_line_end; count > 0; )
+        {
+            const int half = count / 2;
+            if (LineOffsets[chunk_line_end + half] < chunk.Offset + chunk.Size)
+                chunk_line_end += half + 1, count -= half + 1;
+            else
+                count = half;
+        }
+        const char* p = GetLineBegin(line_n);
+        const char* p_end = GetLineEnd(chunk_line_end - 1);
+        while ((p = ImStristr(p, p_end, term_b, term_e)) != NULL)
+        {
+            // Locate line holding the match: gallop from current line then binary search
+            const int offset = chunk.Offset + (int)(p - chunk.Data);
+            int step = 1;
+            while (line_n + step < chunk_line_end && LineOffsets[line_n + step] <= offset)
+                step *= 2;
+            int lo = line_n + step / 2, hi = ImMin(line_n + step, chunk_line_end - 1);
+            while (lo < hi)
+            {
+                const int mid = (lo + hi + 1) / 2;
+                if (LineOffsets[mid] <= offset)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+            FilteredLines.push_back(lo);
+            line_n = lo + 1;
+            if (line_n >= chunk_line_end)
+                break;
+            p = GetLineBegin(line_n);
+        }
+        line_n = chunk_line_end;
+    }
+}
+
+void ImGuiTextLog::_UpdateTrigramIndex()
+{
+    if (TrigramHeads.Size == 0)
+    {
+        TrigramHeads.resize(TEXTLOG_TRIGRAM_CHARS * TEXTLOG_TRIGRAM_CHARS * TEXTLOG_TRIGRAM_CHARS);
+        memset(TrigramHeads.Data, 0xFF, (size_t)TrigramHeads.size_in_bytes()); // -1
+    }
+
+    // Only index complete lines
+    const int lines_complete = _IsLastLineComplete() ? LineOffsets.Size : ImMax(LineOffsets.Size - 1, 0);
+    for (int line_n = TrigramIndexedLines; line_n < lines_complete; line_n++)
+    {
+        const int block_n = line_n / TrigramBlockLines;
+        const char* line_end = GetLineEnd(line_n);
+        for (const char* p = GetLineBegin(line_n); p + 3 <= line_end; p++)
+        {
+            int* head = &TrigramHeads.Data[TextLogTrigramKey(p)];
+            if (*head == -1)
+            {
+                *head = TrigramBlocks.Size;
+                TrigramBlocks.push_back(ImVector<int>());
+            }
+            ImVector<int>& blocks = TrigramBlocks.Data[*head];
+            if (blocks.Size == 0 || blocks.Data[blocks.Size - 1] != block_n)
+                blocks.push_back(block_n);
+        }
+    }
+    TrigramIndexedLines = ImMax(TrigramIndexedLines, lines_complete);
+}
+
+// Output sorted list of indexed blocks which may contain lines passing the filter.
+// Return false when the index can't help (e.g. a search term shorter than 3 characters).
+bool ImGuiTextLog::_GetTrigramCandidateBlocks(ImVector<int>* out_blocks)
+{
+    out_blocks->resize(0);
+    ImVector<int> term_blocks, merged_blocks;
+    int grep_count = 0;
+    for (const ImGuiTextFilter::ImGuiTextRange& f : Filter.Filters)
+    {
+        if (f.empty() || f.b[0] == '-')
+            continue;
+        if (f.e - f.b < 3)
+            return false;
+        grep_count++;
+
+        // Intersect blocks of all trigrams of the search term
+        term_blocks.resize(0);
+        for (const char* p = f.b; p + 3 <= f.e; p++)
+        {
+            const int head = TrigramHeads[TextLogTrigramKey(p)];
+            if (head == -1)
+            {
+                term_blocks.resize(0);
+                break;
+            }
+            const ImVector<int>& blocks = TrigramBlocks[head];
+            if (p == f.b)
+            {
+                term_blocks = blocks;
+                continue;
+            }
+            int dst_n = 0;
+            for (int i = 0, j = 0; i < term_blocks.Size && j < blocks.Size; )
+            {
+                if (term_blocks[i] < blocks[j])
+                    i++;
+                else if (term_blocks[i] > blocks[j])
+                    j++;
+                else
+                    term_blocks[dst_n++] = term_blocks[i++], j++;
+            }
+            term_blocks.resize(dst_n);
+            if (dst_n == 0)
+                break;
+        }
+
+        // Union with blocks of other search terms
+        merged_blocks.resize(0);
+        for (int i = 0, j = 0; i < out_blocks->Size || j < term_blocks.Size; )
+        {
+            if (j == term_blocks.Size || (i < out_blocks->Size && (*out_blocks)[i] < term_blocks[j]))
+                merged_blocks.push_back((*out_blocks)[i++]);
+            else if (i == out_blocks->Size || term_blocks[j] < (*out_blocks)[i])
+                merged_blocks.push_back(term_blocks[j++]);
+            else
+                merged_blocks.push_back(term_blocks[j++]), i++;
+        }
+        out_blocks->swap(merged_blocks);
+    }
+    return grep_count > 0;
+}
+
+void ImGuiTextLog::Update()
+{
+    LastScanLinesCount = 0;
+    DrainQueue();
+    if (UseTrigramIndex)
+        _UpdateTrigramIndex();
+    if (!Filter.IsActive())
+    {
+        FilteredLines.resize(0);
+        FilteredLinesScanned = 0;
+        FilteredFor[0] = 0;
+        return;
+    }
+
+    if (strcmp(FilteredFor, Filter.InputBuf) != 0)
+    {
+        // When the new search term contains the previous one, only lines which passed before can pass now.
+        ImGuiTextFilter prev_filter;
+        memcpy(prev_filter.InputBuf, FilteredFor, sizeof(FilteredFor));
+        prev_filter.Build();
+        const char* term_b;
+        const char* term_e;
+        const char* prev_term_b;
+        const char* prev_term_e;
+        const bool is_narrowing = TextFilterGetSingleTerm(Filter, &term_b, &term_e) && TextFilterGetSingleTerm(prev_filter, &prev_term_b, &prev_term_e) && ImStristr(term_b, term_e, prev_term_b, prev_term_e) != NULL;
+        memcpy(FilteredFor, Filter.InputBuf, sizeof(FilteredFor));
+        if (is_narrowing)
+        {
+            int dst_n = 0;
+            for (int line_n : FilteredLines)
+                if (line_n < FilteredLinesScanned && ImStristr(GetLineBegin(line_n), GetLineEnd(line_n), term_b, term_e) != NULL)
+                    FilteredLines[dst_n++] = line_n;
+            LastScanLinesCount += FilteredLines.Size;
+            FilteredLines.resize(dst_n);
+        }
+        else
+        {
+            FilteredLines.resize(0);
+            FilteredLinesScanned = 0;
+            ImVector<int> blocks;
+            if (UseTrigramIndex && _GetTrigramCandidateBlocks(&blocks))
+            {
+                for (int block_n : blocks)
+                    _ScanLines(block_n * TrigramBlockLines, ImMin((block_n + 1) * TrigramBlockLines, TrigramIndexedLines));
+                FilteredLinesScanned = TrigramIndexedLines;
+            }
+        }
+    }
+
+    // Test lines which haven't been tested yet. The last line is always tested again as text may have been appended to it.
+    if (FilteredLines.Size > 0 && FilteredLines.back() >= FilteredLinesScanned)
+        FilteredLines.pop_back();
+    _ScanLines(FilteredLinesScanned, LineOffsets.Size);
+    FilteredLinesScanned = ImMax(LineOffsets.Size - 1, 0);
+}
+
+void ImGuiTextLog::Draw(const char* str_id, const ImVec2& size)
+{
+    ImGui::PushID(str_id);
+    Filter.Draw("##filter", -FLT_MIN);
+    Update();
+    if (ImGui::BeginChild("##lines", size, ImGuiChildFlags_None, ImGuiWindowFlags_HorizontalScrollbar))
+    {
+        ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
+        ImGuiListClipper clipper;
+        clipper.Begin(GetDisplayedLinesCount());
+        while (clipper.Step())
+            for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+            {
+                const int line_n = GetDisplayedLine(n);
+                ImGui::TextUnformatted(GetLineBegin(line_n), GetLineEnd(line_n));
+            }
+        ImGui::PopStyleVar();
+        if (AutoScroll && ImGui::GetScrollY() >= ImGui::GetScrollMaxY())
+            ImGui::SetScrollHereY(1.0f);
+    }
+    ImGui::EndChild();
+    ImGui::PopID();
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] ImGuiListClipper, ImGuiListClipperHeights
 //-----------------------------------------------------------------------------
 
 // FIXME-TABLE: This prevents us from using ImGuiListClipper _inside_ a table cell.
@@ -3024,7 +3995,7 @@ static void ImGuiListClipper_SortAndFuseRanges(ImVector<ImGuiListClipperRange>&
     }
 }
 
-static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height)
+static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_height, int row_increase = -1)
 {
     // Set cursor position and a few other things so that SetScrollHereY() and Columns() can work when seeking cursor.
     // FIXME: It is problematic that we have to do that here, because custom/equivalent end-user code would stumble on the same issue.
@@ -3043,7 +4014,8 @@ static void ImGuiListClipper_SeekCursorAndSetupPrevLine(float pos_y, float line_
         if (table->IsInsideRow)
             ImGui::TableEndRow(table);
         table->RowPosY2 = window->DC.CursorPos.y;
-        const int row_increase = (int)((off_y / line_height) + 0.5f);
+        if (row_increase < 0)
+            row_increase = (int)((off_y / line_height) + 0.5f);
         //table->CurrentRow += row_increase; // Can't do without fixing TableEndRow()
         table->RowBgColorCounter += row_increase;
     }
@@ -3075,6 +4047,7 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartPosY = window->DC.CursorPos.y;
     ItemsHeight = items_height;
     ItemsCount = items_count;
+    ItemsHeights = NULL;
     DisplayStart = -1;
     DisplayEnd = 0;
 
@@ -3088,6 +4061,13 @@ void ImGuiListClipper::Begin(int items_count, float items_height)
     StartSeekOffsetY = data->LossynessOffset;
 }
 
+void ImGuiListClipper::Begin(ImGuiListClipperHeights* items_heights)
+{
+    IM_ASSERT(items_heights->EstimatedHeight > 0.0f && "Call ImGuiListClipperHeights::Resize() with a height estimate first!");
+    Begin(items_heights->ItemsCount, items_heights->EstimatedHeight);
+    ItemsHeights = items_heights;
+}
+
 void ImGuiListClipper::End()
 {
     if (ImGuiListClipperData* data = (ImGuiListClipperData*)TempData)
@@ -3124,6 +4104,17 @@ void ImGuiListClipper::IncludeItemsByIndex(int item_begin, int item_end)
 // The ONLY reason you may want to call this is if you passed INT_MAX to ImGuiListClipper::Begin() because you couldn't step item count beforehand.
 void ImGuiListClipper::SeekCursorForItem(int item_n)
 {
+    if (ItemsHeights)
+    {
+        // Variable heights: same as below with positions summed from heights (StartSeekOffsetY == LossynessOffset - ItemsHeights->GetItemPos(ItemsFrozen)).
+        ImGuiWindow* window = Ctx->CurrentWindow;
+        const double cursor_pos = (double)window->DC.CursorPos.y - StartPosY - StartSeekOffsetY;
+        const int row_increase = (Ctx->CurrentTable != NULL) ? ImMax(item_n - ItemsHeights->FindItemAtPos(cursor_pos + 0.5f), 0) : 0;
+        float pos_y = (float)((double)StartPosY + StartSeekOffsetY + ItemsHeights->GetItemPos(item_n));
+        ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, (item_n > 0) ? ItemsHeights->GetItemHeight(item_n - 1) : ItemsHeight, row_increase);
+        return;
+    }
+
     // - Perform the add and multiply with double to allow seeking through larger ranges.
     // - StartPosY starts from ItemsFrozen, by adding SeekOffsetY we generally cancel that out (SeekOffsetY == LossynessOffset - ItemsFrozen * ItemsHeight).
     // - The reason we store SeekOffsetY instead of inferring it, is because we want to allow user to perform Seek after the last step, where ImGuiListClipperData is already done.
@@ -3131,6 +4122,49 @@ void ImGuiListClipper::SeekCursorForItem(int item_n)
     ImGuiListClipper_SeekCursorAndSetupPrevLine(pos_y, ItemsHeight);
 }
 
+// Keep visible items in place when an item above them changed height
+static void ImGuiListClipper_AdjustScrollY(ImGuiWindow* window, float delta)
+{
+    if (window->ScrollTarget.y < FLT_MAX)
+    {
+        if (window->ScrollTargetCenterRatio.y <= 0.0f)
+            window->ScrollTarget.y += delta;
+    }
+    else
+    {
+        ImGui::SetScrollY(window, window->Scroll.y + delta);
+    }
+}
+
+// Variable heights: store height of the item displayed by previous step, and extend the visible range if it ends before the bottom of the visible area
+static void ImGuiListClipper_MeasureItem(ImGuiListClipper* clipper, ImGuiListClipperData* data)
+{
+    ImGuiContext& g = *clipper->Ctx;
+    ImGuiWindow* window = g.CurrentWindow;
+    const int item_n = data->MeasureItem;
+    const float item_y1 = data->MeasureItemPosY;
+    const float item_y2 = window->DC.CursorPos.y;
+    data->MeasureItem = -1;
+    if (ImIsFloatAboveGuaranteedIntegerPrecision(item_y1) || ImIsFloatAboveGuaranteedIntegerPrecision(item_y2))
+        return;
+
+    ImGuiListClipperHeights* heights = clipper->ItemsHeights;
+    const float height = item_y2 - item_y1;
+    const float prev_height = heights->GetItemHeight(item_n);
+    if (height >= 0.0f && height != prev_height)
+    {
+        heights->SetItemHeight(item_n, height);
+        if (item_y1 < window->ClipRect.Min.y)
+            ImGuiListClipper_AdjustScrollY(window, height - prev_height);
+    }
+    if (item_n + 1 == data->VisibleItemEnd && item_n + 1 < clipper->ItemsCount && item_y2 < data->VisibleMaxY)
+    {
+        data->Ranges.push_back(ImGuiListClipperRange::FromIndices(item_n + 1, item_n + 2));
+        ImGuiListClipper_SortAndFuseRanges(data->Ranges, data->StepNo);
+        data->VisibleItemEnd++;
+    }
+}
+
 static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
 {
     ImGuiContext& g = *clipper->Ctx;
@@ -3141,6 +4175,8 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     ImGuiTable* table = g.CurrentTable;
     if (table && table->IsInsideRow)
         ImGui::TableEndRow(table);
+    if (data->MeasureItem >= 0)
+        ImGuiListClipper_MeasureItem(clipper, data);
 
     // No items
     if (clipper->ItemsCount == 0 || GetSkipItemForListClipping())
@@ -3154,6 +4190,11 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
         clipper->DisplayEnd = ImMin(data->ItemsFrozen + 1, clipper->ItemsCount);
         if (clipper->DisplayStart < clipper->DisplayEnd)
             data->ItemsFrozen++;
+        if (clipper->ItemsHeights && clipper->DisplayStart < clipper->DisplayEnd)
+        {
+            data->MeasureItem = clipper->DisplayStart;
+            data->MeasureItemPosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3196,7 +4237,10 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
     if (calc_clipping)
     {
         // Record seek offset, this is so ImGuiListClipper::Seek() can be called after ImGuiListClipperData is done
-        clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
+        if (clipper->ItemsHeights)
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - clipper->ItemsHeights->GetItemPos(data->ItemsFrozen);
+        else
+            clipper->StartSeekOffsetY = (double)data->LossynessOffset - data->ItemsFrozen * (double)clipper->ItemsHeight;
 
         if (g.LogEnabled)
         {
@@ -3239,34 +4283,59 @@ static bool ImGuiListClipper_StepInternal(ImGuiListClipper* clipper)
             const int off_min = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Up) ? -1 : 0;
             const int off_max = (is_nav_request && g.NavMoveClipDir == ImGuiDir_Down) ? 1 : 0;
             data->Ranges.push_back(ImGuiListClipperRange::FromPositions(min_y, max_y, off_min, off_max));
+            data->VisibleMaxY = max_y;
         }
 
         // Convert position ranges to item index ranges
         // - Very important: when a starting position is after our maximum item, we set Min to (ItemsCount - 1). This allows us to handle most forms of wrapping.
         // - Due to how Selectable extra padding they tend to be "unaligned" with exact unit in the item list,
         //   which with the flooring/ceiling tend to lead to 2 items instead of one being submitted.
+        // - With variable heights, positions are looked up in the heights tree, relative to the position of the next item to submit.
         for (ImGuiListClipperRange& range : data->Ranges)
             if (range.PosToIndexConvert)
             {
-                int m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
-                int m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                int m1, m2;
+                if (ImGuiListClipperHeights* heights = clipper->ItemsHeights)
+                {
+                    const double base_pos = heights->GetItemPos(already_submitted) - window->DC.CursorPos.y - data->LossynessOffset;
+                    m1 = heights->FindItemAtPos(base_pos + range.Min) - already_submitted;
+                    m2 = heights->FindItemAtPos(base_pos + range.Max) + 1 - already_submitted;
+                }
+                else
+                {
+                    m1 = (int)(((double)range.Min - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight);
+                    m2 = (int)((((double)range.Max - window->DC.CursorPos.y - data->LossynessOffset) / clipper->ItemsHeight) + 0.999999f);
+                }
                 range.Min = ImClamp(already_submitted + m1 + range.PosToIndexOffsetMin, already_submitted, clipper->ItemsCount - 1);
                 range.Max = ImClamp(already_submitted + m2 + range.PosToIndexOffsetMax, range.Min + 1, clipper->ItemsCount);
                 range.PosToIndexConvert = false;
             }
+        if (clipper->ItemsHeights && !g.LogEnabled)
+            data->VisibleItemEnd = data->Ranges.back().Max; // Visible range is the last one added
         ImGuiListClipper_SortAndFuseRanges(data->Ranges, data->StepNo);
     }
 
     // Step 0+ (if item height is given in advance) or 1+: Display the next range in line.
+    // With variable heights, display one item per step so that each item can be measured: the rest of the range becomes the next step.
     while (data->StepNo < data->Ranges.Size)
     {
         clipper->DisplayStart = ImMax(data->Ranges[data->StepNo].Min, already_submitted);
         clipper->DisplayEnd = ImMin(data->Ranges[data->StepNo].Max, clipper->ItemsCount);
+        if (clipper->ItemsHeights && clipper->DisplayEnd - clipper->DisplayStart > 1)
+        {
+            data->Ranges.insert(data->Ranges.Data + data->StepNo + 1, ImGuiListClipperRange::FromIndices(clipper->DisplayStart + 1, clipper->DisplayEnd));
+            clipper->DisplayEnd = clipper->DisplayStart + 1;
+        }
         data->StepNo++;
         if (clipper->DisplayStart >= clipper->DisplayEnd)
             continue;
         if (clipper->DisplayStart > already_submitted)
             clipper->SeekCursorForItem(clipper->DisplayStart);
+        if (clipper->ItemsHeights)
+        {
+            data->MeasureItem = clipper->DisplayStart;
+            data->MeasureItemPosY = window->DC.CursorPos.y;
+        }
         return true;
     }
 
@@ -3301,6 +4370,82 @@ bool ImGuiListClipper::Step()
     return ret;
 }
 
+// ImGuiListClipperHeights: Fenwick tree over item heights. HeightsTree[0] is unused, HeightsTree[i] holds the sum of heights of items [i - (i & -i)..i).
+ImGuiListClipperHeights::ImGuiListClipperHeights()
+{
+    ItemsCount = 0;
+    EstimatedHeight = 0.0f;
+}
+
+void ImGuiListClipperHeights::Resize(int items_count, float estimated_height)
+{
+    IM_ASSERT(items_count >= 0 && estimated_height > 0.0f);
+    EstimatedHeight = estimated_height;
+    if (items_count == ItemsCount)
+        return;
+    const int prev_count = ItemsCount;
+    HeightsTree.resize(items_count + 1);
+    HeightsTree.Data[0] = 0.0;
+    ItemsCount = items_count;
+    if (items_count < prev_count)
+        return;
+
+    // New nodes cover new items and possibly trailing existing items, whose sum we get from the existing nodes.
+    const double prev_total = GetItemPos(prev_count);
+    for (int i = prev_count + 1; i <= items_count; i++)
+    {
+        const int first_item = i - (i & -i);
+        HeightsTree.Data[i] = (double)estimated_height * ImMin(i - first_item, i - prev_count);
+        if (first_item < prev_count)
+            HeightsTree.Data[i] += prev_total - GetItemPos(first_item);
+    }
+}
+
+void ImGuiListClipperHeights::SetItemHeight(int item_n, float height)
+{
+    IM_ASSERT(item_n >= 0 && item_n < ItemsCount);
+    const double delta = (double)height - GetItemHeight(item_n);
+    for (int i = item_n + 1; i <= ItemsCount; i += i & -i)
+        HeightsTree.Data[i] += delta;
+}
+
+float ImGuiListClipperHeights::GetItemHeight(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n < ItemsCount);
+    // Node item_n + 1 covers items [item_n + 1 - lowbit..item_n]: subtract the nodes covering the other items.
+    const int i = item_n + 1;
+    double height = HeightsTree.Data[i];
+    for (int j = i - 1, stop = i - (i & -i); j > stop; j -= j & -j)
+        height -= HeightsTree.Data[j];
+    return (float)height;
+}
+
+double ImGuiListClipperHeights::GetItemPos(int item_n) const
+{
+    IM_ASSERT(item_n >= 0 && item_n <= ItemsCount);
+    double pos = 0.0;
+    for (int i = item_n; i > 0; i -= i & -i)
+        pos += HeightsTree.Data[i];
+    return pos;
+}
+
+int ImGuiListClipperHeights::FindItemAtPos(double pos) const
+{
+    if (ItemsCount == 0)
+        return 0;
+    int step = 1;
+    while (step * 2 <= ItemsCount)
+        step *= 2;
+    int item_n = 0;
+    for (; step > 0; step >>= 1)
+        if (item_n + step <= ItemsCount && HeightsTree.Data[item_n + step] <= pos)
+        {
+            item_n += step;
+            pos -= HeightsTree.Data[item_n];
+        }
+    return ImMin(item_n, ItemsCount - 1);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] STYLING
 //-----------------------------------------------------------------------------
@@ -3914,6 +5059,7 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
 
     Initialized = false;
     FontAtlasOwnedByContext = shared_font_atlas ? false : true;
+    FontAtlasLockedByFrame = false;
     Font = NULL;
     FontSize = FontBaseSize = FontScale = CurrentDpiScale = 0.0f;
     IO.Fonts = shared_font_atlas ? shared_font_atlas : IM_NEW(ImFontAtlas)();
@@ -3923,6 +5069,8 @@ ImGuiContext::ImGuiContext(ImFontAtlas* shared_font_atlas)
     WithinEndChildID = 0;
     WithinFrameScope = WithinFrameScopeWithImplicitWindow = false;
     GcCompactAll = false;
+    GcTransientBytes = GcTransientBytesMax = 0;
+    GcBudgetCompactCount = GcShrinkCount = 0;
     TestEngineHookItems = false;
     TestEngine = NULL;
     memset(ContextName, 0, sizeof(ContextName));
@@ -4133,7 +5281,7 @@ void ImGui::Initialize()
     {
         ImGuiSettingsHandler ini_handler;
         ini_handler.TypeName = "Window";
-        ini_handler.TypeHash = ImHashStr("Window");
+        ini_handler.TypeHash = IM_HASH_STR_LITERAL("Window", 0);
         ini_handler.ClearAllFn = WindowSettingsHandler_ClearAll;
         ini_handler.ReadOpenFn = WindowSettingsHandler_ReadOpen;
         ini_handler.ReadLineFn = WindowSettingsHandler_ReadLine;
@@ -4347,6 +5495,7 @@ void ImGui::GcCompactTransientMiscBuffers()
     g.GroupStack.clear();
     g.MultiSelectTempDataStacked = 0;
     g.MultiSelectTempData.clear_destruct();
+    g.DrawListSharedData.WrapCache.Clear();
     TableGcCompactSettings();
 }
 
@@ -4376,6 +5525,157 @@ void ImGui::GcAwakeTransientWindowBuffers(ImGuiWindow* window)
     window->MemoryDrawListIdxCapacity = window->MemoryDrawListVtxCapacity = 0;
 }
 
+template<typename T>
+static inline size_t GcVectorBytes(const ImVector<T>& v) { return (size_t)v.Capacity * sizeof(T); }
+
+static size_t GcCalcDrawListSplitterSize(const ImDrawListSplitter* splitter)
+{
+    size_t size = GcVectorBytes(splitter->_Channels);
+    for (int i = 0; i < splitter->_Channels.Size; i++)
+        if (i != splitter->_Current) // Current channel is a copy of the draw list buffers
+            size += GcVectorBytes(splitter->_Channels[i]._CmdBuffer) + GcVectorBytes(splitter->_Channels[i]._IdxBuffer) + GcVectorBytes(splitter->_Channels[i]._GlyphBuffer);
+    return size;
+}
+
+// Capacity of the buffers freed by GcCompactTransientWindowBuffers()
+size_t ImGui::GcCalcTransientWindowBuffersSize(ImGuiWindow* window)
+{
+    ImDrawList* draw_list = window->DrawList;
+    size_t size = GcVectorBytes(draw_list->CmdBuffer) + GcVectorBytes(draw_list->IdxBuffer) + GcVectorBytes(draw_list->VtxBuffer) + GcVectorBytes(draw_list->GlyphBuffer);
+    size += GcVectorBytes(draw_list->_Path) + GcVectorBytes(draw_list->_ClipRectStack) + GcVectorBytes(draw_list->_TextureIdStack) + GcVectorBytes(draw_list->_CallbacksDataBuf);
+    size += GcCalcDrawListSplitterSize(&draw_list->_Splitter);
+    size += GcVectorBytes(window->IDStack) + GcVectorBytes(window->DC.ChildWindows) + GcVectorBytes(window->DC.ItemWidthStack) + GcVectorBytes(window->DC.TextWrapPosStack);
+    return size;
+}
+
+// Reallocate to a smaller capacity (ImVector<> never shrinks by itself)
+template<typename T>
+static void GcShrinkVector(ImVector<T>& v, int new_capacity)
+{
+    IM_ASSERT(new_capacity >= v.Size);
+    if (new_capacity >= v.Capacity)
+        return;
+    T* new_data = new_capacity > 0 ? (T*)IM_ALLOC((size_t)new_capacity * sizeof(T)) : NULL;
+    if (v.Size > 0)
+        memcpy(new_data, v.Data, (size_t)v.Size * sizeof(T));
+    IM_FREE(v.Data);
+    v.Data = new_data;
+    v.Capacity = new_capacity;
+}
+
+// Called by NewFrame() after the timer based GC:
+// - Measure transient buffers of windows and tables, reported in Metrics->Memory allocations.
+// - io.ConfigMemoryShrinkToFit: release draw list capacity of visible windows left over by a spike of vertices.
+//   Capacity is only released when it stayed over 4x the peak use for a whole period, and we keep 50% above that peak, so a window can't oscillate between growth and shrink.
+// - io.ConfigMemoryCompactBudget: compact hidden windows and tables in least recently used order until we fit the budget.
+void ImGui::GcUpdateMemoryBudget()
+{
+    ImGuiContext& g = *GImGui;
+    const float shrink_period = g.IO.ConfigMemoryCompactTimer;
+    const bool shrink_enabled = g.IO.ConfigMemoryShrinkToFit && (shrink_period >= 0.0f || g.GcCompactAll);
+    const size_t shrink_min_bytes = 64 * 1024; // Not worth a reallocation below that
+
+    size_t total_bytes = 0;
+    for (ImGuiWindow* window : g.Windows)
+    {
+        if (window->WasActive && shrink_enabled)
+        {
+            ImDrawList* draw_list = window->DrawList;
+            window->MemoryDrawListIdxPeak = ImMax(window->MemoryDrawListIdxPeak, draw_list->IdxBuffer.Size);
+            window->MemoryDrawListVtxPeak = ImMax(window->MemoryDrawListVtxPeak, draw_list->VtxBuffer.Size);
+            if (g.GcCompactAll || (float)g.Time - window->MemoryShrinkTime >= shrink_period)
+            {
+                bool shrunk = false;
+                if (draw_list->IdxBuffer.Capacity > window->MemoryDrawListIdxPeak * 4 && (size_t)(draw_list->IdxBuffer.Capacity - window->MemoryDrawListIdxPeak) * sizeof(ImDrawIdx) >= shrink_min_bytes)
+                {
+                    GcShrinkVector(draw_list->IdxBuffer, window->MemoryDrawListIdxPeak + window->MemoryDrawListIdxPeak / 2);
+                    draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
+                    shrunk = true;
+                }
+                if (draw_list->VtxBuffer.Capacity > window->MemoryDrawListVtxPeak * 4 && (size_t)(draw_list->VtxBuffer.Capacity - window->MemoryDrawListVtxPeak) * sizeof(ImDrawVert) >= shrink_min_bytes)
+                {
+                    GcShrinkVector(draw_list->VtxBuffer, window->MemoryDrawListVtxPeak + window->MemoryDrawListVtxPeak / 2);
+                    draw_list->_VtxWritePtr = draw_list->VtxBuffer.Data + draw_list->VtxBuffer.Size;
+                    shrunk = true;
+                }
+                if (shrunk)
+                    g.GcShrinkCount++;
+                window->MemoryDrawListIdxPeak = draw_list->IdxBuffer.Size;
+                window->MemoryDrawListVtxPeak = draw_list->VtxBuffer.Size;
+                window->MemoryShrinkTime = (float)g.Time;
+            }
+        }
+        window->MemoryTransientBytes = GcCalcTransientWindowBuffersSize(window);
+        total_bytes += window->MemoryTransientBytes;
+    }
+    for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+        if (g.TablesLastTimeActive[i] >= 0.0f)
+        {
+            ImGuiTable* table = g.Tables.GetByIndex(i);
+            total_bytes += GcVectorBytes(table->ColumnsNames.Buf) + GcVectorBytes(table->SortSpecsMulti);
+        }
+    for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
+        total_bytes += GcCalcDrawListSplitterSize(&table_temp_data.DrawSplitter);
+
+    // Enforce budget. Linear search for the least recently used candidate on each step:
+    // this only runs on frames exceeding the budget and doesn't allocate.
+    const size_t budget = g.IO.ConfigMemoryCompactBudget;
+    while (budget > 0 && total_bytes > budget)
+    {
+        float lru_time = FLT_MAX;
+        ImGuiWindow* lru_window = NULL;
+        int lru_table_idx = -1;
+        ImGuiTableTempData* lru_temp_data = NULL;
+        for (ImGuiWindow* window : g.Windows)
+            if (!window->WasActive && !window->MemoryCompacted && window->MemoryTransientBytes > 0 && window->LastTimeActive < lru_time)
+            {
+                lru_time = window->LastTimeActive;
+                lru_window = window;
+            }
+        for (int i = 0; i < g.TablesLastTimeActive.Size; i++)
+            if (g.TablesLastTimeActive[i] >= 0.0f && g.TablesLastTimeActive[i] < lru_time && g.Tables.GetByIndex(i)->LastFrameActive < g.FrameCount - 1)
+            {
+                lru_time = g.TablesLastTimeActive[i];
+                lru_table_idx = i;
+                lru_window = NULL;
+            }
+        for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
+            if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < lru_time && table_temp_data.LastFrameActive < g.FrameCount - 1)
+            {
+                lru_time = table_temp_data.LastTimeActive;
+                lru_temp_data = &table_temp_data;
+                lru_table_idx = -1;
+                lru_window = NULL;
+            }
+
+        if (lru_temp_data != NULL)
+        {
+            total_bytes -= GcCalcDrawListSplitterSize(&lru_temp_data->DrawSplitter);
+            TableGcCompactTransientBuffers(lru_temp_data);
+        }
+        else if (lru_table_idx != -1)
+        {
+            ImGuiTable* table = g.Tables.GetByIndex(lru_table_idx);
+            total_bytes -= GcVectorBytes(table->ColumnsNames.Buf) + GcVectorBytes(table->SortSpecsMulti);
+            TableGcCompactTransientBuffers(table);
+        }
+        else if (lru_window != NULL)
+        {
+            total_bytes -= lru_window->MemoryTransientBytes;
+            GcCompactTransientWindowBuffers(lru_window);
+            lru_window->MemoryTransientBytes = GcCalcTransientWindowBuffersSize(lru_window);
+            total_bytes += lru_window->MemoryTransientBytes;
+        }
+        else
+        {
+            break; // Everything left is in use
+        }
+        g.GcBudgetCompactCount++;
+    }
+    g.GcTransientBytes = total_bytes;
+    g.GcTransientBytesMax = ImMax(g.GcTransientBytesMax, total_bytes);
+}
+
 void ImGui::SetActiveID(ImGuiID id, ImGuiWindow* window)
 {
     ImGuiContext& g = *GImGui;
@@ -4776,6 +6076,13 @@ float ImGui::CalcWrapWidthForPos(const ImVec2& pos, float wrap_pos_x)
 // IM_ALLOC() == ImGui::MemAlloc()
 void* ImGui::MemAlloc(size_t size)
 {
+#ifdef IMGUI_DEBUG_ALLOC_CALL_SITES
+#ifdef _MSC_VER
+    GImAllocatorCallSite = _ReturnAddress();
+#else
+    GImAllocatorCallSite = __builtin_return_address(0);
+#endif
+#endif
     void* ptr = (*GImAllocatorAllocFunc)(size, GImAllocatorUserData);
 #ifndef IMGUI_DISABLE_DEBUG_TOOLS
     if (ImGuiContext* ctx = GImGui)
@@ -4795,6 +6102,14 @@ void ImGui::MemFree(void* ptr)
     return (*GImAllocatorFreeFunc)(ptr, GImAllocatorUserData);
 }
 
+#ifdef IMGUI_DEBUG_ALLOC_CALL_SITES
+// Only valid from within the allocator function. Most allocations come from ImVector<> growth, which is generally inlined in the function that we want to see here.
+const void* ImGui::DebugGetAllocCallSite()
+{
+    return GImAllocatorCallSite;
+}
+#endif
+
 // We record the number of allocation in recent frames, as a way to audit/sanitize our guiding principles of "no allocations on idle/repeating frames"
 void ImGui::DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size)
 {
@@ -5161,7 +6476,11 @@ static void SetupDrawListSharedData()
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AntiAliasedFill;
     if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)
         g.DrawListSharedData.InitialFlags |= ImDrawListFlags_AllowVtxOffset;
+    if (g.IO.BackendFlags & ImGuiBackendFlags_RendererHasGlyphInstances)
+        g.DrawListSharedData.InitialFlags |= ImDrawListFlags_GlyphInstances;
+    g.DrawListSharedData.GlyphTableAtlas = g.IO.Fonts;
     g.DrawListSharedData.InitialFringeScale = 1.0f; // FIXME-DPI: Change this for some DPI scaling experiments.
+    g.DrawListSharedData.WrapCache.NewFrame();
 }
 
 void ImGui::NewFrame()
@@ -5205,7 +6524,12 @@ void ImGui::NewFrame()
     UpdateViewportsNewFrame();
 
     // Setup current font and draw list shared data
-    g.IO.Fonts->Locked = true;
+    // (a shared atlas locked by its owner is never written to, so contexts on other threads can read it while we run)
+    if (!g.IO.Fonts->Locked)
+    {
+        g.IO.Fonts->Locked = true;
+        g.FontAtlasLockedByFrame = true;
+    }
     SetupDrawListSharedData();
     SetCurrentFont(GetDefaultFont());
     IM_ASSERT(g.Font->IsLoaded());
@@ -5370,6 +6694,7 @@ void ImGui::NewFrame()
     for (ImGuiTableTempData& table_temp_data : g.TablesTempData)
         if (table_temp_data.LastTimeActive >= 0.0f && table_temp_data.LastTimeActive < memory_compact_start_time)
             TableGcCompactTransientBuffers(&table_temp_data);
+    GcUpdateMemoryBudget();
     if (g.GcCompactAll)
         GcCompactTransientMiscBuffers();
     g.GcCompactAll = false;
@@ -5704,7 +7029,11 @@ void ImGui::EndFrame()
     g.IO.MetricsActiveWindows = g.WindowsActiveCount;
 
     // Unlock font atlas
-    g.IO.Fonts->Locked = false;
+    if (g.FontAtlasLockedByFrame)
+    {
+        g.IO.Fonts->Locked = false;
+        g.FontAtlasLockedByFrame = false;
+    }
 
     // Clear Input data for next frame
     g.IO.MousePosPrev = g.IO.MousePos;
@@ -5800,7 +7129,8 @@ ImVec2 ImGui::CalcTextSize(const char* text, const char* text_end, bool hide_tex
     const float font_size = g.FontSize;
     if (text == text_display_end)
         return ImVec2(0.0f, font_size);
-    ImVec2 text_size = font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
+    const ImFontWrapCacheEntry* wrap_cache = (wrap_width > 0.0f) ? g.DrawListSharedData.WrapCache.GetEntry(font, font_size, wrap_width, text, text_display_end) : NULL;
+    ImVec2 text_size = wrap_cache ? wrap_cache->Size : font->CalcTextSizeA(font_size, FLT_MAX, wrap_width, text, text_display_end, NULL);
 
     // Round
     // FIXME: This has been here since Dec 2015 (7b0bf230) but down the line we want this out.
@@ -6158,7 +7488,7 @@ bool ImGui::BeginChildEx(const char* name, ImGuiID id, const ImVec2& size_arg, I
 
     // Process navigation-in immediately so NavInit can run on first frame
     // Can enter a child if (A) it has navigable items or (B) it can be scrolled.
-    const ImGuiID temp_id_for_activation = ImHashStr("##Child", 0, id);
+    const ImGuiID temp_id_for_activation = IM_HASH_STR_LITERAL("##Child", id);
     if (g.ActiveId == temp_id_for_activation)
         ClearActiveID();
     if (g.NavActivateId == id && !(child_flags & ImGuiChildFlags_NavFlattened) && (child_window->DC.NavLayersActiveMask != 0 || child_window->DC.NavWindowHasScrollY))
@@ -6499,7 +7829,7 @@ ImGuiID ImGui::GetWindowResizeCornerID(ImGuiWindow* window, int n)
 {
     IM_ASSERT(n >= 0 && n < 4);
     ImGuiID id = window->ID;
-    id = ImHashStr("#RESIZE", 0, id);
+    id = IM_HASH_STR_LITERAL("#RESIZE", id);
     id = ImHashData(&n, sizeof(int), id);
     return id;
 }
@@ -6510,7 +7840,7 @@ ImGuiID ImGui::GetWindowResizeBorderID(ImGuiWindow* window, ImGuiDir dir)
     IM_ASSERT(dir >= 0 && dir < 4);
     int n = (int)dir + 4;
     ImGuiID id = window->ID;
-    id = ImHashStr("#RESIZE", 0, id);
+    id = IM_HASH_STR_LITERAL("#RESIZE", id);
     id = ImHashData(&n, sizeof(int), id);
     return id;
 }
@@ -7197,6 +8527,14 @@ bool ImGui::Begin(const char* name, bool* p_open, ImGuiWindowFlags flags)
         window->ClipRect = ImVec4(-FLT_MAX, -FLT_MAX, +FLT_MAX, +FLT_MAX);
         window->IDStack.resize(1);
         window->DrawList->_ResetForNewFrame();
+        if (window->RootWindow->Flags & ImGuiWindowFlags_CachedRender)
+        {
+            // Interacted windows are likely to change every frame: leave them uncached rather than re-rendering the cache.
+            ImGuiWindow* root_window = window->RootWindow;
+            const bool interacted = (g.HoveredWindow && g.HoveredWindow->RootWindow == root_window) || (g.NavWindow && g.NavWindow->RootWindow == root_window) || (g.ActiveIdWindow && g.ActiveIdWindow->RootWindow == root_window) || (g.MovingWindow && g.MovingWindow->RootWindow == root_window);
+            if (!interacted)
+                window->DrawList->Flags |= ImDrawListFlags_CachedRender;
+        }
         window->DC.CurrentTableIdx = -1;
 
         // Restore buffer capacity when woken from a compacted state, to avoid
@@ -13764,7 +15102,7 @@ static void ImGui::NavUpdateWindowing()
 
     // Start CTRL+Tab or Square+L/R window selection
     // (g.ConfigNavWindowingKeyNext/g.ConfigNavWindowingKeyPrev defaults are ImGuiMod_Ctrl|ImGuiKey_Tab and ImGuiMod_Ctrl|ImGuiMod_Shift|ImGuiKey_Tab)
-    const ImGuiID owner_id = ImHashStr("##NavUpdateWindowing");
+    const ImGuiID owner_id = IM_HASH_STR_LITERAL("##NavUpdateWindowing", 0);
     const bool nav_gamepad_active = (io.ConfigFlags & ImGuiConfigFlags_NavEnableGamepad) != 0 && (io.BackendFlags & ImGuiBackendFlags_HasGamepad) != 0;
     const bool nav_keyboard_active = (io.ConfigFlags & ImGuiConfigFlags_NavEnableKeyboard) != 0;
     const bool keyboard_next_window = allow_windowing && g.ConfigNavWindowingKeyNext && Shortcut(g.ConfigNavWindowingKeyNext, ImGuiInputFlags_Repeat | ImGuiInputFlags_RouteAlways, owner_id);
@@ -14078,7 +15416,7 @@ bool ImGui::BeginDragDropSource(ImGuiDragDropFlags flags)
     {
         // When ImGuiDragDropFlags_SourceExtern is set:
         window = NULL;
-        source_id = ImHashStr("#SourceExtern");
+        source_id = IM_HASH_STR_LITERAL("#SourceExtern", 0);
         source_drag_active = true;
         mouse_button = g.IO.MouseDown[0] ? 0 : -1;
         KeepAliveID(source_id);
@@ -15851,6 +17189,10 @@ void ImGui::ShowMetricsWindow(bool* p_open)
         ImGuiDebugAllocInfo* info = &g.DebugAllocInfo;
         Text("%d current allocations", info->TotalAllocCount - info->TotalFreeCount);
         if (SmallButton("GC now")) { g.GcCompactAll = true; }
+        Text("Transient buffers: %.1f KB (peak %.1f KB)", g.GcTransientBytes / 1024.0f, g.GcTransientBytesMax / 1024.0f);
+        if (io.ConfigMemoryCompactBudget > 0)
+            Text("Budget: %.1f KB, %d compacted to fit", io.ConfigMemoryCompactBudget / 1024.0f, g.GcBudgetCompactCount);
+        Text("Draw lists shrunk to fit: %d", g.GcShrinkCount);
         Text("Recent frames with allocations:");
         int buf_size = IM_ARRAYSIZE(info->LastEntriesBuf);
         for (int n = buf_size - 1; n >= 0; n--)
@@ -16141,7 +17483,7 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
     IM_UNUSED(viewport); // Used in docking branch
     ImGuiMetricsConfig* cfg = &g.DebugMetricsConfig;
     int cmd_count = draw_list->CmdBuffer.Size;
-    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
+    if (cmd_count > 0 && draw_list->CmdBuffer.back().ElemCount == 0 && draw_list->CmdBuffer.back().GlyphCount == 0 && draw_list->CmdBuffer.back().UserCallback == NULL)
         cmd_count--;
     bool node_open = TreeNode(draw_list, "%s: '%s' %d vtx, %d indices, %d cmds", label, draw_list->_OwnerName ? draw_list->_OwnerName : "", draw_list->VtxBuffer.Size, draw_list->IdxBuffer.Size, cmd_count);
     if (draw_list == GetWindowDrawList())
@@ -16197,6 +17539,8 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
         // Display vertex information summary. Hover to get all triangles drawn in wire-frame
         ImFormatString(buf, IM_ARRAYSIZE(buf), "Mesh: ElemCount: %d, VtxOffset: +%d, IdxOffset: +%d, Area: ~%0.f px", pcmd->ElemCount, pcmd->VtxOffset, pcmd->IdxOffset, total_area);
         Selectable(buf);
+        if (pcmd->GlyphCount > 0)
+            BulletText("Glyphs: GlyphCount: %d, GlyphOffset: +%d", pcmd->GlyphCount, pcmd->GlyphOffset);
         if (IsItemHovered() && fg_draw_list)
             DebugNodeDrawCmdShowMeshAndBoundingBox(fg_draw_list, draw_list, pcmd, true, false);
 
@@ -16212,8 +17556,9 @@ void ImGui::DebugNodeDrawList(ImGuiWindow* window, ImGuiViewportP* viewport, con
                 {
                     const ImDrawVert& v = vtx_buffer[idx_buffer ? idx_buffer[idx_i] : idx_i];
                     triangle[n] = v.pos;
+                    const ImVec2 uv = v.uv;
                     buf_p += ImFormatString(buf_p, buf_end - buf_p, "%s %04d: pos (%8.2f,%8.2f), uv (%.6f,%.6f), col %08X\n",
-                        (n == 0) ? "Vert:" : "     ", idx_i, v.pos.x, v.pos.y, v.uv.x, v.uv.y, v.col);
+                        (n == 0) ? "Vert:" : "     ", idx_i, triangle[n].x, triangle[n].y, uv.x, uv.y, v.col);
                 }
 
                 Selectable(buf, false);
@@ -16472,6 +17817,8 @@ void ImGui::DebugNodeWindow(ImGuiWindow* window, const char* label)
 
     if (window->MemoryCompacted)
         TextDisabled("Note: some memory buffers have been compacted/freed.");
+    else
+        TextDisabled("Transient buffers: %.1f KB", window->MemoryTransientBytes / 1024.0f);
 
     if (g.IO.ConfigDebugIsDebuggerPresent && DebugBreakButton("**DebugBreak**", "in Begin()"))
         g.DebugBreakInWindow = window->ID;
@@ -46,7 +46,7 @@ Index of this file:
 // [SECTION] ImGuiIO
 // [SECTION] Misc data structures (ImGuiInputTextCallbackData, ImGuiSizeCallbackData, ImGuiPayload)
 // [SECTION] Helpers (ImGuiOnceUponAFrame, ImGuiTextFilter, ImGuiTextBuffer, ImGuiStorage, ImGuiListClipper, Math Operators, ImColor)
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiMultiSelectIO, ImGuiSelectionRequest, ImGuiSelectionBasicStorage, ImGuiSelectionExternalStorage, ImGuiSelectionRangeStorage)
 // [SECTION] Drawing API (ImDrawCallback, ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawFlags, ImDrawListFlags, ImDrawList, ImDrawData)
 // [SECTION] Font API (ImFontConfig, ImFontGlyph, ImFontGlyphRangesBuilder, ImFontAtlasFlags, ImFontAtlas, ImFont)
 // [SECTION] Viewports (ImGuiViewportFlags, ImGuiViewport)
@@ -166,7 +166,7 @@ struct ImDrawData;                  // All draw command lists required to render
 struct ImDrawList;                  // A single draw command list (generally one per window, conceptually you may see this as a dynamic "mesh" builder)
 struct ImDrawListSharedData;        // Data shared among multiple draw lists (typically owned by parent ImGui context, but you may create one yourself)
 struct ImDrawListSplitter;          // Helper to split a draw list into different layers which can be drawn into out of order, then flattened back.
-struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+struct ImDrawVert;                  // A single vertex (pos + uv + col = 20 bytes by default, 12 bytes with IMGUI_USE_COMPACT_DRAWVERT. Override layout with IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
 struct ImFont;                      // Runtime data for a single font within a parent ImFontAtlas
 struct ImFontAtlas;                 // Runtime data for multiple fonts, bake multiple fonts into a single texture, TTF/OTF font loader
 struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_truetype or FreeType).
@@ -181,6 +181,7 @@ struct ImGuiIO;                     // Main configuration and I/O between your a
 struct ImGuiInputTextCallbackData;  // Shared state of InputText() when using custom ImGuiInputTextCallback (rare/advanced use)
 struct ImGuiKeyData;                // Storage for ImGuiIO and IsKeyDown(), IsKeyPressed() etc functions.
 struct ImGuiListClipper;            // Helper to manually clip large list of items
+struct ImGuiListClipperHeights;     // Helper to store heights of items for ImGuiListClipper, when items have different heights
 struct ImGuiMultiSelectIO;          // Structure to interact with a BeginMultiSelect()/EndMultiSelect() block
 struct ImGuiOnceUponAFrame;         // Helper for running a block of code not more than once a frame
 struct ImGuiPayload;                // User data payload for drag and drop operations
@@ -188,6 +189,7 @@ struct ImGuiPlatformIO;             // Interface between platform/renderer backe
 struct ImGuiPlatformImeData;        // Platform IME data for io.PlatformSetImeDataFn() function.
 struct ImGuiSelectionBasicStorage;  // Optional helper to store multi-selection state + apply multi-selection requests.
 struct ImGuiSelectionExternalStorage;//Optional helper to apply multi-selection requests to existing randomly accessible storage.
+struct ImGuiSelectionRangeStorage;  // Optional helper to store multi-selection of indices as ranges or bits + apply multi-selection requests, for very large lists.
 struct ImGuiSelectionRequest;       // A selection request (stored in ImGuiMultiSelectIO)
 struct ImGuiSizeCallbackData;       // Callback data when using SetNextWindowSizeConstraints() (rare/advanced use)
 struct ImGuiStorage;                // Helper for key->value storage (container sorted by key)
@@ -195,8 +197,15 @@ struct ImGuiStoragePair;            // Helper for key->value storage (pair)
 struct ImGuiStyle;                  // Runtime data for styling/colors
 struct ImGuiTableSortSpecs;         // Sorting specifications for a table (often handling sort specs for a single column, occasionally more)
 struct ImGuiTableColumnSortSpecs;   // Sorting specification for one column of a table
+struct ImGuiTableSortCache;         // Helper to keep a sorted permutation of a large table's rows, re-sorted only when sort specs or row count change
 struct ImGuiTextBuffer;             // Helper to hold and append into a text buffer (~string builder)
+struct ImGuiTextDocument;           // Helper to hold a large editable text split in chunks, with a line index (for InputTextMultilineLarge())
 struct ImGuiTextFilter;             // Helper to parse and apply text filters (e.g. "aaaaa[,bbbbb][,ccccc]")
+struct ImGuiTextLog;                // Helper to hold a large append-only log with a line index and incremental filtering (for log viewers)
+struct ImGuiTextLogChunk;           // A block of text of ImGuiTextLog
+struct ImGuiTextLogQueue;           // Opaque lock-free ring buffer used by ImGuiTextLog::QueueAppend()
+struct ImGuiTreeView;               // Helper to display a very large tree with ImGuiListClipper: nodes hierarchy + flattened list of visible nodes (for TreeViewNode())
+struct ImGuiTreeViewNode;           // A node of a ImGuiTreeView
 struct ImGuiViewport;               // A Platform Window (always only one in 'master' branch), in the future may represent Platform Monitor
 
 // Enumerations
@@ -271,6 +280,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef int     (*ImGuiTableSortCompareFunc)(const ImGuiTableColumnSortSpecs* spec, int item_a, int item_b, void* user_data); // Function signature for ImGuiTableSortCache: compare two items on one column, in ascending order
+typedef void    (*ImGuiParallelForFunc)(void (*job_func)(void* job_data, int job_n), void* job_data, int job_count, void* user_data); // Function signature to run job_func(job_data, 0..job_count-1) on a worker pool and wait for completion
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // - This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -628,8 +639,10 @@ namespace ImGui
     // Widgets: Input with Keyboard
     // - If you want to use InputText() with std::string or any custom dynamic string type, see misc/cpp/imgui_stdlib.h and comments in imgui_demo.cpp.
     // - Most of the ImGuiInputTextFlags flags are only useful for InputText() and not for InputFloatX, InputIntX, InputDouble etc.
+    // - For multi-MB text (logs, large config files), use InputTextMultilineLarge() with an ImGuiTextDocument: it never touches the whole text in a frame.
     IMGUI_API bool          InputText(const char* label, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputTextMultiline(const char* label, char* buf, size_t buf_size, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
+    IMGUI_API bool          InputTextMultilineLarge(const char* label, ImGuiTextDocument* doc, const ImVec2& size = ImVec2(0, 0), ImGuiInputTextFlags flags = 0); // Only _ReadOnly, _AllowTabInput, _NoUndoRedo and character filtering flags are supported.
     IMGUI_API bool          InputTextWithHint(const char* label, const char* hint, char* buf, size_t buf_size, ImGuiInputTextFlags flags = 0, ImGuiInputTextCallback callback = NULL, void* user_data = NULL);
     IMGUI_API bool          InputFloat(const char* label, float* v, float step = 0.0f, float step_fast = 0.0f, const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
     IMGUI_API bool          InputFloat2(const char* label, float v[2], const char* format = "%.3f", ImGuiInputTextFlags flags = 0);
@@ -673,6 +686,7 @@ namespace ImGui
     IMGUI_API bool          CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFlags flags = 0); // when 'p_visible != NULL': if '*p_visible==true' display an additional small close button on upper right of the header which will set the bool to false when clicked, if '*p_visible==false' don't display the header.
     IMGUI_API void          SetNextItemOpen(bool is_open, ImGuiCond cond = 0);                  // set next TreeNode/CollapsingHeader open state.
     IMGUI_API void          SetNextItemStorageID(ImGuiID storage_id);                           // set id to use for open/close storage (default to same as item id).
+    IMGUI_API bool          TreeViewNode(ImGuiTreeView* tree, int row_n, const char* label, ImGuiTreeNodeFlags flags = 0); // display node tree->Rows[row_n] indented by its depth, open state is stored in 'tree'. call in a ImGuiListClipper loop over tree->Rows. doesn't indent nor push on ID stack. user doesn't have to call TreePop().
 
     // Widgets: Selectables
     // - A selectable highlights when hovered, and can display another color when selected.
@@ -1088,6 +1102,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 16,  // No keyboard/gamepad navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 17,  // No focusing toward this window with keyboard/gamepad navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 18,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_CachedRender           = 1 << 19,  // Allow the renderer backend to draw the window (and its child windows) from a cached texture while it is not hovered/focused/active, re-rendering only when contents change. Require backend support (imgui_impl_opengl3), otherwise ignored.
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -1610,6 +1625,7 @@ enum ImGuiBackendFlags_
     ImGuiBackendFlags_HasMouseCursors       = 1 << 1,   // Backend Platform supports honoring GetMouseCursor() value to change the OS cursor shape.
     ImGuiBackendFlags_HasSetMousePos        = 1 << 2,   // Backend Platform supports io.WantSetMousePos requests to reposition the OS mouse position (only used if io.ConfigNavMoveSetMousePos is set).
     ImGuiBackendFlags_RendererHasVtxOffset  = 1 << 3,   // Backend Renderer supports ImDrawCmd::VtxOffset. This enables output of large meshes (64K+ vertices) while still using 16-bit indices.
+    ImGuiBackendFlags_RendererHasGlyphInstances = 1 << 4, // Backend Renderer supports ImDrawCmd::GlyphOffset/GlyphCount. This enables output of text as one ImDrawGlyph per character instead of 4 vertices + 6 indices.
 };
 
 // Enumeration for PushStyleColor() / PopStyleColor()
@@ -2281,6 +2297,8 @@ struct ImGuiIO
     bool        ConfigWindowsCopyContentsWithCtrlC; // = false      // [EXPERIMENTAL] CTRL+C copy the contents of focused window into the clipboard. Experimental because: (1) has known issues with nested Begin/End pairs (2) text output quality varies (3) text output is in submission order rather than spatial order.
     bool        ConfigScrollbarScrollByPage;    // = true           // Enable scrolling page by page when clicking outside the scrollbar grab. When disabled, always scroll to clicked location. When enabled, Shift+Click scrolls to clicked location.
     float       ConfigMemoryCompactTimer;       // = 60.0f          // Timer (in seconds) to free transient windows/tables memory buffers when unused. Set to -1.0f to disable.
+    size_t      ConfigMemoryCompactBudget;      // = 0              // Budget (in bytes) for transient windows/tables memory buffers. When exceeded, buffers of least recently used hidden windows/tables are freed without waiting for ConfigMemoryCompactTimer. 0 to disable.
+    bool        ConfigMemoryShrinkToFit;        // = true           // Shrink draw list buffers of visible windows which used less than a quarter of their capacity over the last ConfigMemoryCompactTimer seconds (e.g. after a transient spike of vertices).
 
     // Inputs Behaviors
     // (other variables, ones which are expected to be tweaked within UI code, are exposed in ImGuiStyle)
@@ -2611,6 +2629,130 @@ struct ImGuiTextBuffer
     IMGUI_API void      appendfv(const char* fmt, va_list args) IM_FMTLIST(2);
 };
 
+// Helper: Editable text for very large documents (e.g. multi-MB logs or config files), used by InputTextMultilineLarge().
+// - Text is stored as a sequence of chunks of at most ChunkSizeMax bytes, so an edit only moves bytes within one chunk.
+// - Byte and line-break counts of each chunk are summed in Fenwick trees: converting between offsets and line numbers
+//   costs O(log(chunks)) + a scan of one chunk, whatever the size of the document.
+// - Offsets are in bytes (UTF-8). Lines are separated by '\n' and line numbers start at 0.
+// - The edit state (cursor, selection, undo) of InputTextMultilineLarge() is stored here, so a document should be displayed by one widget at a time.
+struct ImGuiTextDocument
+{
+    struct Chunk    { ImVector<char> Text; int LineBreaks; Chunk() { LineBreaks = 0; } };
+    struct UndoRecord { int Offset; int DeletedLen; int InsertedLen; int BufOffset; };   // Deleted then inserted text are stored in UndoBuf[BufOffset...]
+
+    ImVector<Chunk> Chunks;                 // Always at least one chunk
+    ImVector<int>   ChunksBytesTree;        // Fenwick tree over Chunks[].Text.Size (1-based)
+    ImVector<int>   ChunksLinesTree;        // Fenwick tree over Chunks[].LineBreaks (1-based)
+    int             TextLen;                // Size of document in bytes
+    int             LineBreaksCount;        // Number of '\n' in document
+    int             ChunkSizeMax;           // = 16*1024. Chunks growing above this are split in half. Set before calling SetText().
+
+    // Edit state (used by InputTextMultilineLarge())
+    int             Cursor;                 // Byte offset of cursor
+    int             SelectStart;            // Byte offset of other end of selection (== Cursor when nothing is selected)
+    float           CursorPreferredX;       // Horizontal position to keep when moving up/down (-1 when not set)
+    float           CursorAnim;
+    bool            CursorFollow;           // Scroll to make cursor visible on next display
+    float           MaxLineWidth;           // Widest line ever displayed: we never measure the whole document
+    ImVector<UndoRecord> UndoRecords;
+    ImVector<char>  UndoBuf;
+    int             UndoPos;                // Number of records currently applied (UndoRecords[UndoPos...] can be redone)
+    ImVector<char>  TempBuf;                // Scratch buffer for the lines being displayed or edited
+
+    IMGUI_API ImGuiTextDocument();
+    IMGUI_API ~ImGuiTextDocument();
+    ImGuiTextDocument(const ImGuiTextDocument&) = delete;                       // Chunks are freed by the destructor and moved with memcpy(): not copyable
+    ImGuiTextDocument& operator=(const ImGuiTextDocument&) = delete;
+    IMGUI_API void  Clear();                                                    // Erase text and undo history, free memory
+    IMGUI_API void  SetText(const char* text, const char* text_end = NULL);     // Replace text, clear undo history
+    IMGUI_API void  Insert(int offset, const char* text, const char* text_end = NULL);
+    IMGUI_API void  Delete(int offset, int len);
+    IMGUI_API void  GetText(int offset, int len, ImVector<char>* out) const;    // Append text range to 'out' (not zero-terminated)
+    IMGUI_API char  GetChar(int offset) const;
+    IMGUI_API int   GetLineStart(int line_no) const;                            // Offset of first byte of line
+    IMGUI_API int   GetLineEnd(int line_no) const;                              // Offset of '\n' ending the line, or TextLen for last line
+    IMGUI_API int   GetLineFromOffset(int offset) const;
+    int             GetTextLen() const      { return TextLen; }
+    int             GetLineCount() const    { return LineBreaksCount + 1; }
+    bool            HasSelection() const    { return Cursor != SelectStart; }
+
+    // [Internal]
+    IMGUI_API int   _FindChunk(int offset, int* out_offset_in_chunk) const;
+    IMGUI_API int   _GetChunkOffset(int chunk_n) const;
+    IMGUI_API void  _RebuildTrees();
+    IMGUI_API void  _ReplaceChunk(int chunk_n, const char* text, int text_len);
+};
+
+// Helper: Append-only text log with a line index and fast filtering, to display and filter millions of lines.
+// - Update() (called by Draw()) refreshes FilteredLines[] incrementally:
+//   - lines appended since last update are the only ones tested;
+//   - when the filter is a single search term extending the previous one (e.g. typing "err" then "erro"), only lines of the previous result are tested;
+//   - otherwise all lines are scanned, searching each chunk at once instead of line by line when the filter is a single search term.
+// - Text is stored in chunks of IMGUI_TEXTLOG_CHUNK_SIZE bytes (larger for longer lines), which never move once allocated,
+//   so appending never copies the existing log. Lines never straddle two chunks.
+// - Set UseTrigramIndex to maintain an index of which blocks of lines contain each 3-character sequence (case insensitive).
+//   A new search term of 3+ characters then only scans blocks that may contain it. Memory cost grows with the variety of text in each block.
+// - Call InitQueue() to allow other threads to log with QueueAppend()/QueueAppendf(): records are written into a lock-free ring buffer
+//   and moved into the log by Update() on the thread owning the log. When the ring is full, records are dropped rather than blocking.
+#ifndef IMGUI_TEXTLOG_CHUNK_SIZE
+#define IMGUI_TEXTLOG_CHUNK_SIZE    (128 * 1024)
+#endif
+struct ImGuiTextLogChunk
+{
+    char*                   Data;
+    int                     Size;                   // Bytes used
+    int                     Capacity;               // Multiple of IMGUI_TEXTLOG_CHUNK_SIZE
+    int                     Offset;                 // Offset of Data[0] in the log, see ImGuiTextLog::LineOffsets[]. Multiple of IMGUI_TEXTLOG_CHUNK_SIZE.
+};
+
+struct ImGuiTextLog
+{
+    ImVector<ImGuiTextLogChunk> Chunks;             // Text storage
+    ImVector<int>           ChunksBySlot;           // Offset / IMGUI_TEXTLOG_CHUNK_SIZE -> index in Chunks[]
+    ImVector<int>           LineOffsets;            // Offset of the start of each line (see ImGuiTextLogChunk::Offset). A trailing '\n' doesn't start a new line.
+    ImGuiTextFilter         Filter;
+    ImVector<int>           FilteredLines;          // Lines passing Filter, when Filter.IsActive()
+    int                     FilteredLinesScanned;   // Lines [0..FilteredLinesScanned) have been tested for FilteredFor. Last line is always tested again as it may be incomplete.
+    char                    FilteredFor[sizeof(ImGuiTextFilter::InputBuf)]; // Filter.InputBuf that FilteredLines[] corresponds to
+    int                     LastScanLinesCount;     // Number of lines tested by last filtering (for instrumentation)
+    bool                    AutoScroll;             // = true. Draw(): keep scrolling to the bottom when already at the bottom
+    bool                    UseTrigramIndex;        // = false
+    int                     TrigramBlockLines;      // = 256. Granularity of the trigram index. Set before appending lines.
+    int                     TrigramIndexedLines;    // Lines [0..TrigramIndexedLines) are indexed
+    ImVector<int>           TrigramHeads;           // 96*96*96 entries, trigram to index in TrigramBlocks[] or -1
+    ImVector<ImVector<int> > TrigramBlocks;         // Ascending list of blocks containing each trigram
+    ImGuiTextLogQueue*      Queue;                  // Multi-producer ring buffer, created by InitQueue()
+
+    IMGUI_API ImGuiTextLog();
+    IMGUI_API ~ImGuiTextLog();
+    ImGuiTextLog(const ImGuiTextLog&) = delete;
+    ImGuiTextLog& operator=(const ImGuiTextLog&) = delete;
+    IMGUI_API void          Clear();
+    IMGUI_API void          Append(const char* text, const char* text_end = NULL);
+    IMGUI_API void          Appendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API void          Update();                                               // Drain queue + refresh FilteredLines[] after Filter or contents changed
+    IMGUI_API void          Draw(const char* str_id, const ImVec2& size = ImVec2(0, 0));   // Filter input + scrolling child window, only submitting visible lines
+    int                     GetLineCount() const                { return LineOffsets.Size; }
+    const char*             GetLineBegin(int line_n) const      { const ImGuiTextLogChunk& c = Chunks.Data[ChunksBySlot.Data[LineOffsets[line_n] / IMGUI_TEXTLOG_CHUNK_SIZE]]; return c.Data + LineOffsets[line_n] - c.Offset; }
+    IMGUI_API const char*   GetLineEnd(int line_n) const;                           // Excluding '\n'. Lines are not zero-terminated: use GetLineBegin()..GetLineEnd().
+    int                     GetDisplayedLinesCount() const      { return Filter.IsActive() ? FilteredLines.Size : LineOffsets.Size; }
+    int                     GetDisplayedLine(int n) const       { return Filter.IsActive() ? FilteredLines[n] : n; }
+
+    // Thread-safe logging (InitQueue() and DrainQueue() must be called from the thread owning the log, QueueAppend() from any thread)
+    IMGUI_API void          InitQueue(int size_in_bytes = 4 * 1024 * 1024);         // Size is rounded up to a power of two. Records larger than half the size are dropped.
+    IMGUI_API bool          QueueAppend(const char* text, const char* text_end = NULL); // Return false if the record was dropped
+    IMGUI_API bool          QueueAppendf(const char* fmt, ...) IM_FMTARGS(2);
+    IMGUI_API int           DrainQueue();                                           // Move queued records into the log, return number of records. Called by Update().
+    IMGUI_API int           GetQueueDroppedCount() const;
+
+    // [Internal]
+    IMGUI_API void          _AddChunk(int min_capacity);
+    IMGUI_API bool          _IsLastLineComplete() const         { return Chunks.Size > 0 && Chunks.back().Size > 0 && Chunks.back().Data[Chunks.back().Size - 1] == '\n'; }
+    IMGUI_API void          _ScanLines(int line_begin, int line_end);
+    IMGUI_API void          _UpdateTrigramIndex();
+    IMGUI_API bool          _GetTrigramCandidateBlocks(ImVector<int>* out_blocks);
+};
+
 // [Internal] Key+Value for ImGuiStorage
 struct ImGuiStoragePair
 {
@@ -2621,6 +2763,15 @@ struct ImGuiStoragePair
     ImGuiStoragePair(ImGuiID _key, void* _val)  { key = _key; val_p = _val; }
 };
 
+#ifdef IMGUI_USE_HASHED_STORAGE
+// [Internal] Open-addressing slot for ImGuiStorage (when IMGUI_USE_HASHED_STORAGE is defined)
+struct ImGuiStorageSlot
+{
+    ImGuiID     key;
+    int         index;              // Index into ImGuiStorage::Data[], -1 when slot is empty
+};
+#endif
+
 // Helper: Key->Value storage
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
@@ -2629,15 +2780,24 @@ struct ImGuiStoragePair
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
 // Types are NOT stored, so it is up to you to make sure your Key don't collide with different types.
+// With '#define IMGUI_USE_HASHED_STORAGE' in imconfig.h, pairs are stored unsorted (in insertion order) and indexed by an
+// open-addressing hash table, making insertion O(1) instead of O(N). Useful when storing 100k+ keys. Data[] is only sorted after BuildSortByKey().
 struct ImGuiStorage
 {
     // [Internal]
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    ImVector<ImGuiStorageSlot>      Slots;          // Power-of-two sized, linear probing. Always rebuilt from Data[] so it may be discarded at any time.
+#endif
 
     // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); Slots.clear(); }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2657,7 +2817,9 @@ struct ImGuiStorage
     IMGUI_API void**    GetVoidPtrRef(ImGuiID key, void* default_val = NULL);
 
     // Advanced: for quicker full rebuild of a storage (instead of an incremental one), you may add all your contents and then sort once.
+    // (with IMGUI_USE_HASHED_STORAGE this also rebuilds the hash index, so it must be called after writing to Data[] directly)
     IMGUI_API void      BuildSortByKey();
+    IMGUI_API ImGuiStoragePair* GetPair(ImGuiID key);   // Find pair, NULL if missing. Never add/allocate.
     // Obsolete: use on your own storage if you know only integer are being stored (open/close all tree nodes)
     IMGUI_API void      SetAllInt(int val);
 
@@ -2695,6 +2857,7 @@ struct ImGuiListClipper
     float           ItemsHeight;        // [Internal] Height of item after a first step and item submission can calculate it
     float           StartPosY;          // [Internal] Cursor position at the time of Begin() or after table frozen rows are all processed
     double          StartSeekOffsetY;   // [Internal] Account for frozen rows in a table and initial loss of precision in very large windows.
+    ImGuiListClipperHeights* ItemsHeights; // [Internal] Heights of items when using Begin(ImGuiListClipperHeights*), otherwise NULL
     void*           TempData;           // [Internal] Internal data
 
     // items_count: Use INT_MAX if you don't know how many items you have (in which case the cursor won't be advanced in the final step, and you can call SeekCursorForItem() manually if you need)
@@ -2702,6 +2865,7 @@ struct ImGuiListClipper
     IMGUI_API ImGuiListClipper();
     IMGUI_API ~ImGuiListClipper();
     IMGUI_API void  Begin(int items_count, float items_height = -1.0f);
+    IMGUI_API void  Begin(ImGuiListClipperHeights* items_heights);   // Items of different heights: each Step() displays one item, which is measured and stored in 'items_heights'.
     IMGUI_API void  End();             // Automatically called on the last call of Step() that returns false.
     IMGUI_API bool  Step();            // Call until it returns false. The DisplayStart/DisplayEnd fields will be set and you can process/draw those items.
 
@@ -2722,6 +2886,134 @@ struct ImGuiListClipper
 #endif
 };
 
+// Helper: Heights of items for ImGuiListClipper, for lists whose items have different heights (e.g. wrapped messages, expanded tree nodes).
+// - Heights are summed in a Fenwick tree: converting between an item index and its position, and updating one height, cost O(log(items_count)).
+// - Items that were never displayed use EstimatedHeight. The clipper measures every item it displays and stores its height.
+//   When an item above the visible area changes height, the clipper adjusts scrolling so the visible items don't move.
+// - Heights include item spacing (distance between the top of an item and the top of the next one).
+// - Memory use is 8 bytes per item.
+// Usage:
+//   static ImGuiListClipperHeights heights;
+//   heights.Resize(items_count, ImGui::GetTextLineHeightWithSpacing());  // Existing items keep their heights
+//   ImGuiListClipper clipper;
+//   clipper.Begin(&heights);
+//   while (clipper.Step())
+//       for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+//           MySubmitItem(i);
+// Scroll to an item, when the list starts at the top of the window contents:
+//   ImGui::SetScrollY((float)heights.GetItemPos(item_n));
+struct ImGuiListClipperHeights
+{
+    int             ItemsCount;
+    float           EstimatedHeight;        // Height of items not measured yet
+
+    // [Internal]
+    ImVector<double> HeightsTree;           // Fenwick tree over item heights (1-based)
+
+    IMGUI_API ImGuiListClipperHeights();
+    IMGUI_API void      Resize(int items_count, float estimated_height);    // New items use 'estimated_height'. Items removed from the end are forgotten.
+    IMGUI_API void      SetItemHeight(int item_n, float height);
+    IMGUI_API float     GetItemHeight(int item_n) const;
+    IMGUI_API double    GetItemPos(int item_n) const;                       // Position of item relative to the first one == sum of heights of items [0..item_n)
+    IMGUI_API int       FindItemAtPos(double pos) const;                    // Item at given position relative to the first one, clamped to [0..ItemsCount-1]
+    double              GetTotalHeight() const  { return GetItemPos(ItemsCount); }
+    void                Clear()                 { ItemsCount = 0; HeightsTree.clear(); }
+};
+
+// Helper: Tree with a very large number of nodes (e.g. 1M+), displayed as a flat list of visible rows with ImGuiListClipper.
+// - Rows[] lists visible nodes (nodes whose ancestors are all open) in display order. It is updated incrementally:
+//   opening or closing a node only inserts or removes the rows of its visible descendants.
+// - Open state is stored in Nodes[], not in window storage: displaying nodes with TreeViewNode() doesn't add storage entries.
+// - Node indices are returned by AddNode() and don't change, use them to index your own data.
+// Usage:
+//   tree.UpdateRows();                                  // Apply nodes opened/closed since last frame
+//   ImGuiListClipper clipper;
+//   clipper.Begin(tree.Rows.Size);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           ImGui::TreeViewNode(&tree, row_n, MyGetNodeLabel(tree.Rows[row_n]));
+struct ImGuiTreeViewNode
+{
+    int             Parent;                 // -1 for root nodes
+    int             FirstChild;             // -1 when no children
+    int             LastChild;              // -1 when no children
+    int             NextSibling;            // -1 for last child
+    int             Depth;                  // 0 for root nodes
+    bool            Open;
+};
+
+struct ImGuiTreeView
+{
+    ImVector<ImGuiTreeViewNode> Nodes;      // All nodes, in order of creation
+    ImVector<int>   Rows;                   // Visible nodes in display order. Updated by UpdateRows().
+
+    // [Internal]
+    int             _FirstRoot;
+    int             _LastRoot;
+    bool            _RowsDirty;             // Nodes were added: rebuild all rows
+    ImVector<int>   _ToggledRows;           // Rows whose node was opened/closed since last UpdateRows()
+    ImVector<int>   _TempRows;
+
+    IMGUI_API ImGuiTreeView();
+    IMGUI_API void  Clear();
+    IMGUI_API int   AddNode(int parent = -1);               // Add node as last child of 'parent' (-1: add a root node). Return node index.
+    IMGUI_API void  SetNodeOpen(int node_n, bool open);     // Takes effect on next UpdateRows(). O(rows) when node is visible, as its row needs to be found.
+    IMGUI_API void  SetAllNodesOpen(bool open);             // Rows are rebuilt on next UpdateRows(). O(nodes)
+    bool            IsNodeOpen(int node_n) const            { return Nodes[node_n].Open; }
+    IMGUI_API int   FindNodeRow(int node_n) const;          // Row of node in Rows[], or -1 when not visible (one of its ancestors is closed). O(rows)
+    IMGUI_API void  UpdateRows();                           // Apply changes to Rows[]. Call before iterating Rows[], not while iterating them.
+};
+
+// Helper: Cached sort permutation for tables with a very large number of rows (e.g. 1M+).
+// Instead of sorting your dataset every time TableGetSortSpecs() reports dirty specs, keep one of those alongside your data.
+// - Your data is never moved: Indices[] maps a display row to an item index, use it to drive an ImGuiListClipper.
+// - Sorting is a stable merge sort. When the new specs end with (a prefix of) the specs used for the previous sort,
+//   e.g. when clicking a new column after a previous sort, we only sort on the new leading columns and keep the previous ordering for ties.
+// - When items are appended (items_count increases with same specs), only new items are sorted then merged in.
+// - Set ParallelForFunc to dispatch sorting jobs on your own worker pool. By default everything runs on the calling thread.
+// - Set ItemsPerUpdate to spread sorting over multiple Update() calls (e.g. one per frame) instead of blocking until done.
+//   Indices[] keeps the previous order meanwhile (appended items are listed unsorted at the end, all items are in index order
+//   after items were removed), IsSorting() returns true.
+//   Steps are then run on the calling thread. Changing specs or items count while sorting restarts the sort.
+// Usage:
+//   static ImGuiTableSortCache sort_cache;
+//   if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+//       sort_cache.Update(sort_specs, items_count, MyCompareFunc, &my_data);  // Clear sort_specs->SpecsDirty
+//   ImGuiListClipper clipper;
+//   clipper.Begin(sort_cache.Indices.Size);
+//   while (clipper.Step())
+//       for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+//           MySubmitRow(sort_cache.Indices[row_n]);
+struct ImGuiTableSortCache
+{
+    struct Step { int Offset, Mid, End, PieceBegin, PieceEnd; int SpecsCount; int Pass; int Kind; bool SrcIsTemp; }; // [Internal] A sorting job, see imgui_tables.cpp
+
+    ImVector<int>                       Indices;                // Sorted permutation: Indices[row_n] == item index
+    ImVector<ImGuiTableColumnSortSpecs> SortedBy;               // Specs Indices[] is currently sorted with
+    ImGuiParallelForFunc                ParallelForFunc;        // Optional: run sorting jobs on a worker pool
+    void*                               ParallelForUserData;
+    int                                 ItemsPerJob;            // = 64*1024. Items sorted or merged by each sorting job (min 1024).
+    int                                 ItemsPerUpdate;         // = 0. When > 0, Update() stops sorting after processing about this many items (at least one job of ItemsPerJob items) and continues on next call.
+    int                                 SortCount;              // Number of sorts completed (for instrumentation)
+
+    // [Internal]
+    ImVector<int>                       _Pending;               // Permutation being sorted when ItemsPerUpdate > 0
+    ImVector<ImGuiTableColumnSortSpecs> _PendingSpecs;          // Specs of the sort in progress
+    ImVector<int>                       _Temp;
+    ImVector<Step>                      _Steps;                 // Jobs of the sort in progress
+    int                                 _SortedCount;           // Indices[0.._SortedCount) is sorted by SortedBy[]
+    int                                 _StepsDone;
+    bool                                _Sorting;
+    bool                                _Dirty;
+
+    IMGUI_API ImGuiTableSortCache();
+    IMGUI_API bool  Update(ImGuiTableSortSpecs* sort_specs, int items_count, ImGuiTableSortCompareFunc compare_func, void* user_data); // Return true if Indices[] changed
+    IMGUI_API void  Clear();
+    void            SetDirty()          { _Dirty = true; }      // Force a full sort on next Update(), e.g. when contents of existing items changed.
+    bool            IsSorting() const   { return _Sorting; }    // A sort was started and is not finished (only when ItemsPerUpdate > 0)
+    float           GetSortProgress() const { return _Steps.Size > 0 ? (float)_StepsDone / _Steps.Size : 1.0f; }
+};
+
 // Helpers: ImVec2/ImVec4 operators
 // - It is important that we are keeping those disabled by default so they don't leak in user space.
 // - This is in order to allow user enabling implicit cast operators between ImVec2/ImVec4 and their own types (using IM_VEC2_CLASS_EXTRA in imconfig.h)
@@ -2798,7 +3090,7 @@ struct ImColor
 };
 
 //-----------------------------------------------------------------------------
-// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage)
+// [SECTION] Multi-Select API flags and structures (ImGuiMultiSelectFlags, ImGuiSelectionRequestType, ImGuiSelectionRequest, ImGuiMultiSelectIO, ImGuiSelectionBasicStorage, ImGuiSelectionRangeStorage)
 //-----------------------------------------------------------------------------
 
 // Multi-selection system
@@ -2945,6 +3237,31 @@ struct ImGuiSelectionExternalStorage
     IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests by using AdapterSetItemSelected() calls
 };
 
+// Optional helper to store a multi-selection of item indices, for very large lists (e.g. 1M+ items).
+// - Selection is stored as sorted ranges of selected indices. When ranges get fragmented (e.g. many Ctrl+Click) and
+//   would use more memory than one bit per item, it switches to a bit array until the next Clear() or SetAll request.
+// - SetAll requests (Ctrl+A, Escape, clicking an item) are O(1). SetRange requests are O(log(ranges) + ranges overwritten),
+//   or O(range size / 32) with the bit array. Contains() is O(log(ranges)), or O(1) with the bit array.
+// - Unlike ImGuiSelectionBasicStorage, this stores indices and not IDs: selection doesn't follow items if they are reordered, inserted or deleted.
+// - Iterate selection in increasing index order with 'void* it = NULL; int idx; while (selection.GetNextSelectedItem(&it, &idx)) { ... }'
+struct ImGuiSelectionRangeStorage
+{
+    // Members
+    int             Size;           // Number of selected items, maintained by this helper.
+    ImVector<int>   _Ranges;        // [Internal] Sorted indices where selection state flips: items [_Ranges[0].._Ranges[1]), [_Ranges[2].._Ranges[3])... are selected.
+    ImVector<ImU32> _Bits;          // [Internal] One bit per item, used instead of _Ranges when not empty.
+
+    // Methods
+    IMGUI_API ImGuiSelectionRangeStorage();
+    IMGUI_API void  ApplyRequests(ImGuiMultiSelectIO* ms_io);   // Apply selection requests coming from BeginMultiSelect() and EndMultiSelect() functions. It uses 'items_count' passed to BeginMultiSelect()
+    IMGUI_API bool  Contains(int idx) const;                    // Query if an item index is in selection.
+    IMGUI_API void  Clear();                                    // Clear selection
+    IMGUI_API void  Swap(ImGuiSelectionRangeStorage& r);        // Swap two selections
+    IMGUI_API void  SetRangeSelected(int idx_first, int idx_last, bool selected);  // Add/remove items [idx_first..idx_last] (inclusive) from selection
+    void            SetItemSelected(int idx, bool selected)     { SetRangeSelected(idx, idx, selected); }
+    IMGUI_API bool  GetNextSelectedItem(void** opaque_it, int* out_idx); // Iterate selection with 'void* it = NULL; int idx; while (selection.GetNextSelectedItem(&it, &idx)) { ... }'
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Drawing API (ImDrawCmd, ImDrawIdx, ImDrawVert, ImDrawChannel, ImDrawListSplitter, ImDrawListFlags, ImDrawList, ImDrawData)
 // Hold a series of drawing commands. The user provides a renderer for ImDrawData which essentially contains an array of ImDrawList.
@@ -2983,6 +3300,8 @@ typedef void (*ImDrawCallback)(const ImDrawList* parent_list, const ImDrawCmd* c
 // - VtxOffset: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset' is enabled,
 //   this fields allow us to render meshes larger than 64K vertices while keeping 16-bit indices.
 //   Backends made for <1.71. will typically ignore the VtxOffset fields.
+// - GlyphOffset/GlyphCount: When 'io.BackendFlags & ImGuiBackendFlags_RendererHasGlyphInstances' is enabled, text may be output
+//   as glyph instances in ImDrawList::GlyphBuffer[]. A command draws its ElemCount indices first, then its GlyphCount glyphs.
 // - The ClipRect/TextureId/VtxOffset fields must be contiguous as we memcmp() them together (this is asserted for).
 struct ImDrawCmd
 {
@@ -2991,6 +3310,8 @@ struct ImDrawCmd
     unsigned int    VtxOffset;          // 4    // Start offset in vertex buffer. ImGuiBackendFlags_RendererHasVtxOffset: always 0, otherwise may be >0 to support meshes larger than 64K vertices with 16-bit indices.
     unsigned int    IdxOffset;          // 4    // Start offset in index buffer.
     unsigned int    ElemCount;          // 4    // Number of indices (multiple of 3) to be rendered as triangles. Vertices are stored in the callee ImDrawList's vtx_buffer[] array, indices in idx_buffer[].
+    unsigned int    GlyphOffset;        // 4    // Start offset in glyph buffer.
+    unsigned int    GlyphCount;         // 4    // Number of glyph instances to be rendered after the triangles. ImGuiBackendFlags_RendererHasGlyphInstances: may be >0, otherwise always 0.
     ImDrawCallback  UserCallback;       // 4-8  // If != NULL, call the function instead of rendering the vertices. clip_rect and texture_id will be set normally.
     void*           UserCallbackData;   // 4-8  // Callback user data (when UserCallback != NULL). If called AddCallback() with size == 0, this is a copy of the AddCallback() argument. If called AddCallback() with size > 0, this is pointing to a buffer where data is stored.
     int             UserCallbackDataSize;  // 4 // Size of callback user data when using storage, otherwise 0.
@@ -3003,13 +3324,46 @@ struct ImDrawCmd
 };
 
 // Vertex layout
-#ifndef IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT
+#if !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT) && !defined(IMGUI_USE_COMPACT_DRAWVERT)
 struct ImDrawVert
 {
     ImVec2  pos;
     ImVec2  uv;
     ImU32   col;
 };
+#elif !defined(IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT)
+// Compact vertex layout enabled with IMGUI_USE_COMPACT_DRAWVERT in imconfig.h (12 bytes instead of 20)
+// - pos: 16-bit signed fixed point with IM_DRAWVERT_POS_SCALE steps per pixel. Range is +/-8191 pixels with the default scale of 4, positions beyond are clamped.
+// - uv: 16-bit unsigned normalized. Range is [0,1], so textures can't be repeated by using larger UV.
+// Components convert from/to float, so code writing ImVec2 or individual x/y to vertices is unchanged. The renderer backend needs to setup matching vertex attributes.
+#ifndef IM_DRAWVERT_POS_SCALE
+#define IM_DRAWVERT_POS_SCALE   4
+#endif
+struct ImDrawVertPosComponent
+{
+    ImS16   v;
+    ImDrawVertPosComponent& operator=(float f) { f = f * IM_DRAWVERT_POS_SCALE + 32768.5f; v = (ImS16)((int)(f < 0.0f ? 0.0f : f > 65535.0f ? 65535.0f : f) - 32768); return *this; }
+    operator float() const                     { return (float)v * (1.0f / IM_DRAWVERT_POS_SCALE); }
+};
+struct ImDrawVertUVComponent
+{
+    ImU16   v;
+    ImDrawVertUVComponent& operator=(float f)  { v = (ImU16)((f < 0.0f ? 0.0f : f > 1.0f ? 1.0f : f) * 65535.0f + 0.5f); return *this; }
+    operator float() const                     { return (float)v * (1.0f / 65535.0f); }
+};
+template<typename T>
+struct ImDrawVertVec2
+{
+    T       x, y;
+    ImDrawVertVec2& operator=(const ImVec2& p) { x = p.x; y = p.y; return *this; }
+    operator ImVec2() const                    { return ImVec2(x, y); }
+};
+struct ImDrawVert
+{
+    ImDrawVertVec2<ImDrawVertPosComponent>  pos;
+    ImDrawVertVec2<ImDrawVertUVComponent>   uv;
+    ImU32                                   col;
+};
 #else
 // You can override the vertex format layout by defining IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT in imconfig.h
 // The code expect ImVec2 pos (8 bytes), ImVec2 uv (8 bytes), ImU32 col (4 bytes), but you can re-order them or add other fields as needed to simplify integration in your engine.
@@ -3018,6 +3372,18 @@ struct ImDrawVert
 IMGUI_OVERRIDE_DRAWVERT_STRUCT_LAYOUT;
 #endif
 
+// Glyph instance (16 bytes), output by ImDrawList::AddText() instead of 4 vertices + 6 indices (92 bytes with default layout)
+// when ImDrawListFlags_GlyphInstances is set. The glyph is drawn at Pos like a textured quad with the font atlas texture:
+// - GlyphIndex is the index of the glyph in the font atlas glyph table, see ImFontAtlas::GetGlyphTableEntry().
+// - Rectangle is (Pos.x + X0, Pos.y + Y0) -> (Pos.x + X1, Pos.y + Y1), UV are (U0, V0) -> (U1, V1) of the table entry.
+// Use ImDrawList::ExpandGlyphsTo() to convert glyphs to vertices for renderers that don't support them.
+struct ImDrawGlyph
+{
+    ImVec2  Pos;
+    ImU32   Col;
+    ImU32   GlyphIndex;
+};
+
 // [Internal] For use by ImDrawList
 struct ImDrawCmdHeader
 {
@@ -3031,6 +3397,7 @@ struct ImDrawChannel
 {
     ImVector<ImDrawCmd>         _CmdBuffer;
     ImVector<ImDrawIdx>         _IdxBuffer;
+    ImVector<ImDrawGlyph>       _GlyphBuffer;
 };
 
 // Split/Merge functions are used to split the draw list into different layers which can be drawn into out of order.
@@ -3079,6 +3446,8 @@ enum ImDrawListFlags_
     ImDrawListFlags_AntiAliasedLinesUseTex  = 1 << 1,  // Enable anti-aliased lines/borders using textures when possible. Require backend to render with bilinear filtering (NOT point/nearest filtering).
     ImDrawListFlags_AntiAliasedFill         = 1 << 2,  // Enable anti-aliased edge around filled shapes (rounded rectangles, circles).
     ImDrawListFlags_AllowVtxOffset          = 1 << 3,  // Can emit 'VtxOffset > 0' to allow large meshes. Set when 'ImGuiBackendFlags_RendererHasVtxOffset' is enabled.
+    ImDrawListFlags_CachedRender            = 1 << 4,  // Renderer may draw this list from a cached texture. Set on windows using ImGuiWindowFlags_CachedRender when not interacted with.
+    ImDrawListFlags_GlyphInstances          = 1 << 5,  // Can output text as ImDrawGlyph in GlyphBuffer[]. Set when 'ImGuiBackendFlags_RendererHasGlyphInstances' is enabled.
 };
 
 // Draw command list
@@ -3096,6 +3465,7 @@ struct ImDrawList
     ImVector<ImDrawCmd>     CmdBuffer;          // Draw commands. Typically 1 command = 1 GPU draw call, unless the command is a callback.
     ImVector<ImDrawIdx>     IdxBuffer;          // Index buffer. Each command consume ImDrawCmd::ElemCount of those
     ImVector<ImDrawVert>    VtxBuffer;          // Vertex buffer.
+    ImVector<ImDrawGlyph>   GlyphBuffer;        // Glyph buffer. Each command consume ImDrawCmd::GlyphCount of those. Empty unless ImDrawListFlags_GlyphInstances is set.
     ImDrawListFlags         Flags;              // Flags, you may poke into these to adjust anti-aliasing settings per-primitive.
 
     // [Internal, used while building lists]
@@ -3196,6 +3566,7 @@ struct ImDrawList
     // Advanced: Miscellaneous
     IMGUI_API void  AddDrawCmd();                                               // This is useful if you need to forcefully create a new draw call (to allow for dependent rendering / blending). Otherwise primitives are merged into the same draw-call as much as possible
     IMGUI_API ImDrawList* CloneOutput() const;                                  // Create a clone of the CmdBuffer/IdxBuffer/VtxBuffer.
+    IMGUI_API void  ExpandGlyphsTo(ImDrawList* dst) const;                      // Copy output to 'dst' with GlyphBuffer[] converted to vertices and indices, for renderers without ImGuiBackendFlags_RendererHasGlyphInstances.
 
     // Advanced: Channels
     // - Use to split render into layers. By switching channels to can render out-of-order (e.g. submit FG primitives before BG primitives)
@@ -3428,6 +3799,7 @@ struct ImFontAtlas
 
     // [Internal]
     IMGUI_API void              CalcCustomRectUV(const ImFontAtlasCustomRect* rect, ImVec2* out_uv_min, ImVec2* out_uv_max) const;
+    IMGUI_API const ImFontGlyph* GetGlyphTableEntry(int glyph_index) const;  // Glyph referenced by ImDrawGlyph::GlyphIndex, in [0, GlyphTableSize)
 
     //-------------------------------------------
     // Members
@@ -3455,6 +3827,7 @@ struct ImFontAtlas
     ImVector<ImFontAtlasCustomRect> CustomRects;    // Rectangles for packing custom texture data into the atlas.
     ImVector<ImFontConfig>      Sources;            // Source/configuration data
     ImVec4                      TexUvLines[IM_DRAWLIST_TEX_LINES_WIDTH_MAX + 1];  // UVs for baked anti-aliased lines
+    int                         GlyphTableSize;     // Number of glyphs of all fonts, set during Build(). Glyphs of each font are indexed from ImFont::GlyphTableOffset.
 
     // [Internal] Font builder
     const ImFontBuilderIO*      FontBuilderIO;      // Opaque interface to a font builder (default to stb_truetype, can be changed to use FreeType by defining IMGUI_ENABLE_FREETYPE).
@@ -3496,6 +3869,7 @@ struct ImFont
     float                       Scale;              // 4     // in  // Base font scale (1.0f), multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize] (unscaled)
     int                         MetricsTotalSurface;// 4     // out // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    int                         GlyphTableOffset;   // 4     // out // Index of Glyphs[0] in the atlas glyph table (see ImDrawGlyph), -1 when glyphs were added after building the atlas
     bool                        DirtyLookupTables;  // 1     // out //
     ImU8                        Used8kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/8192/8]; // 1 bytes if ImWchar=ImWchar16, 16 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
 
@@ -0,0 +1,362 @@
+// dear imgui: pooled allocator with telemetry, to install with ImGui::SetAllocatorFunctions()
+// See imgui_allocator.h for details.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_allocator.h"
+#include "imgui_internal.h"     // ImGui::DebugGetAllocCallSite()
+#include <stdio.h>              // snprintf
+
+// Block sizes for each size class, including block header
+static const size_t GSizeClassBlockSizes[ImGuiPoolAllocator::SizeClassCount] = { 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 2048 };
+static const ImU32  LARGE_BLOCK = 0xFFFFFFFF;
+
+// Header preceding each block returned by Alloc(). 16 bytes to keep blocks 16-byte aligned.
+struct ImGuiPoolAllocatorBlock
+{
+    ImU32   SizeClass;          // Index in GSizeClassBlockSizes[], or LARGE_BLOCK
+    ImU32   CallSiteIdx;        // Index in CallSites[]
+    ImU64   Size;               // Requested size
+};
+IM_STATIC_ASSERT(sizeof(ImGuiPoolAllocatorBlock) == 16);
+static const size_t ARENA_HEADER_SIZE = 16;     // Header of pages and frame arena blocks: pointer to next one
+
+static void* PoolAllocatorAllocFunc(size_t size, void* user_data)  { return ((ImGuiPoolAllocator*)user_data)->Alloc(size); }
+static void  PoolAllocatorFreeFunc(void* ptr, void* user_data)     { ((ImGuiPoolAllocator*)user_data)->Free(ptr); }
+
+static int PoolAllocatorFindSizeClass(size_t block_size)
+{
+    for (int n = 0; n < ImGuiPoolAllocator::SizeClassCount; n++)
+        if (block_size <= GSizeClassBlockSizes[n])
+            return n;
+    return -1;
+}
+
+struct ImGuiPoolAllocatorScopedLock
+{
+    std::atomic_flag& Lock;
+    ImGuiPoolAllocatorScopedLock(std::atomic_flag& lock) : Lock(lock) { while (Lock.test_and_set(std::memory_order_acquire)) {} }
+    ~ImGuiPoolAllocatorScopedLock()                                   { Lock.clear(std::memory_order_release); }
+};
+
+ImGuiPoolAllocator::ImGuiPoolAllocator()
+{
+    AssertNoAllocations = false;
+    TotalAllocCount = TotalFreeCount = 0;
+    BytesInUse = BytesInUseMax = PoolBytesReserved = 0;
+    LargeAllocCount = 0;
+    FramesWithoutAlloc = 0;
+    memset(&FrameStats, 0, sizeof(FrameStats));
+    memset(FrameHistory, 0, sizeof(FrameHistory));
+    FrameHistoryIdx = 0;
+    FrameCount = 0;
+    FrameArenaBytesUsed = FrameArenaBytesMax = 0;
+    memset(CallSites, 0, sizeof(CallSites));
+    CallSitesCount = 1; // Slot 0 for unknown call site
+    memset(FreeLists, 0, sizeof(FreeLists));
+    FrameArenaBlocks = NULL;
+    FrameArenaBlockSize = FrameArenaBlockUsed = 0;
+    Lock.clear();
+    PrevAllocFunc = NULL;
+    PrevFreeFunc = NULL;
+    PrevUserData = NULL;
+    Pages = NULL;
+    Installed = false;
+}
+
+ImGuiPoolAllocator::~ImGuiPoolAllocator()
+{
+    if (Installed)
+        Uninstall();
+    while (Pages != NULL)
+    {
+        void* next = *(void**)Pages;
+        free(Pages);
+        Pages = next;
+    }
+    while (FrameArenaBlocks != NULL)
+    {
+        char* next = *(char**)FrameArenaBlocks;
+        free(FrameArenaBlocks);
+        FrameArenaBlocks = next;
+    }
+}
+
+void ImGuiPoolAllocator::Install()
+{
+    IM_ASSERT(!Installed);
+    IM_ASSERT(ImGui::GetCurrentContext() == NULL && "Install before creating any context, as blocks allocated by other allocator functions can't be freed by this one!");
+    ImGui::GetAllocatorFunctions(&PrevAllocFunc, &PrevFreeFunc, &PrevUserData);
+    ImGui::SetAllocatorFunctions(PoolAllocatorAllocFunc, PoolAllocatorFreeFunc, this);
+    Installed = true;
+}
+
+void ImGuiPoolAllocator::Uninstall()
+{
+    IM_ASSERT(Installed);
+    ImGui::SetAllocatorFunctions(PrevAllocFunc, PrevFreeFunc, PrevUserData);
+    Installed = false;
+}
+
+// Find or add call site. Slot 0 is used for unknown call site and when the table is full.
+static ImU32 PoolAllocatorFindCallSite(ImGuiPoolAllocator* allocator, const void* address)
+{
+    if (address == NULL)
+        return 0;
+    const ImU32 mask = ImGuiPoolAllocator::CallSitesMax - 1;
+    ImU32 idx = (ImU32)(((ImU64)(intptr_t)address * 0x9E3779B97F4A7C15ULL) >> 32) & mask;
+    for (int probe = 0; probe < ImGuiPoolAllocator::CallSitesMax; probe++, idx = (idx + 1) & mask)
+    {
+        if (idx == 0)
+            continue;
+        ImGuiPoolAllocatorCallSite* site = &allocator->CallSites[idx];
+        if (site->Address == address)
+            return idx;
+        if (site->Address == NULL)
+        {
+            if (allocator->CallSitesCount >= ImGuiPoolAllocator::CallSitesMax * 3 / 4)
+                return 0;
+            site->Address = address;
+            allocator->CallSitesCount++;
+            return idx;
+        }
+    }
+    return 0;
+}
+
+void* ImGuiPoolAllocator::Alloc(size_t size)
+{
+    IM_ASSERT(!AssertNoAllocations && "Allocation in a frame expected to be allocation-free. Break here to see where it comes from.");
+    const void* call_site = NULL;
+#ifdef IMGUI_DEBUG_ALLOC_CALL_SITES
+    call_site = ImGui::DebugGetAllocCallSite();
+#endif
+    const size_t block_size = size + sizeof(ImGuiPoolAllocatorBlock);
+    const int size_class = PoolAllocatorFindSizeClass(block_size);
+
+    ImGuiPoolAllocatorScopedLock lock(Lock);
+    ImGuiPoolAllocatorBlock* block;
+    if (size_class >= 0)
+    {
+        if (FreeLists[size_class] == NULL)
+        {
+            // Carve a new page into blocks
+            char* page = (char*)malloc(ARENA_HEADER_SIZE + PageSize);
+            if (page == NULL)
+                return NULL;
+            *(void**)page = Pages;
+            Pages = page;
+            PoolBytesReserved += PageSize;
+            const size_t class_block_size = GSizeClassBlockSizes[size_class];
+            for (size_t offset = 0; offset + class_block_size <= PageSize; offset += class_block_size)
+            {
+                void* free_block = page + ARENA_HEADER_SIZE + offset;
+                *(void**)free_block = FreeLists[size_class];
+                FreeLists[size_class] = free_block;
+            }
+        }
+        block = (ImGuiPoolAllocatorBlock*)FreeLists[size_class];
+        FreeLists[size_class] = *(void**)block;
+        block->SizeClass = (ImU32)size_class;
+    }
+    else
+    {
+        block = (ImGuiPoolAllocatorBlock*)malloc(block_size);
+        if (block == NULL)
+            return NULL;
+        block->SizeClass = LARGE_BLOCK;
+        LargeAllocCount++;
+    }
+    block->Size = size;
+    block->CallSiteIdx = PoolAllocatorFindCallSite(this, call_site);
+
+    ImGuiPoolAllocatorCallSite* site = &CallSites[block->CallSiteIdx];
+    site->BlocksInUse++;
+    site->BytesInUse += size;
+    site->BytesInUseMax = ImMax(site->BytesInUseMax, site->BytesInUse);
+    TotalAllocCount++;
+    BytesInUse += size;
+    BytesInUseMax = ImMax(BytesInUseMax, BytesInUse);
+    FrameStats.AllocCount++;
+    FrameStats.AllocBytes += size;
+    return block + 1;
+}
+
+void ImGuiPoolAllocator::Free(void* ptr)
+{
+    if (ptr == NULL)
+        return;
+    ImGuiPoolAllocatorBlock* block = (ImGuiPoolAllocatorBlock*)ptr - 1;
+    ImGuiPoolAllocatorScopedLock lock(Lock);
+    ImGuiPoolAllocatorCallSite* site = &CallSites[block->CallSiteIdx];
+    site->BlocksInUse--;
+    site->BytesInUse -= (size_t)block->Size;
+    TotalFreeCount++;
+    BytesInUse -= (size_t)block->Size;
+    FrameStats.FreeCount++;
+    if (block->SizeClass == LARGE_BLOCK)
+    {
+        free(block);
+        return;
+    }
+    const ImU32 size_class = block->SizeClass; // Read before the free list link overwrites the header
+    IM_ASSERT(size_class < SizeClassCount);
+    *(void**)block = FreeLists[size_class];
+    FreeLists[size_class] = block;
+}
+
+void* ImGuiPoolAllocator::FrameAlloc(size_t size)
+{
+    size = (size + 15) & ~(size_t)15;
+    ImGuiPoolAllocatorScopedLock lock(Lock);
+    if (FrameArenaBlocks == NULL || FrameArenaBlockUsed + size > FrameArenaBlockSize)
+    {
+        const size_t new_block_size = ImMax(ImMax(FrameArenaBlockSize * 2, (size_t)256 * 1024), size);
+        char* new_block = (char*)malloc(ARENA_HEADER_SIZE + new_block_size);
+        if (new_block == NULL)
+            return NULL;
+        *(char**)new_block = FrameArenaBlocks;
+        FrameArenaBlocks = new_block;
+        FrameArenaBlockSize = new_block_size;
+        FrameArenaBlockUsed = 0;
+    }
+    void* ptr = FrameArenaBlocks + ARENA_HEADER_SIZE + FrameArenaBlockUsed;
+    FrameArenaBlockUsed += size;
+    FrameArenaBytesUsed += size;
+    return ptr;
+}
+
+void ImGuiPoolAllocator::NewFrame()
+{
+    ImGuiPoolAllocatorScopedLock lock(Lock);
+    FramesWithoutAlloc = (FrameCount > 0 && FrameStats.AllocCount == 0) ? FramesWithoutAlloc + 1 : 0;
+    FrameHistory[FrameHistoryIdx] = FrameStats;
+    FrameHistoryIdx = (FrameHistoryIdx + 1) % FrameHistorySize;
+    memset(&FrameStats, 0, sizeof(FrameStats));
+    FrameCount++;
+
+    // Reset frame arena. When last frame needed more than one block, keep only the newest (largest) one so next frames don't need to chain blocks.
+    FrameArenaBytesMax = ImMax(FrameArenaBytesMax, FrameArenaBytesUsed);
+    if (FrameArenaBlocks != NULL)
+    {
+        char* older_blocks = *(char**)FrameArenaBlocks;
+        *(char**)FrameArenaBlocks = NULL;
+        while (older_blocks != NULL)
+        {
+            char* next = *(char**)older_blocks;
+            free(older_blocks);
+            older_blocks = next;
+        }
+    }
+    FrameArenaBlockUsed = 0;
+    FrameArenaBytesUsed = 0;
+}
+
+static void PoolAllocatorFormatBytes(char* buf, size_t buf_size, size_t bytes)
+{
+    if (bytes < 1024)
+        snprintf(buf, buf_size, "%d B", (int)bytes);
+    else if (bytes < 1024 * 1024)
+        snprintf(buf, buf_size, "%.1f KB", bytes / 1024.0);
+    else
+        snprintf(buf, buf_size, "%.2f MB", bytes / (1024.0 * 1024.0));
+}
+
+static float PoolAllocatorGetFrameAllocCount(void* data, int idx)
+{
+    const ImGuiPoolAllocator* allocator = (const ImGuiPoolAllocator*)data;
+    return (float)allocator->FrameHistory[(allocator->FrameHistoryIdx + idx) % ImGuiPoolAllocator::FrameHistorySize].AllocCount;
+}
+
+void ImGuiPoolAllocator::ShowStats()
+{
+    // Copy what we need while holding the lock, as displaying may allocate
+    const int TOP_SITES_COUNT = 16;
+    ImGuiPoolAllocatorCallSite top_sites[TOP_SITES_COUNT];
+    int top_sites_count = 0;
+    ImGuiPoolAllocatorFrameStats last_frame;
+    int total_alloc_count, total_free_count, large_alloc_count, frames_without_alloc, call_sites_count;
+    size_t bytes_in_use, bytes_in_use_max, pool_bytes_reserved, frame_arena_bytes_max;
+    {
+        ImGuiPoolAllocatorScopedLock lock(Lock);
+        last_frame = FrameHistory[(FrameHistoryIdx + FrameHistorySize - 1) % FrameHistorySize];
+        total_alloc_count = TotalAllocCount;
+        total_free_count = TotalFreeCount;
+        large_alloc_count = LargeAllocCount;
+        frames_without_alloc = FramesWithoutAlloc;
+        call_sites_count = CallSitesCount;
+        bytes_in_use = BytesInUse;
+        bytes_in_use_max = BytesInUseMax;
+        pool_bytes_reserved = PoolBytesReserved;
+        frame_arena_bytes_max = FrameArenaBytesMax;
+
+        // Keep call sites with largest high-water marks, sorted by decreasing high-water mark
+        for (int n = 0; n < CallSitesMax; n++)
+        {
+            const ImGuiPoolAllocatorCallSite& site = CallSites[n];
+            if (site.BytesInUseMax == 0)
+                continue;
+            int insert_n = top_sites_count;
+            while (insert_n > 0 && top_sites[insert_n - 1].BytesInUseMax < site.BytesInUseMax)
+                insert_n--;
+            if (insert_n >= TOP_SITES_COUNT)
+                continue;
+            top_sites_count = ImMin(top_sites_count + 1, TOP_SITES_COUNT);
+            for (int move_n = top_sites_count - 1; move_n > insert_n; move_n--)
+                top_sites[move_n] = top_sites[move_n - 1];
+            top_sites[insert_n] = site;
+        }
+    }
+
+    char buf_a[32], buf_b[32], buf_c[32];
+    PoolAllocatorFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), bytes_in_use);
+    PoolAllocatorFormatBytes(buf_b, IM_ARRAYSIZE(buf_b), bytes_in_use_max);
+    PoolAllocatorFormatBytes(buf_c, IM_ARRAYSIZE(buf_c), pool_bytes_reserved);
+    ImGui::Text("In use: %s in %d blocks, peak %s", buf_a, total_alloc_count - total_free_count, buf_b);
+    ImGui::Text("Pools: %s reserved. Large blocks: %d allocated", buf_c, large_alloc_count);
+    PoolAllocatorFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), last_frame.AllocBytes);
+    ImGui::Text("Last frame: %d allocs (%s), %d frees", last_frame.AllocCount, buf_a, last_frame.FreeCount);
+    ImGui::Text("Frames without allocation: %d", frames_without_alloc);
+    PoolAllocatorFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), frame_arena_bytes_max);
+    ImGui::Text("Frame arena: peak %s", buf_a);
+    ImGui::PlotHistogram("##AllocsPerFrame", PoolAllocatorGetFrameAllocCount, this, FrameHistorySize, 0, "Allocs/frame", 0.0f, FLT_MAX, ImVec2(0, 40.0f));
+
+    char label[64];
+    snprintf(label, IM_ARRAYSIZE(label), "Call sites (%d)###CallSites", call_sites_count - 1);
+    if (ImGui::TreeNode(label))
+    {
+#ifndef IMGUI_DEBUG_ALLOC_CALL_SITES
+        ImGui::TextDisabled("Define IMGUI_DEBUG_ALLOC_CALL_SITES in imconfig.h to record call sites.");
+#endif
+        if (ImGui::BeginTable("##CallSites", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit))
+        {
+            ImGui::TableSetupColumn("Call site");
+            ImGui::TableSetupColumn("Blocks");
+            ImGui::TableSetupColumn("In use");
+            ImGui::TableSetupColumn("Peak");
+            ImGui::TableHeadersRow();
+            for (int n = 0; n < top_sites_count; n++)
+            {
+                const ImGuiPoolAllocatorCallSite& site = top_sites[n];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                if (site.Address != NULL)
+                    ImGui::Text("%p", site.Address);
+                else
+                    ImGui::TextUnformatted("(unknown)");
+                ImGui::TableNextColumn();
+                ImGui::Text("%d", site.BlocksInUse);
+                ImGui::TableNextColumn();
+                PoolAllocatorFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), site.BytesInUse);
+                ImGui::TextUnformatted(buf_a);
+                ImGui::TableNextColumn();
+                PoolAllocatorFormatBytes(buf_a, IM_ARRAYSIZE(buf_a), site.BytesInUseMax);
+                ImGui::TextUnformatted(buf_a);
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
+}
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,86 @@
+// dear imgui: pooled allocator with telemetry, to install with ImGui::SetAllocatorFunctions()
+// - Small blocks (up to 2 KB) come from size-class pools carved out of 64 KB pages. Freed blocks go back to their pool, pages are kept until the allocator is destroyed.
+// - Larger blocks go to malloc()/free().
+// - FrameAlloc() returns transient memory from a bump arena which is reset by NewFrame(). Dear ImGui's own allocations never go there:
+//   MemAlloc() can't tell how long a block will live, and most of them are ImVector<> buffers kept across frames.
+// - Telemetry: allocations and bytes per frame, bytes in use and high-water mark, and the same per call site when IMGUI_DEBUG_ALLOC_CALL_SITES is defined in imconfig.h.
+// - Tests can set AssertNoAllocations after warm-up frames, to assert on any allocation in steady-state frames.
+// - All functions are thread-safe, as the allocator functions are shared by all contexts.
+
+// Usage:
+//   static ImGuiPoolAllocator allocator;   // Must outlive all Dear ImGui contexts
+//   allocator.Install();                   // Before ImGui::CreateContext()
+//   [...]
+//   allocator.NewFrame();                  // Once per frame, before ImGui::NewFrame()
+//   allocator.ShowStats();                 // Optional: display stats, within a window
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+#include <atomic>       // std::atomic_flag
+
+struct ImGuiPoolAllocatorCallSite
+{
+    const void*     Address;                // Return address of MemAlloc() caller, NULL when unknown
+    int             BlocksInUse;
+    size_t          BytesInUse;
+    size_t          BytesInUseMax;          // High-water mark
+};
+
+struct ImGuiPoolAllocatorFrameStats
+{
+    int             AllocCount;
+    int             FreeCount;
+    size_t          AllocBytes;
+};
+
+struct ImGuiPoolAllocator
+{
+    enum { SizeClassCount = 12, PageSize = 64 * 1024, FrameHistorySize = 120, CallSitesMax = 1024 };
+
+    // Configuration
+    bool            AssertNoAllocations;    // = false // Assert on any allocation (not FrameAlloc()). Set after warm-up frames to check that steady-state frames don't allocate.
+
+    // Telemetry (read-only)
+    int             TotalAllocCount;
+    int             TotalFreeCount;
+    size_t          BytesInUse;
+    size_t          BytesInUseMax;
+    size_t          PoolBytesReserved;      // Total size of pages
+    int             LargeAllocCount;        // Allocations which went to malloc()
+    int             FramesWithoutAlloc;     // Number of consecutive previous frames without any allocation
+    ImGuiPoolAllocatorFrameStats FrameStats;                            // Current frame
+    ImGuiPoolAllocatorFrameStats FrameHistory[FrameHistorySize];        // Previous frames, circular buffer
+    int             FrameHistoryIdx;
+    int             FrameCount;
+    size_t          FrameArenaBytesUsed;
+    size_t          FrameArenaBytesMax;     // Largest FrameArenaBytesUsed at the end of a frame
+    ImGuiPoolAllocatorCallSite CallSites[CallSitesMax];                 // Open addressing hash table on Address. Slot 0 holds allocations without known call site.
+    int             CallSitesCount;
+
+    // [Internal]
+    void*           FreeLists[SizeClassCount];
+    char*           FrameArenaBlocks;       // Linked list of blocks, first one being the current one
+    size_t          FrameArenaBlockSize;    // Capacity of current block
+    size_t          FrameArenaBlockUsed;
+    std::atomic_flag Lock;
+    ImGuiMemAllocFunc PrevAllocFunc;
+    ImGuiMemFreeFunc  PrevFreeFunc;
+    void*           PrevUserData;
+    void*           Pages;                  // Linked list of pages
+    bool            Installed;
+
+    IMGUI_API ImGuiPoolAllocator();
+    IMGUI_API ~ImGuiPoolAllocator();
+    IMGUI_API void  Install();                              // Call before ImGui::CreateContext()
+    IMGUI_API void  Uninstall();                            // Restore previous allocator functions. Call after ImGui::DestroyContext().
+    IMGUI_API void  NewFrame();                             // Roll per-frame stats and reset frame arena
+    IMGUI_API void* FrameAlloc(size_t size);                // Transient memory, 16-byte aligned, valid until next NewFrame()
+    IMGUI_API void  ShowStats();                            // Display stats and top call sites
+
+    IMGUI_API void* Alloc(size_t size);
+    IMGUI_API void  Free(void* ptr);
+};
+
+#endif // #ifndef IMGUI_DISABLE
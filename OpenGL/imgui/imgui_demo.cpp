@@ -565,6 +565,7 @@ void ImGui::ShowDemoWindow(bool* p_open)
             ImGui::CheckboxFlags("io.BackendFlags: HasMouseCursors",      &io.BackendFlags, ImGuiBackendFlags_HasMouseCursors);
             ImGui::CheckboxFlags("io.BackendFlags: HasSetMousePos",       &io.BackendFlags, ImGuiBackendFlags_HasSetMousePos);
             ImGui::CheckboxFlags("io.BackendFlags: RendererHasVtxOffset", &io.BackendFlags, ImGuiBackendFlags_RendererHasVtxOffset);
+            ImGui::CheckboxFlags("io.BackendFlags: RendererHasGlyphInstances", &io.BackendFlags, ImGuiBackendFlags_RendererHasGlyphInstances);
             ImGui::EndDisabled();
 
             ImGui::TreePop();
@@ -2729,6 +2730,47 @@ static void DemoWindowWidgetsSelectionAndMultiSelect(ImGuiDemoWindowData* demo_d
             ImGui::TreePop();
         }
 
+        // Demonstrate storing selection of a very large list as ranges of indices
+        IMGUI_DEMO_MARKER("Widgets/Selection State/Multi-Select (1M items, range storage)");
+        if (ImGui::TreeNode("Multi-Select (1M items, range storage)"))
+        {
+            // Pass index to SetNextItemSelectionUserData(), store ranges of indices in Selection
+            static ImGuiSelectionRangeStorage selection;
+
+            ImGui::Text("Added features:");
+            ImGui::BulletText("Using ImGuiSelectionRangeStorage: Ctrl+A and Shift+Click are O(1) regardless of items count.");
+
+            const int ITEMS_COUNT = 1000000;
+            ImGui::Text("Selection: %d/%d (%s, %d bytes)", selection.Size, ITEMS_COUNT, selection._Bits.Size > 0 ? "bits" : "ranges", selection._Bits.size_in_bytes() + selection._Ranges.size_in_bytes());
+            if (ImGui::BeginChild("##Basket", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiMultiSelectFlags flags = ImGuiMultiSelectFlags_ClearOnEscape | ImGuiMultiSelectFlags_BoxSelect1d;
+                ImGuiMultiSelectIO* ms_io = ImGui::BeginMultiSelect(flags, selection.Size, ITEMS_COUNT);
+                selection.ApplyRequests(ms_io);
+
+                ImGuiListClipper clipper;
+                clipper.Begin(ITEMS_COUNT);
+                if (ms_io->RangeSrcItem != -1)
+                    clipper.IncludeItemByIndex((int)ms_io->RangeSrcItem); // Ensure RangeSrc item is not clipped.
+                while (clipper.Step())
+                {
+                    for (int n = clipper.DisplayStart; n < clipper.DisplayEnd; n++)
+                    {
+                        char label[64];
+                        sprintf(label, "Object %07d: %s", n, ExampleNames[n % IM_ARRAYSIZE(ExampleNames)]);
+                        bool item_is_selected = selection.Contains(n);
+                        ImGui::SetNextItemSelectionUserData(n);
+                        ImGui::Selectable(label, item_is_selected);
+                    }
+                }
+
+                ms_io = ImGui::EndMultiSelect();
+                selection.ApplyRequests(ms_io);
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
+
         // Demonstrate dynamic item list + deletion support using the BeginMultiSelect/EndMultiSelect API.
         // In order to support Deletion without any glitches you need to:
         // - (1) If items are submitted in their own scrolling area, submit contents size SetNextWindowContentSize() ahead of time to prevent one-frame readjustment of scrolling.
@@ -3595,6 +3637,45 @@ static void DemoWindowWidgetsTextFilter()
         for (int i = 0; i < IM_ARRAYSIZE(lines); i++)
             if (filter.PassFilter(lines[i]))
                 ImGui::BulletText("%s", lines[i]);
+
+        IMGUI_DEMO_MARKER("Widgets/Text Filter/Large Log");
+        if (ImGui::TreeNode("Large Log"))
+        {
+            HelpMarker(
+                "ImGuiTextLog indexes lines as they are appended and filters incrementally: "
+                "only new lines are tested, and typing more characters only tests lines of the previous result.\n\n"
+                "Other threads can log with QueueAppend()/QueueAppendf() after InitQueue(): "
+                "records go through a lock-free ring buffer and are moved into the log by Draw() on this thread.");
+            static ImGuiTextLog log;
+            static bool queue_enabled = false;
+            static int queue_records_per_frame = 100;
+            static int queue_records_count = 0;
+            if (log.Queue == NULL)
+                log.InitQueue();
+
+            // For simplicity this demo queues records from the main thread. In your application, any thread can call QueueAppendf().
+            ImGui::Checkbox("Log through queue", &queue_enabled);
+            ImGui::SameLine();
+            ImGui::SetNextItemWidth(ImGui::GetFontSize() * 8);
+            ImGui::SliderInt("records/frame", &queue_records_per_frame, 1, 1000);
+            if (queue_enabled)
+            {
+                const char* levels[] = { "info", "warn", "error" };
+                for (int n = 0; n < queue_records_per_frame; n++, queue_records_count++)
+                    log.QueueAppendf("[queue] [%s] message %d, checksum %08X\n", levels[queue_records_count % 3], queue_records_count, (unsigned int)queue_records_count * 2654435761u);
+            }
+            if (ImGui::Button("Append 1M lines"))
+                for (int n = 0; n < 1000000; n++)
+                    log.Appendf("[main] [%s] line %d\n", (n % 7) ? "info" : "error", log.GetLineCount());
+            ImGui::SameLine();
+            if (ImGui::Button("Clear"))
+                log.Clear();
+            ImGui::SameLine();
+            ImGui::Checkbox("Trigram index", &log.UseTrigramIndex);
+            ImGui::Text("%d lines, %d displayed, %d tested by last filtering, %d records dropped", log.GetLineCount(), log.GetDisplayedLinesCount(), log.LastScanLinesCount, log.GetQueueDroppedCount());
+            log.Draw("##log", ImVec2(-FLT_MIN, ImGui::GetTextLineHeightWithSpacing() * 16));
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 }
@@ -3637,6 +3718,34 @@ static void DemoWindowWidgetsTextInput()
             ImGui::TreePop();
         }
 
+        IMGUI_DEMO_MARKER("Widgets/Text Input/Large Document");
+        if (ImGui::TreeNode("Large Document"))
+        {
+            // ImGuiTextDocument stores text in chunks with a line index, and InputTextMultilineLarge() only processes visible lines.
+            static ImGuiTextDocument doc;
+            static ImGuiInputTextFlags flags = ImGuiInputTextFlags_AllowTabInput;
+            HelpMarker("InputTextMultilineLarge() edits an ImGuiTextDocument, which scales to documents of hundreds of MB. InputTextMultiline() scans the whole buffer every frame.");
+            const int sizes_mb[] = { 1, 10, 50 };
+            for (int size_mb : sizes_mb)
+            {
+                char label[32];
+                sprintf(label, "Generate %d MB", size_mb);
+                if (ImGui::Button(label))
+                {
+                    ImGuiTextBuffer buf;
+                    buf.reserve(size_mb * 1024 * 1024 + 64);
+                    for (int n = 0; buf.size() < size_mb * 1024 * 1024; n++)
+                        buf.appendf("%08d: The quick brown fox jumps over the lazy dog.\n", n);
+                    doc.SetText(buf.begin(), buf.end());
+                }
+                ImGui::SameLine();
+            }
+            ImGui::Text("%d bytes, %d lines, %d chunks", doc.GetTextLen(), doc.GetLineCount(), doc.Chunks.Size);
+            ImGui::CheckboxFlags("ImGuiInputTextFlags_ReadOnly", &flags, ImGuiInputTextFlags_ReadOnly);
+            ImGui::InputTextMultilineLarge("##document", &doc, ImVec2(-FLT_MIN, ImGui::GetTextLineHeight() * 16), flags);
+            ImGui::TreePop();
+        }
+
         IMGUI_DEMO_MARKER("Widgets/Text Input/Filtered Text Input");
         if (ImGui::TreeNode("Filtered Text Input"))
         {
@@ -4040,6 +4149,55 @@ static void DemoWindowWidgetsTreeNodes()
                 ImGui::Indent(ImGui::GetTreeNodeToLabelSpacing());
             ImGui::TreePop();
         }
+
+        IMGUI_DEMO_MARKER("Widgets/Tree Nodes/Large tree, with clipper");
+        if (ImGui::TreeNode("Large tree, with clipper"))
+        {
+            HelpMarker(
+                "Using ImGuiTreeView + TreeViewNode() to display a tree of 1M nodes.\n"
+                "Visible nodes are kept in a flat list updated when opening/closing nodes, which we iterate with ImGuiListClipper.");
+            static ImGuiTreeView tree;
+            if (tree.Nodes.Size == 0)
+            {
+                // 100 roots with 100 children each, with 100 children each
+                for (int root_n = 0; root_n < 100; root_n++)
+                {
+                    const int root = tree.AddNode();
+                    for (int child_n = 0; child_n < 100; child_n++)
+                    {
+                        const int child = tree.AddNode(root);
+                        for (int leaf_n = 0; leaf_n < 100; leaf_n++)
+                            tree.AddNode(child);
+                    }
+                }
+            }
+            if (ImGui::Button("Open all"))
+                tree.SetAllNodesOpen(true);
+            ImGui::SameLine();
+            if (ImGui::Button("Close all"))
+                tree.SetAllNodesOpen(false);
+            tree.UpdateRows();
+            ImGui::SameLine();
+            ImGui::Text("%d nodes, %d visible", tree.Nodes.Size, tree.Rows.Size);
+
+            if (ImGui::BeginChild("##tree", ImVec2(-FLT_MIN, ImGui::GetFontSize() * 20), ImGuiChildFlags_FrameStyle | ImGuiChildFlags_ResizeY))
+            {
+                ImGuiListClipper clipper;
+                clipper.Begin(tree.Rows.Size);
+                while (clipper.Step())
+                {
+                    for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                    {
+                        const int node_n = tree.Rows[row_n];
+                        char label[32];
+                        sprintf(label, "%s %d", tree.Nodes[node_n].FirstChild != -1 ? "Node" : "Leaf", node_n);
+                        ImGui::TreeViewNode(&tree, row_n, label, ImGuiTreeNodeFlags_SpanAvailWidth);
+                    }
+                }
+            }
+            ImGui::EndChild();
+            ImGui::TreePop();
+        }
         ImGui::TreePop();
     }
 }
@@ -4932,6 +5090,42 @@ static void DemoWindowLayout()
             ImGui::End();
         }
 
+        // Variable height items
+        IMGUI_DEMO_MARKER("Layout/Scrolling/Variable height items");
+        ImGui::Spacing();
+        HelpMarker(
+            "Use ImGuiListClipperHeights to clip a list of items of different heights.\n\n"
+            "Items are measured when displayed, items never displayed use an estimated height. "
+            "Converting between item index and scroll position is O(log(items_count)).");
+        static ImGuiListClipperHeights variable_heights;
+        static int variable_items_count = 1000000;
+        static int variable_scroll_to_item = 500000;
+        ImGui::PushItemWidth(120);
+        ImGui::DragInt("Items", &variable_items_count, 1000.0f, 0, 10000000, "%d", ImGuiSliderFlags_AlwaysClamp);
+        ImGui::SameLine();
+        bool variable_scroll_to = ImGui::Button("Scroll To Item");
+        ImGui::SameLine();
+        variable_scroll_to |= ImGui::DragInt("##scroll_to_item", &variable_scroll_to_item, 100.0f, 0, IM_MAX(variable_items_count - 1, 0), "Item = %d", ImGuiSliderFlags_AlwaysClamp);
+        ImGui::PopItemWidth();
+        variable_heights.Resize(variable_items_count, ImGui::GetTextLineHeightWithSpacing() * 2.0f);
+        if (ImGui::BeginChild("##VariableHeightItems", ImVec2(-FLT_MIN, 300.0f), ImGuiChildFlags_Borders))
+        {
+            if (variable_scroll_to && variable_items_count > 0)
+                ImGui::SetScrollY((float)variable_heights.GetItemPos(variable_scroll_to_item));
+            ImGuiListClipper clipper;
+            clipper.Begin(&variable_heights);
+            while (clipper.Step())
+                for (int item = clipper.DisplayStart; item < clipper.DisplayEnd; item++)
+                {
+                    const int lines_count = 1 + (int)(((unsigned int)item * 2654435761u) >> 30); // 1 to 4 lines
+                    ImGui::Text("Item %d", item);
+                    for (int line = 1; line < lines_count; line++)
+                        ImGui::BulletText("Line %d of %d", line + 1, lines_count);
+                }
+        }
+        ImGui::EndChild();
+        ImGui::Text("Total height %.0f px, memory %d KB", variable_heights.GetTotalHeight(), variable_heights.HeightsTree.size_in_bytes() / 1024);
+
         ImGui::TreePop();
     }
 
@@ -5404,6 +5598,21 @@ struct MyItem
         // e.g. a Name compare if it wasn't already part of the sort specs.
         return (a->ID - b->ID);
     }
+
+    // Compare function to be used by ImGuiTableSortCache: compare two items (given by index) on one column, in ascending order.
+    // The sort is stable and handles multiple columns and sort direction itself.
+    static int CompareForSortCache(const ImGuiTableColumnSortSpecs* sort_spec, int item_a, int item_b, void* user_data)
+    {
+        const MyItem* a = &((const MyItem*)user_data)[item_a];
+        const MyItem* b = &((const MyItem*)user_data)[item_b];
+        switch (sort_spec->ColumnUserID)
+        {
+        case MyItemColumnID_ID:             return (a->ID - b->ID);
+        case MyItemColumnID_Name:           return strcmp(a->Name, b->Name);
+        case MyItemColumnID_Quantity:       return (a->Quantity - b->Quantity);
+        default: IM_ASSERT(0); return 0;
+        }
+    }
 };
 const ImGuiTableSortSpecs* MyItem::s_current_sort_specs = NULL;
 }
@@ -6206,6 +6415,78 @@ static void DemoWindowTables()
         ImGui::TreePop();
     }
 
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Horizontal scrolling, very wide");
+    if (ImGui::TreeNode("Horizontal scrolling, very wide"))
+    {
+#ifdef IMGUI_TABLE_MAX_COLUMNS
+        const int columns_max = IMGUI_TABLE_MAX_COLUMNS - 1;
+#else
+        const int columns_max = 512 - 1;
+#endif
+        HelpMarker(
+            "Only visible columns (plus frozen ones) are laid out with a draw channel, so very wide tables stay cheap "
+            "as long as clipped columns are not submitted either.\n\n"
+            "Here we find the range of visible columns once per frame using ImGuiTableColumnFlags_IsVisible, "
+            "then only submit that range on each row.\n\n"
+            "The maximum number of columns may be raised with IMGUI_TABLE_MAX_COLUMNS in imconfig.h.");
+        static int columns_count = 500;
+        static bool clip_columns = true;
+        columns_count = (columns_count > columns_max) ? columns_max : columns_count;
+        ImGui::SetNextItemWidth(TEXT_BASE_WIDTH * 20);
+        ImGui::SliderInt("Columns", &columns_count, 2, columns_max, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::SameLine();
+        ImGui::Checkbox("Only submit visible columns", &clip_columns);
+
+        static ImGuiTableFlags flags = ImGuiTableFlags_ScrollX | ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+        int submitted_columns = 0;
+        if (ImGui::BeginTable("table_scrollx_wide", columns_count, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 12)))
+        {
+            ImGui::TableSetupScrollFreeze(1, 1);
+            ImGui::TableSetupColumn("Line #", ImGuiTableColumnFlags_WidthFixed | ImGuiTableColumnFlags_NoHide, TEXT_BASE_WIDTH * 8);
+            for (int column = 1; column < columns_count; column++)
+            {
+                char label[16];
+                sprintf(label, "Col %d", column);
+                ImGui::TableSetupColumn(label, ImGuiTableColumnFlags_WidthFixed, TEXT_BASE_WIDTH * 10);
+            }
+            ImGui::TableHeadersRow();
+
+            // Columns are not reorderable here, so visible unfrozen columns are contiguous in index order.
+            // Note that clipped columns which are not submitted cannot be auto-fitted (e.g. "Size all columns to fit").
+            int column_min = 1, column_max = columns_count - 1;
+            if (clip_columns)
+            {
+                column_min = columns_count;
+                column_max = 0;
+                for (int column = 1; column < columns_count; column++)
+                    if (ImGui::TableGetColumnFlags(column) & ImGuiTableColumnFlags_IsVisible)
+                    {
+                        column_min = (column < column_min) ? column : column_min;
+                        column_max = column;
+                    }
+            }
+            submitted_columns = 1 + ((column_max >= column_min) ? column_max - column_min + 1 : 0);
+
+            ImGuiListClipper clipper;
+            clipper.Begin(1000);
+            while (clipper.Step())
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; row++)
+                {
+                    ImGui::TableNextRow();
+                    ImGui::TableSetColumnIndex(0);
+                    ImGui::Text("Line %d", row);
+                    for (int column = column_min; column <= column_max; column++)
+                        if (ImGui::TableSetColumnIndex(column))
+                            ImGui::Text("%d,%d", column, row);
+                }
+            ImGui::EndTable();
+        }
+        ImGui::Text("Submitting %d/%d columns per row", submitted_columns, columns_count);
+        ImGui::TreePop();
+    }
+
     if (open_action != -1)
         ImGui::SetNextItemOpen(open_action != 0);
     IMGUI_DEMO_MARKER("Tables/Columns flags");
@@ -7077,6 +7358,77 @@ static void DemoWindowTables()
         ImGui::TreePop();
     }
 
+    // Demonstrate sorting a very large table with ImGuiTableSortCache.
+    // Items are never moved: the cache keeps a sorted permutation of item indices, which drives the clipper.
+    if (open_action != -1)
+        ImGui::SetNextItemOpen(open_action != 0);
+    IMGUI_DEMO_MARKER("Tables/Sorting huge tables");
+    if (ImGui::TreeNode("Sorting huge tables"))
+    {
+        HelpMarker(
+            "ImGuiTableSortCache sorts a permutation of item indices, reusing the previous order when possible "
+            "(e.g. when clicking a new column, or when items are appended).\n\n"
+            "With ItemsPerUpdate set, sorting is spread over multiple frames and the previous order stays displayed meanwhile.");
+        static ImVector<MyItem> items;
+        static int items_count = 1000000;
+        static ImGuiTableSortCache sort_cache;
+        static bool sort_incrementally = true;
+        ImGui::SetNextItemWidth(ImGui::GetFontSize() * 12);
+        ImGui::SliderInt("Items", &items_count, 1000, 4000000, "%d", ImGuiSliderFlags_Logarithmic);
+        ImGui::SameLine();
+        ImGui::Checkbox("Sort incrementally", &sort_incrementally);
+        sort_cache.ItemsPerUpdate = sort_incrementally ? 64 * 1024 : 0;
+        if (items.Size != items_count)
+        {
+            const int prev_count = items.Size;
+            items.resize(items_count, MyItem());
+            for (int n = prev_count; n < items.Size; n++)
+            {
+                MyItem& item = items[n];
+                item.ID = n;
+                item.Name = template_items_names[n % IM_ARRAYSIZE(template_items_names)];
+                item.Quantity = (int)(((unsigned int)n * 2654435761u) >> 22); // 0..1023
+            }
+        }
+
+        static ImGuiTableFlags flags =
+            ImGuiTableFlags_Resizable | ImGuiTableFlags_Sortable | ImGuiTableFlags_SortMulti | ImGuiTableFlags_SortTristate
+            | ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersOuter | ImGuiTableFlags_BordersV | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("table_sorting_huge", 3, flags, ImVec2(0.0f, TEXT_BASE_HEIGHT * 15), 0.0f))
+        {
+            ImGui::TableSetupColumn("ID",       ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_WidthFixed, 0.0f, MyItemColumnID_ID);
+            ImGui::TableSetupColumn("Name",     ImGuiTableColumnFlags_WidthFixed, 0.0f, MyItemColumnID_Name);
+            ImGui::TableSetupColumn("Quantity", ImGuiTableColumnFlags_WidthStretch, 0.0f, MyItemColumnID_Quantity);
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableHeadersRow();
+
+            // Clear sort_specs->SpecsDirty, (re)sort or continue sorting when needed
+            if (ImGuiTableSortSpecs* sort_specs = ImGui::TableGetSortSpecs())
+                sort_cache.Update(sort_specs, items.Size, MyItem::CompareForSortCache, items.Data);
+
+            ImGuiListClipper clipper;
+            clipper.Begin(sort_cache.Indices.Size);
+            while (clipper.Step())
+                for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
+                {
+                    const MyItem* item = &items[sort_cache.Indices[row_n]];
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%07d", item->ID);
+                    ImGui::TableNextColumn();
+                    ImGui::TextUnformatted(item->Name);
+                    ImGui::TableNextColumn();
+                    ImGui::Text("%d", item->Quantity);
+                }
+            ImGui::EndTable();
+        }
+        if (sort_cache.IsSorting())
+            ImGui::ProgressBar(sort_cache.GetSortProgress(), ImVec2(-FLT_MIN, 0.0f), "Sorting...");
+        else
+            ImGui::Text("Sorts completed: %d", sort_cache.SortCount);
+        ImGui::TreePop();
+    }
+
     // In this example we'll expose most table flags and settings.
     // For specific flags and settings refer to the corresponding section for more detailed explanation.
     // This section is mostly useful to experiment with combining certain flags or settings with each others.
@@ -8059,6 +8411,7 @@ void ImGui::ShowAboutWindow(bool* p_open)
         if (io.BackendFlags & ImGuiBackendFlags_HasMouseCursors)        ImGui::Text(" HasMouseCursors");
         if (io.BackendFlags & ImGuiBackendFlags_HasSetMousePos)         ImGui::Text(" HasSetMousePos");
         if (io.BackendFlags & ImGuiBackendFlags_RendererHasVtxOffset)   ImGui::Text(" RendererHasVtxOffset");
+        if (io.BackendFlags & ImGuiBackendFlags_RendererHasGlyphInstances) ImGui::Text(" RendererHasGlyphInstances");
         ImGui::Separator();
         ImGui::Text("io.Fonts: %d fonts, Flags: 0x%08X, TexSize: %d,%d", io.Fonts->Fonts.Size, io.Fonts->Flags, io.Fonts->TexWidth, io.Fonts->TexHeight);
         ImGui::Text("io.DisplaySize: %.2f,%.2f", io.DisplaySize.x, io.DisplaySize.y);
@@ -425,6 +425,7 @@ void ImDrawList::_ResetForNewFrame()
     CmdBuffer.resize(0);
     IdxBuffer.resize(0);
     VtxBuffer.resize(0);
+    GlyphBuffer.resize(0);
     Flags = _Data->InitialFlags;
     memset(&_CmdHeader, 0, sizeof(_CmdHeader));
     _VtxCurrentIdx = 0;
@@ -444,6 +445,7 @@ void ImDrawList::_ClearFreeMemory()
     CmdBuffer.clear();
     IdxBuffer.clear();
     VtxBuffer.clear();
+    GlyphBuffer.clear();
     Flags = ImDrawListFlags_None;
     _VtxCurrentIdx = 0;
     _VtxWritePtr = NULL;
@@ -461,10 +463,78 @@ ImDrawList* ImDrawList::CloneOutput() const
     dst->CmdBuffer = CmdBuffer;
     dst->IdxBuffer = IdxBuffer;
     dst->VtxBuffer = VtxBuffer;
+    dst->GlyphBuffer = GlyphBuffer;
     dst->Flags = Flags;
     return dst;
 }
 
+// Glyphs of each command are converted to 4 vertices + 6 indices each, appended after the existing vertices,
+// so the output matches what AddText() would have produced without ImDrawListFlags_GlyphInstances.
+void ImDrawList::ExpandGlyphsTo(ImDrawList* dst) const
+{
+    IM_ASSERT(dst != this);
+    const ImFontAtlas* atlas = _Data->GlyphTableAtlas;
+    IM_ASSERT(GlyphBuffer.Size == 0 || atlas != NULL);
+    dst->CmdBuffer.resize(0);
+    dst->IdxBuffer.resize(0);
+    dst->VtxBuffer = VtxBuffer;
+    dst->GlyphBuffer.resize(0);
+    dst->Flags = Flags & ~ImDrawListFlags_GlyphInstances;
+    dst->CmdBuffer.reserve(CmdBuffer.Size);
+    dst->IdxBuffer.reserve(IdxBuffer.Size + GlyphBuffer.Size * 6);
+    dst->VtxBuffer.reserve(VtxBuffer.Size + GlyphBuffer.Size * 4);
+
+    for (const ImDrawCmd& src_cmd : CmdBuffer)
+    {
+        ImDrawCmd cmd = src_cmd;
+        cmd.IdxOffset = dst->IdxBuffer.Size;
+        cmd.GlyphOffset = cmd.GlyphCount = 0;
+        if (src_cmd.ElemCount > 0)
+        {
+            dst->IdxBuffer.resize(dst->IdxBuffer.Size + (int)src_cmd.ElemCount);
+            memcpy(dst->IdxBuffer.Data + cmd.IdxOffset, IdxBuffer.Data + src_cmd.IdxOffset, src_cmd.ElemCount * sizeof(ImDrawIdx));
+        }
+        for (const ImDrawGlyph* src_glyph = GlyphBuffer.Data + src_cmd.GlyphOffset; src_glyph < GlyphBuffer.Data + src_cmd.GlyphOffset + src_cmd.GlyphCount; src_glyph++)
+        {
+            const ImFontGlyph* glyph = atlas->GetGlyphTableEntry((int)src_glyph->GlyphIndex);
+            if (glyph == NULL)
+                continue;
+
+            // Vertices are appended at the end of the buffer: start a new command with a new VtxOffset when they can't be indexed anymore.
+            unsigned int vtx_index = (unsigned int)dst->VtxBuffer.Size - cmd.VtxOffset;
+            if (sizeof(ImDrawIdx) == 2 && vtx_index + 4 > (1 << 16))
+            {
+                IM_ASSERT((Flags & ImDrawListFlags_AllowVtxOffset) && "Too many vertices in ImDrawList using 16-bit indices.");
+                if (cmd.ElemCount > 0)
+                {
+                    dst->CmdBuffer.push_back(cmd);
+                    cmd.IdxOffset = dst->IdxBuffer.Size;
+                    cmd.ElemCount = 0;
+                }
+                cmd.VtxOffset = dst->VtxBuffer.Size;
+                vtx_index = 0;
+            }
+
+            const ImVec2 p = src_glyph->Pos;
+            const ImU32 col = src_glyph->Col;
+            dst->VtxBuffer.resize(dst->VtxBuffer.Size + 4);
+            ImDrawVert* vtx_write = dst->VtxBuffer.Data + dst->VtxBuffer.Size - 4;
+            vtx_write[0].pos.x = p.x + glyph->X0; vtx_write[0].pos.y = p.y + glyph->Y0; vtx_write[0].col = col; vtx_write[0].uv.x = glyph->U0; vtx_write[0].uv.y = glyph->V0;
+            vtx_write[1].pos.x = p.x + glyph->X1; vtx_write[1].pos.y = p.y + glyph->Y0; vtx_write[1].col = col; vtx_write[1].uv.x = glyph->U1; vtx_write[1].uv.y = glyph->V0;
+            vtx_write[2].pos.x = p.x + glyph->X1; vtx_write[2].pos.y = p.y + glyph->Y1; vtx_write[2].col = col; vtx_write[2].uv.x = glyph->U1; vtx_write[2].uv.y = glyph->V1;
+            vtx_write[3].pos.x = p.x + glyph->X0; vtx_write[3].pos.y = p.y + glyph->Y1; vtx_write[3].col = col; vtx_write[3].uv.x = glyph->U0; vtx_write[3].uv.y = glyph->V1;
+            dst->IdxBuffer.resize(dst->IdxBuffer.Size + 6);
+            ImDrawIdx* idx_write = dst->IdxBuffer.Data + dst->IdxBuffer.Size - 6;
+            idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+            idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+            cmd.ElemCount += 6;
+        }
+        dst->CmdBuffer.push_back(cmd);
+    }
+    dst->_VtxWritePtr = dst->VtxBuffer.Data + dst->VtxBuffer.Size;
+    dst->_IdxWritePtr = dst->IdxBuffer.Data + dst->IdxBuffer.Size;
+}
+
 void ImDrawList::AddDrawCmd()
 {
     ImDrawCmd draw_cmd;
@@ -472,6 +542,7 @@ void ImDrawList::AddDrawCmd()
     draw_cmd.TextureId = _CmdHeader.TextureId;
     draw_cmd.VtxOffset = _CmdHeader.VtxOffset;
     draw_cmd.IdxOffset = IdxBuffer.Size;
+    draw_cmd.GlyphOffset = GlyphBuffer.Size;
 
     IM_ASSERT(draw_cmd.ClipRect.x <= draw_cmd.ClipRect.z && draw_cmd.ClipRect.y <= draw_cmd.ClipRect.w);
     CmdBuffer.push_back(draw_cmd);
@@ -484,7 +555,7 @@ void ImDrawList::_PopUnusedDrawCmd()
     while (CmdBuffer.Size > 0)
     {
         ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-        if (curr_cmd->ElemCount != 0 || curr_cmd->UserCallback != NULL)
+        if (curr_cmd->ElemCount != 0 || curr_cmd->GlyphCount != 0 || curr_cmd->UserCallback != NULL)
             return;// break;
         CmdBuffer.pop_back();
     }
@@ -495,7 +566,7 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     IM_ASSERT(curr_cmd->UserCallback == NULL);
-    if (curr_cmd->ElemCount != 0)
+    if (curr_cmd->ElemCount != 0 || curr_cmd->GlyphCount != 0)
     {
         AddDrawCmd();
         curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
@@ -529,6 +600,8 @@ void ImDrawList::AddCallback(ImDrawCallback callback, void* userdata, size_t use
 #define ImDrawCmd_HeaderCompare(CMD_LHS, CMD_RHS)       (memcmp(CMD_LHS, CMD_RHS, ImDrawCmd_HeaderSize))    // Compare ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_HeaderCopy(CMD_DST, CMD_SRC)          (memcpy(CMD_DST, CMD_SRC, ImDrawCmd_HeaderSize))    // Copy ClipRect, TextureId, VtxOffset
 #define ImDrawCmd_AreSequentialIdxOffset(CMD_0, CMD_1)  (CMD_0->IdxOffset + CMD_0->ElemCount == CMD_1->IdxOffset)
+#define ImDrawCmd_IsEmpty(CMD)                          ((CMD)->ElemCount == 0 && (CMD)->GlyphCount == 0)
+#define ImDrawCmd_CanAppendGlyphs(CMD_0, CMD_1)         (CMD_0->GlyphCount == 0 || (CMD_1->ElemCount == 0 && (CMD_1->GlyphCount == 0 || CMD_0->GlyphOffset + CMD_0->GlyphCount == CMD_1->GlyphOffset))) // Triangles of a command are drawn before its glyphs
 
 // Try to merge two last draw commands
 void ImDrawList::_TryMergeDrawCmds()
@@ -536,9 +609,12 @@ void ImDrawList::_TryMergeDrawCmds()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_HeaderCompare(curr_cmd, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && ImDrawCmd_CanAppendGlyphs(prev_cmd, curr_cmd) && curr_cmd->UserCallback == NULL && prev_cmd->UserCallback == NULL)
     {
         prev_cmd->ElemCount += curr_cmd->ElemCount;
+        if (prev_cmd->GlyphCount == 0)
+            prev_cmd->GlyphOffset = curr_cmd->GlyphOffset;
+        prev_cmd->GlyphCount += curr_cmd->GlyphCount;
         CmdBuffer.pop_back();
     }
 }
@@ -550,7 +626,7 @@ void ImDrawList::_OnChangedClipRect()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
+    if (!ImDrawCmd_IsEmpty(curr_cmd) && memcmp(&curr_cmd->ClipRect, &_CmdHeader.ClipRect, sizeof(ImVec4)) != 0)
     {
         AddDrawCmd();
         return;
@@ -559,7 +635,7 @@ void ImDrawList::_OnChangedClipRect()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_IsEmpty(curr_cmd) && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -572,7 +648,7 @@ void ImDrawList::_OnChangedTextureID()
     // If current command is used with different settings we need to add a new command
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount != 0 && curr_cmd->TextureId != _CmdHeader.TextureId)
+    if (!ImDrawCmd_IsEmpty(curr_cmd) && curr_cmd->TextureId != _CmdHeader.TextureId)
     {
         AddDrawCmd();
         return;
@@ -581,7 +657,7 @@ void ImDrawList::_OnChangedTextureID()
 
     // Try to merge with previous command if it matches, else use current command
     ImDrawCmd* prev_cmd = curr_cmd - 1;
-    if (curr_cmd->ElemCount == 0 && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
+    if (ImDrawCmd_IsEmpty(curr_cmd) && CmdBuffer.Size > 1 && ImDrawCmd_HeaderCompare(&_CmdHeader, prev_cmd) == 0 && ImDrawCmd_AreSequentialIdxOffset(prev_cmd, curr_cmd) && prev_cmd->UserCallback == NULL)
     {
         CmdBuffer.pop_back();
         return;
@@ -596,7 +672,7 @@ void ImDrawList::_OnChangedVtxOffset()
     IM_ASSERT_PARANOID(CmdBuffer.Size > 0);
     ImDrawCmd* curr_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
     //IM_ASSERT(curr_cmd->VtxOffset != _CmdHeader.VtxOffset); // See #3349
-    if (curr_cmd->ElemCount != 0)
+    if (!ImDrawCmd_IsEmpty(curr_cmd))
     {
         AddDrawCmd();
         return;
@@ -686,7 +762,13 @@ void ImDrawList::PrimReserve(int idx_count, int vtx_count)
         _OnChangedVtxOffset();
     }
 
+    // Triangles of a command are drawn before its glyphs: start a new command after glyphs output by AddText()
     ImDrawCmd* draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    if (draw_cmd->GlyphCount != 0)
+    {
+        AddDrawCmd();
+        draw_cmd = &CmdBuffer.Data[CmdBuffer.Size - 1];
+    }
     draw_cmd->ElemCount += idx_count;
 
     int vtx_buffer_old_size = VtxBuffer.Size;
@@ -2081,6 +2163,7 @@ void ImDrawListSplitter::ClearFreeMemory()
             memset(&_Channels[i], 0, sizeof(_Channels[i]));  // Current channel is a copy of CmdBuffer/IdxBuffer, don't destruct again
         _Channels[i]._CmdBuffer.clear();
         _Channels[i]._IdxBuffer.clear();
+        _Channels[i]._GlyphBuffer.clear();
     }
     _Current = 0;
     _Count = 1;
@@ -2113,6 +2196,7 @@ void ImDrawListSplitter::Split(ImDrawList* draw_list, int channels_count)
         {
             _Channels[i]._CmdBuffer.resize(0);
             _Channels[i]._IdxBuffer.resize(0);
+            _Channels[i]._GlyphBuffer.resize(0);
         }
     }
 }
@@ -2126,15 +2210,17 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
     SetCurrentChannel(draw_list, 0);
     draw_list->_PopUnusedDrawCmd();
 
-    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset values in each command.
+    // Calculate our final buffer sizes. Also fix the incorrect IdxOffset/GlyphOffset values in each command.
     int new_cmd_buffer_count = 0;
     int new_idx_buffer_count = 0;
+    int new_glyph_buffer_count = 0;
     ImDrawCmd* last_cmd = (_Count > 0 && draw_list->CmdBuffer.Size > 0) ? &draw_list->CmdBuffer.back() : NULL;
     int idx_offset = last_cmd ? last_cmd->IdxOffset + last_cmd->ElemCount : 0;
+    int glyph_offset = draw_list->GlyphBuffer.Size;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
-        if (ch._CmdBuffer.Size > 0 && ch._CmdBuffer.back().ElemCount == 0 && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+        if (ch._CmdBuffer.Size > 0 && ImDrawCmd_IsEmpty(&ch._CmdBuffer.back()) && ch._CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
             ch._CmdBuffer.pop_back();
 
         if (ch._CmdBuffer.Size > 0 && last_cmd != NULL)
@@ -2142,11 +2228,15 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             // Do not include ImDrawCmd_AreSequentialIdxOffset() in the compare as we rebuild IdxOffset values ourselves.
             // Manipulating IdxOffset (e.g. by reordering draw commands like done by RenderDimmedBackgroundBehindWindow()) is not supported within a splitter.
             ImDrawCmd* next_cmd = &ch._CmdBuffer[0];
-            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL)
+            if (ImDrawCmd_HeaderCompare(last_cmd, next_cmd) == 0 && last_cmd->UserCallback == NULL && next_cmd->UserCallback == NULL && (last_cmd->GlyphCount == 0 || next_cmd->ElemCount == 0))
             {
                 // Merge previous channel last draw command with current channel first draw command if matching.
                 last_cmd->ElemCount += next_cmd->ElemCount;
+                if (last_cmd->GlyphCount == 0)
+                    last_cmd->GlyphOffset = glyph_offset;
+                last_cmd->GlyphCount += next_cmd->GlyphCount;
                 idx_offset += next_cmd->ElemCount;
+                glyph_offset += next_cmd->GlyphCount;
                 ch._CmdBuffer.erase(ch._CmdBuffer.Data); // FIXME-OPT: Improve for multiple merges.
             }
         }
@@ -2154,23 +2244,29 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
             last_cmd = &ch._CmdBuffer.back();
         new_cmd_buffer_count += ch._CmdBuffer.Size;
         new_idx_buffer_count += ch._IdxBuffer.Size;
+        new_glyph_buffer_count += ch._GlyphBuffer.Size;
         for (int cmd_n = 0; cmd_n < ch._CmdBuffer.Size; cmd_n++)
         {
             ch._CmdBuffer.Data[cmd_n].IdxOffset = idx_offset;
+            ch._CmdBuffer.Data[cmd_n].GlyphOffset = glyph_offset;
             idx_offset += ch._CmdBuffer.Data[cmd_n].ElemCount;
+            glyph_offset += ch._CmdBuffer.Data[cmd_n].GlyphCount;
         }
     }
     draw_list->CmdBuffer.resize(draw_list->CmdBuffer.Size + new_cmd_buffer_count);
     draw_list->IdxBuffer.resize(draw_list->IdxBuffer.Size + new_idx_buffer_count);
+    draw_list->GlyphBuffer.resize(draw_list->GlyphBuffer.Size + new_glyph_buffer_count);
 
     // Write commands and indices in order (they are fairly small structures, we don't copy vertices only indices)
     ImDrawCmd* cmd_write = draw_list->CmdBuffer.Data + draw_list->CmdBuffer.Size - new_cmd_buffer_count;
     ImDrawIdx* idx_write = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size - new_idx_buffer_count;
+    ImDrawGlyph* glyph_write = draw_list->GlyphBuffer.Data + draw_list->GlyphBuffer.Size - new_glyph_buffer_count;
     for (int i = 1; i < _Count; i++)
     {
         ImDrawChannel& ch = _Channels[i];
         if (int sz = ch._CmdBuffer.Size) { memcpy(cmd_write, ch._CmdBuffer.Data, sz * sizeof(ImDrawCmd)); cmd_write += sz; }
         if (int sz = ch._IdxBuffer.Size) { memcpy(idx_write, ch._IdxBuffer.Data, sz * sizeof(ImDrawIdx)); idx_write += sz; }
+        if (int sz = ch._GlyphBuffer.Size) { memcpy(glyph_write, ch._GlyphBuffer.Data, sz * sizeof(ImDrawGlyph)); glyph_write += sz; }
     }
     draw_list->_IdxWritePtr = idx_write;
 
@@ -2180,7 +2276,7 @@ void ImDrawListSplitter::Merge(ImDrawList* draw_list)
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
-    if (curr_cmd->ElemCount == 0)
+    if (ImDrawCmd_IsEmpty(curr_cmd))
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -2194,19 +2290,21 @@ void ImDrawListSplitter::SetCurrentChannel(ImDrawList* draw_list, int idx)
     if (_Current == idx)
         return;
 
-    // Overwrite ImVector (12/16 bytes), four times. This is merely a silly optimization instead of doing .swap()
+    // Overwrite ImVector (12/16 bytes), six times. This is merely a silly optimization instead of doing .swap()
     memcpy(&_Channels.Data[_Current]._CmdBuffer, &draw_list->CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&_Channels.Data[_Current]._IdxBuffer, &draw_list->IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&_Channels.Data[_Current]._GlyphBuffer, &draw_list->GlyphBuffer, sizeof(draw_list->GlyphBuffer));
     _Current = idx;
     memcpy(&draw_list->CmdBuffer, &_Channels.Data[idx]._CmdBuffer, sizeof(draw_list->CmdBuffer));
     memcpy(&draw_list->IdxBuffer, &_Channels.Data[idx]._IdxBuffer, sizeof(draw_list->IdxBuffer));
+    memcpy(&draw_list->GlyphBuffer, &_Channels.Data[idx]._GlyphBuffer, sizeof(draw_list->GlyphBuffer));
     draw_list->_IdxWritePtr = draw_list->IdxBuffer.Data + draw_list->IdxBuffer.Size;
 
     // If current command is used with different settings we need to add a new command
     ImDrawCmd* curr_cmd = (draw_list->CmdBuffer.Size == 0) ? NULL : &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
     if (curr_cmd == NULL)
         draw_list->AddDrawCmd();
-    else if (curr_cmd->ElemCount == 0)
+    else if (ImDrawCmd_IsEmpty(curr_cmd))
         ImDrawCmd_HeaderCopy(curr_cmd, &draw_list->_CmdHeader); // Copy ClipRect, TextureId, VtxOffset
     else if (ImDrawCmd_HeaderCompare(curr_cmd, &draw_list->_CmdHeader) != 0)
         draw_list->AddDrawCmd();
@@ -2231,7 +2329,7 @@ void ImGui::AddDrawListToDrawDataEx(ImDrawData* draw_data, ImVector<ImDrawList*>
 {
     if (draw_list->CmdBuffer.Size == 0)
         return;
-    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
+    if (draw_list->CmdBuffer.Size == 1 && draw_list->CmdBuffer[0].ElemCount == 0 && draw_list->CmdBuffer[0].GlyphCount == 0 && draw_list->CmdBuffer[0].UserCallback == NULL)
         return;
 
     // Draw list sanity check. Detect mismatch between PrimReserve() calls and incrementing _VtxCurrentIdx, _VtxWritePtr etc.
@@ -2527,6 +2625,7 @@ void    ImFontAtlas::ClearFonts()
     IM_ASSERT(!Locked && "Cannot modify a locked ImFontAtlas between NewFrame() and EndFrame/Render()!");
     ClearInputData();
     Fonts.clear_delete();
+    GlyphTableSize = 0;
     TexReady = false;
 }
 
@@ -2756,6 +2855,14 @@ void ImFontAtlas::CalcCustomRectUV(const ImFontAtlasCustomRect* rect, ImVec2* ou
     *out_uv_max = ImVec2((float)(rect->X + rect->Width) * TexUvScale.x, (float)(rect->Y + rect->Height) * TexUvScale.y);
 }
 
+const ImFontGlyph* ImFontAtlas::GetGlyphTableEntry(int glyph_index) const
+{
+    for (const ImFont* font : Fonts)
+        if (font->GlyphTableOffset >= 0 && glyph_index >= font->GlyphTableOffset && glyph_index < font->GlyphTableOffset + font->Glyphs.Size)
+            return &font->Glyphs.Data[glyph_index - font->GlyphTableOffset];
+    return NULL;
+}
+
 bool ImFontAtlasGetMouseCursorTexData(ImFontAtlas* atlas, ImGuiMouseCursor cursor_type, ImVec2* out_offset, ImVec2* out_size, ImVec2 out_uv_border[2], ImVec2 out_uv_fill[2])
 {
     if (cursor_type <= ImGuiMouseCursor_None || cursor_type >= ImGuiMouseCursor_COUNT)
@@ -3368,6 +3475,14 @@ void ImFontAtlasBuildFinish(ImFontAtlas* atlas)
         if (font->DirtyLookupTables)
             font->BuildLookupTable();
 
+    // Index glyphs of all fonts in a single table, referenced by ImDrawGlyph::GlyphIndex
+    atlas->GlyphTableSize = 0;
+    for (ImFont* font : atlas->Fonts)
+    {
+        font->GlyphTableOffset = atlas->GlyphTableSize;
+        atlas->GlyphTableSize += font->Glyphs.Size;
+    }
+
     atlas->TexReady = true;
 }
 
@@ -3692,6 +3807,7 @@ ImFont::ImFont()
 {
     memset(this, 0, sizeof(*this));
     Scale = 1.0f;
+    GlyphTableOffset = -1;
 }
 
 ImFont::~ImFont()
@@ -3711,6 +3827,7 @@ void    ImFont::ClearOutputData()
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    GlyphTableOffset = -1;
     memset(Used8kPagesMap, 0, sizeof(Used8kPagesMap));
 }
 
@@ -3871,6 +3988,7 @@ void ImFont::AddGlyph(const ImFontConfig* src, ImWchar codepoint, float x0, floa
     glyph.V1 = v1;
     glyph.AdvanceX = advance_x;
     IM_ASSERT(Glyphs.Size < 0xFFFF); // IndexLookup[] hold 16-bit values and -1 is reserved.
+    GlyphTableOffset = -1; // Atlas glyph table is out of date until next build
 
     // Compute rough surface usage metrics (+1 to account for average padding, +0.99 to round)
     // We use (U1-U0)*TexWidth instead of X1-X0 to account for oversampling.
@@ -3929,8 +4047,10 @@ static inline const char* CalcWordWrapNextLineStartA(const char* text, const cha
 
 // Simple word-wrapping for English, not full-featured. Please submit failing cases!
 // This will return the next location to wrap from. If no wrapping if necessary, this will fast-forward to e.g. text_end.
+// With 'stop_on_new_line', return on the first '\n' instead of scanning past it, so callers can find the end of a line in a single pass.
+// The returned position is then always a character boundary.
 // FIXME: Much possible improvements (don't cut things like "word !", "word!!!" but cut within "word,,,,", more sensible support for punctuations, support for Unicode punctuations, etc.)
-const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width)
+static const char* ImFontCalcWordWrapPosition(ImFont* font, float scale, const char* text, const char* text_end, float wrap_width, bool stop_on_new_line)
 {
     // For references, possible wrap point marked with ^
     //  "aaa bbb, ccc,ddd. eee   fff. ggg!"
@@ -3967,6 +4087,8 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
         {
             if (c == '\n')
             {
+                if (stop_on_new_line)
+                    return s;
                 line_width = word_width = blank_width = 0.0f;
                 inside_word = true;
                 s = next_s;
@@ -3979,7 +4101,7 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
             }
         }
 
-        const float char_width = ImFontGetCharAdvanceX(this, c);
+        const float char_width = ImFontGetCharAdvanceX(font, c);
         if (ImCharIsBlankW(c))
         {
             if (inside_word)
@@ -4024,10 +4146,22 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     // Wrap_width is too small to fit anything. Force displaying 1 character to minimize the height discontinuity.
     // +1 may not be a character start point in UTF-8 but it's ok because caller loops use (text >= word_wrap_eol).
     if (s == text && text < text_end)
+    {
+        if (stop_on_new_line)
+        {
+            unsigned int c;
+            return s + ImTextCharFromUtf8(&c, s, text_end);
+        }
         return s + 1;
+    }
     return s;
 }
 
+const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const char* text_end, float wrap_width)
+{
+    return ImFontCalcWordWrapPosition(this, scale, text, text_end, wrap_width, false);
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining)
 {
     if (!text_end)
@@ -4048,8 +4182,9 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
+            // The scan stops on '\n', which then ends the line through this same path.
             if (!word_wrap_eol)
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - line_width);
+                word_wrap_eol = ImFontCalcWordWrapPosition(this, scale, s, text_end, wrap_width - line_width, true);
 
             if (s >= word_wrap_eol)
             {
@@ -4106,6 +4241,75 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     return text_size;
 }
 
+const ImFontWrapCacheEntry* ImFontWrapCache::GetEntry(ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const int text_length = (int)(text_end - text_begin);
+    if (text_length < IM_FONT_WRAP_CACHE_MIN_TEXT_LENGTH)
+        return NULL;
+    const ImGuiID text_hash = ImHashData(text_begin, (size_t)text_length);
+    ImGuiID key = ImHashData(&font, sizeof(font), text_hash);
+    key = ImHashData(&size, sizeof(size), key);
+    key = ImHashData(&wrap_width, sizeof(wrap_width), key);
+
+    ImFontWrapCacheEntry* entry;
+    int* entry_idx = EntriesMap.GetIntRef(key, -1);
+    if (*entry_idx >= 0)
+    {
+        entry = &Entries[*entry_idx];
+        entry->LastFrameUsed = FrameCount;
+        if (entry->TextHash == text_hash && entry->TextLength == text_length && entry->Font == font && entry->FontAdvanceX == font->IndexAdvanceX.Data && entry->FontSize == size && entry->WrapWidth == wrap_width)
+            return entry;
+        entry->LineEnds.resize(0); // Key collision or rebuilt font: recycle the entry
+    }
+    else
+    {
+        *entry_idx = Entries.Size;
+        Entries.resize(Entries.Size + 1);
+        entry = &Entries.back();
+        IM_PLACEMENT_NEW(entry) ImFontWrapCacheEntry();
+    }
+
+    // Lay out text once: same line breaks as the ImFont::RenderText() loop, which only uses the end of each line.
+    entry->Key = key;
+    entry->TextHash = text_hash;
+    entry->TextLength = text_length;
+    entry->Font = font;
+    entry->FontAdvanceX = font->IndexAdvanceX.Data;
+    entry->FontSize = size;
+    entry->WrapWidth = wrap_width;
+    entry->LastFrameUsed = FrameCount;
+    entry->Size = font->CalcTextSizeA(size, FLT_MAX, wrap_width, text_begin, text_end);
+    const float scale = size / font->FontSize;
+    for (const char* s = text_begin; s < text_end; )
+    {
+        const char* line_end = ImFontCalcWordWrapPosition(font, scale, s, text_end, wrap_width, true);
+        entry->LineEnds.push_back((int)(line_end - text_begin));
+        s = CalcWordWrapNextLineStartA(line_end, text_end);
+    }
+    return entry;
+}
+
+void ImFontWrapCache::NewFrame()
+{
+    FrameCount++;
+    const int old_size = Entries.Size;
+    for (int n = Entries.Size - 1; n >= 0; n--)
+        if (FrameCount - Entries[n].LastFrameUsed > IM_FONT_WRAP_CACHE_MAX_UNUSED_FRAMES)
+        {
+            Entries[n].LineEnds.clear();
+            Entries.erase_unsorted(&Entries[n]);
+        }
+    if (Entries.Size == old_size)
+        return;
+
+    // Entries were moved: rebuild the map in a single sort
+    EntriesMap.Data.resize(0);
+    EntriesMap.Data.reserve(Entries.Size);
+    for (int n = 0; n < Entries.Size; n++)
+        EntriesMap.Data.push_back(ImGuiStoragePair(Entries[n].Key, n));
+    EntriesMap.BuildSortByKey();
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c)
 {
@@ -4138,26 +4342,42 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     const float origin_x = x;
     const bool word_wrap_enabled = (wrap_width > 0.0f);
 
+    // Long word-wrapped text: reuse line breaks computed in a previous frame
+    const ImFontWrapCacheEntry* wrap_cache = word_wrap_enabled ? draw_list->_Data->WrapCache.GetEntry(this, size, wrap_width, text_begin, text_end) : NULL;
+    int wrap_cache_line = 0;
+
     // Fast-forward to first visible line
     const char* s = text_begin;
     if (y + line_height < clip_rect.y)
-        while (y + line_height < clip_rect.y && s < text_end)
+    {
+        if (wrap_cache)
         {
-            const char* line_end = (const char*)ImMemchr(s, '\n', text_end - s);
-            if (word_wrap_enabled)
+            while (y + line_height < clip_rect.y && wrap_cache_line < wrap_cache->LineEnds.Size)
             {
-                // FIXME-OPT: This is not optimal as do first do a search for \n before calling CalcWordWrapPositionA().
-                // If the specs for CalcWordWrapPositionA() were reworked to optionally return on \n we could combine both.
-                // However it is still better than nothing performing the fast-forward!
-                s = CalcWordWrapPositionA(scale, s, line_end ? line_end : text_end, wrap_width);
-                s = CalcWordWrapNextLineStartA(s, text_end);
+                wrap_cache_line++;
+                y += line_height;
             }
-            else
+            if (wrap_cache_line > 0)
+                s = CalcWordWrapNextLineStartA(text_begin + wrap_cache->LineEnds[wrap_cache_line - 1], text_end);
+        }
+        else
+        {
+            while (y + line_height < clip_rect.y && s < text_end)
             {
-                s = line_end ? line_end + 1 : text_end;
+                if (word_wrap_enabled)
+                {
+                    s = ImFontCalcWordWrapPosition(this, scale, s, text_end, wrap_width, true);
+                    s = CalcWordWrapNextLineStartA(s, text_end);
+                }
+                else
+                {
+                    const char* line_end = (const char*)ImMemchr(s, '\n', text_end - s);
+                    s = line_end ? line_end + 1 : text_end;
+                }
+                y += line_height;
             }
-            y += line_height;
         }
+    }
 
     // For large text, scan for the last visible line in order to avoid over-reserving in the call to PrimReserve()
     // Note that very large horizontal line will still be affected by the issue (e.g. a one megabyte string buffer without a newline will likely crash atm)
@@ -4176,14 +4396,39 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (s == text_end)
         return;
 
-    // Reserve vertices for remaining worse case (over-reserving is useful and easily amortized)
-    const int vtx_count_max = (int)(text_end - s) * 4;
-    const int idx_count_max = (int)(text_end - s) * 6;
-    const int idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
-    draw_list->PrimReserve(idx_count_max, vtx_count_max);
-    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
-    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
-    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+    // Output glyph instances instead of vertices when the renderer supports them (16 bytes instead of 4 vertices + 6 indices per character).
+    // Glyphs of a command are drawn after its triangles, so text following other shapes needs a new draw command:
+    // we only switch for longer text, as short labels between frames/buttons would double the number of draw calls.
+    ImDrawCmd* draw_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+    const bool use_glyphs = (draw_list->Flags & ImDrawListFlags_GlyphInstances) && !cpu_fine_clip && scale == 1.0f && GlyphTableOffset >= 0
+        && ContainerAtlas == draw_list->_Data->GlyphTableAtlas && draw_list->_CmdHeader.TextureId == ContainerAtlas->TexID
+        && (draw_cmd->GlyphCount > 0 || draw_cmd->ElemCount == 0 || text_end - s >= 32);
+
+    // Reserve vertices or glyphs for remaining worse case (over-reserving is useful and easily amortized)
+    ImDrawVert*  vtx_write = NULL;
+    ImDrawIdx*   idx_write = NULL;
+    ImDrawGlyph* glyph_write = NULL;
+    unsigned int vtx_index = 0;
+    int idx_expected_size = 0;
+    int glyph_start = 0;
+    if (use_glyphs)
+    {
+        if (draw_cmd->ElemCount > 0 && draw_cmd->GlyphCount == 0)
+            draw_list->AddDrawCmd();
+        glyph_start = draw_list->GlyphBuffer.Size;
+        draw_list->GlyphBuffer.resize(glyph_start + (int)(text_end - s));
+        glyph_write = draw_list->GlyphBuffer.Data + glyph_start;
+    }
+    else
+    {
+        const int vtx_count_max = (int)(text_end - s) * 4;
+        const int idx_count_max = (int)(text_end - s) * 6;
+        idx_expected_size = draw_list->IdxBuffer.Size + idx_count_max;
+        draw_list->PrimReserve(idx_count_max, vtx_count_max);
+        vtx_write = draw_list->_VtxWritePtr;
+        idx_write = draw_list->_IdxWritePtr;
+        vtx_index = draw_list->_VtxCurrentIdx;
+    }
 
     const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
     const char* word_wrap_eol = NULL;
@@ -4193,8 +4438,9 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         if (word_wrap_enabled)
         {
             // Calculate how far we can render. Requires two passes on the string data but keeps the code simple and not intrusive for what's essentially an uncommon feature.
+            // The scan stops on '\n', which then ends the line through this same path.
             if (!word_wrap_eol)
-                word_wrap_eol = CalcWordWrapPositionA(scale, s, text_end, wrap_width - (x - origin_x));
+                word_wrap_eol = wrap_cache ? text_begin + wrap_cache->LineEnds[wrap_cache_line++] : ImFontCalcWordWrapPosition(this, scale, s, text_end, wrap_width - (x - origin_x), true);
 
             if (s >= word_wrap_eol)
             {
@@ -4282,8 +4528,15 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
                 // Support for untinted glyphs
                 ImU32 glyph_col = glyph->Colored ? col_untinted : col;
 
-                // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
+                // Glyph instance: the renderer reads X0/Y0/X1/Y1 and UV from the glyph table (scale is 1.0f)
+                if (glyph_write != NULL)
+                {
+                    glyph_write->Pos.x = x; glyph_write->Pos.y = y; glyph_write->Col = glyph_col; glyph_write->GlyphIndex = (ImU32)(GlyphTableOffset + (glyph - Glyphs.Data));
+                    glyph_write++;
+                }
+                else
                 {
+                    // We are NOT calling PrimRectUV() here because non-inlined causes too much overhead in a debug builds. Inlined here:
                     vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
                     vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
                     vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
@@ -4299,6 +4552,19 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
         x += char_width;
     }
 
+    if (glyph_write != NULL)
+    {
+        // Give back unused glyphs. Glyphs of the last command must stay contiguous with the end of GlyphBuffer[].
+        const int glyph_count = (int)(glyph_write - draw_list->GlyphBuffer.Data) - glyph_start;
+        draw_list->GlyphBuffer.Size = glyph_start + glyph_count;
+        draw_cmd = &draw_list->CmdBuffer.Data[draw_list->CmdBuffer.Size - 1];
+        if (draw_cmd->GlyphCount == 0)
+            draw_cmd->GlyphOffset = glyph_start;
+        IM_ASSERT(draw_cmd->GlyphOffset + draw_cmd->GlyphCount == (unsigned int)glyph_start);
+        draw_cmd->GlyphCount += glyph_count;
+        return;
+    }
+
     // Give back unused vertices (clipped ones, blanks) ~ this is essentially a PrimUnreserve() action.
     draw_list->VtxBuffer.Size = (int)(vtx_write - draw_list->VtxBuffer.Data); // Same as calling shrink()
     draw_list->IdxBuffer.Size = (int)(idx_write - draw_list->IdxBuffer.Data);
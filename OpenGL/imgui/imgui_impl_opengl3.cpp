@@ -6,6 +6,8 @@
 // Implemented features:
 //  [X] Renderer: User texture binding. Use 'GLuint' OpenGL texture identifier as void*/ImTextureID. Read the FAQ about ImTextureID!
 //  [x] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset) [Desktop OpenGL only!]
+//  [x] Renderer: Render-to-texture cache for windows using ImGuiWindowFlags_CachedRender.
+//  [x] Renderer: Text as instanced glyph quads (ImGuiBackendFlags_RendererHasGlyphInstances) [Desktop OpenGL 3.3+ and OpenGL ES 3.0+ only!]
 
 // About WebGL/ES:
 // - You need to '#define IMGUI_IMPL_OPENGL_ES2' or '#define IMGUI_IMPL_OPENGL_ES3' to use WebGL or OpenGL ES.
@@ -22,6 +24,11 @@
 
 // CHANGELOG
 // (minor and older changes stripped away, please see git history for details)
+//  2026-10-18: OpenGL: Draw glyph instances (ImGuiBackendFlags_RendererHasGlyphInstances) with one instanced quad per glyph, positioned and textured from a glyph table texture.
+//  2026-10-18: OpenGL: Keep vertex/index buffers per draw list and skip uploading lists unchanged since last frame. Added ImGui_ImplOpenGL3_HashDrawData(), ImGui_ImplOpenGL3_GetUploadStats().
+//  2026-10-18: OpenGL: Count draw calls, buffer uploads, texture binds, scissor and framebuffer binds of last frame. Added ImGui_ImplOpenGL3_GetCallStats().
+//  2026-10-18: OpenGL: Render cache for draw lists flagged with ImDrawListFlags_CachedRender (ImGuiWindowFlags_CachedRender). Added ImGui_ImplOpenGL3_GetRenderCacheStats().
+//  2026-10-18: OpenGL: Support compact vertex layout (IMGUI_USE_COMPACT_DRAWVERT). Upload 32-bit indices as 16-bit for draw lists with up to 64K vertices.
 //  2025-02-18: OpenGL: Lazily reinitialize embedded GL loader for when calling backend from e.g. other DLL boundaries. (#8406)
 //  2024-10-07: OpenGL: Changed default texture sampler to Clamp instead of Repeat/Wrap.
 //  2024-06-28: OpenGL: ImGui_ImplOpenGL3_NewFrame() recreates font texture if it has been destroyed by ImGui_ImplOpenGL3_DestroyFontsTexture(). (#7748)
@@ -119,6 +126,7 @@
 #include "imgui_impl_opengl3.h"
 #include <stdio.h>
 #include <stdint.h>     // intptr_t
+#include <math.h>       // floorf, ceilf, fminf, fmaxf
 #if defined(__APPLE__)
 #include <TargetConditionals.h>
 #endif
@@ -212,6 +220,11 @@
 #define IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
 #endif
 
+// Desktop GL 3.3+ and GL ES 3.0+ have glVertexAttribDivisor(), glDrawArraysInstanced(), integer attributes and texelFetch()
+#if !defined(IMGUI_IMPL_OPENGL_ES2) && (defined(IMGUI_IMPL_OPENGL_ES3) || defined(GL_VERSION_3_3))
+#define IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+#endif
+
 // [Debugging]
 //#define IMGUI_IMPL_OPENGL_DEBUG
 #ifdef IMGUI_IMPL_OPENGL_DEBUG
@@ -221,6 +234,31 @@
 #define GL_CALL(_CALL)      _CALL   // Call without error check
 #endif
 
+// Texture holding the rendering of a draw list, see ImGui_ImplOpenGL3_RenderDrawListCached()
+struct ImGui_ImplOpenGL3_RenderCacheEntry
+{
+    const ImDrawList* DrawList;
+    ImU64           Hash;                    // Hash of draw list contents on last frame
+    bool            Valid;                   // Texture holds contents matching Hash
+    GLuint          Framebuffer;
+    GLuint          Texture;
+    int             Width, Height;           // Texture size, in framebuffer pixels. 0 when nothing is visible.
+    ImVec2          Min, Max;                // Area covered by the texture, in Dear ImGui coordinates
+    float           FillPixels;              // Area of all triangles, in framebuffer pixels: what drawing the list directly costs in fill
+    int             LastFrameUsed;
+};
+
+// Vertex/index buffers of a draw list, uploaded only when contents change
+struct ImGui_ImplOpenGL3_DrawListBuffers
+{
+    const ImDrawList* DrawList;
+    ImU64           Hash;                    // Hash of uploaded contents
+    GLuint          VboHandle, ElementsHandle;
+    GLuint          GlyphsHandle;            // Created on first use
+    size_t          Bytes;
+    int             LastFrameUsed;
+};
+
 // OpenGL Data
 struct ImGui_ImplOpenGL3_Data
 {
@@ -243,6 +281,30 @@ struct ImGui_ImplOpenGL3_Data
     bool            HasPolygonMode;
     bool            HasClipOrigin;
     bool            UseBufferSubData;
+    ImVector<unsigned short> IdxNarrowBuffer; // 16-bit copy of 32-bit indices, when ImDrawIdx is 32-bit
+    bool            ClipOriginLowerLeft;
+    int             FrameCount;
+    ImVector<ImGui_ImplOpenGL3_RenderCacheEntry> RenderCache;
+    ImGui_ImplOpenGL3_RenderCacheStats RenderCacheStats;
+    ImVector<ImGui_ImplOpenGL3_DrawListBuffers> DrawListBuffers;
+    GLuint          BoundVboHandle;          // Buffers currently bound with vertex attributes setup, 0 if unknown
+    ImVector<ImU64> DrawListHashes;          // Output of ImGui_ImplOpenGL3_HashDrawData()
+    ImDrawData*     DrawListHashesData;
+    ImGui_ImplOpenGL3_UploadStats UploadStats;
+    ImGui_ImplOpenGL3_CallStats CallStats;
+    GLuint          GlyphShaderHandle;       // Program drawing ImDrawGlyph instances, 0 when not supported
+    GLint           GlyphAttribLocationTex;
+    GLint           GlyphAttribLocationTable;
+    GLint           GlyphAttribLocationProjMtx;
+    GLuint          GlyphAttribLocationPos;
+    GLuint          GlyphAttribLocationColor;
+    GLuint          GlyphAttribLocationIndex;
+    GLuint          GlyphsHandle;            // Streaming buffer for lists without their own buffers
+    GLuint          GlyphTableTexture;       // Two RGBA32F texels per glyph: X0,Y0,X1,Y1 then U0,V0,U1,V1
+    ImVector<float> GlyphTable;              // CPU copy of the glyph table, 8 floats per glyph
+    GLuint          GlyphVertexArray;        // Recreated every frame, like the main vertex array
+    ImVec2          ProjectionMin, ProjectionMax; // Last area passed to ImGui_ImplOpenGL3_SetupProjection()
+    ImDrawList*     GlyphExpandList;         // Lists with glyphs converted to vertices, when glyph instances can't be drawn
 
     ImGui_ImplOpenGL3_Data() { memset((void*)this, 0, sizeof(*this)); }
 };
@@ -410,6 +472,8 @@ void    ImGui_ImplOpenGL3_Shutdown()
     io.BackendRendererName = nullptr;
     io.BackendRendererUserData = nullptr;
     io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    if (bd->GlyphExpandList)
+        IM_DELETE(bd->GlyphExpandList);
     IM_DELETE(bd);
 }
 
@@ -426,6 +490,57 @@ void    ImGui_ImplOpenGL3_NewFrame()
         ImGui_ImplOpenGL3_CreateFontsTexture();
 }
 
+// Bind vertex/index buffers and setup attributes for ImDrawVert, when not already bound
+static void ImGui_ImplOpenGL3_BindBuffers(GLuint vbo_handle, GLuint elements_handle)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (bd->BoundVboHandle == vbo_handle)
+        return;
+    bd->BoundVboHandle = vbo_handle;
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, vbo_handle));
+    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, elements_handle));
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_SHORT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#else
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
+#endif
+    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
+}
+
+static void ImGui_ImplOpenGL3_SetupProjectionMatrix(GLint location, const ImVec2& min, const ImVec2& max, float P)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    float L = min.x;
+    float R = max.x;
+    float T = min.y;
+    float B = max.y;
+    if (!bd->ClipOriginLowerLeft) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
+    const float ortho_projection[4][4] =
+    {
+        { P*2.0f/(R-L), 0.0f,         0.0f,   0.0f },
+        { 0.0f,         P*2.0f/(T-B), 0.0f,   0.0f },
+        { 0.0f,         0.0f,        -1.0f,   0.0f },
+        { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
+    };
+    glUniformMatrix4fv(location, 1, GL_FALSE, &ortho_projection[0][0]);
+}
+
+// Map [min,max] (in Dear ImGui coordinates) to the current viewport. Program must be bound.
+static void ImGui_ImplOpenGL3_SetupProjection(const ImVec2& min, const ImVec2& max)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    bd->ProjectionMin = min;
+    bd->ProjectionMax = max;
+#ifdef IMGUI_USE_COMPACT_DRAWVERT
+    const float P = 1.0f / IM_DRAWVERT_POS_SCALE; // Vertex positions are fixed point, fold their scale into the projection
+#else
+    const float P = 1.0f;
+#endif
+    ImGui_ImplOpenGL3_SetupProjectionMatrix(bd->AttribLocationProjMtx, min, max, P);
+}
+
 static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_width, int fb_height, GLuint vertex_array_object)
 {
     ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
@@ -458,46 +573,613 @@ static void ImGui_ImplOpenGL3_SetupRenderState(ImDrawData* draw_data, int fb_wid
     }
 #endif
 
+#if defined(GL_CLIP_ORIGIN)
+    bd->ClipOriginLowerLeft = clip_origin_lower_left;
+#else
+    bd->ClipOriginLowerLeft = true;
+#endif
+
     // Setup viewport, orthographic projection matrix
     // Our visible imgui space lies from draw_data->DisplayPos (top left) to draw_data->DisplayPos+data_data->DisplaySize (bottom right). DisplayPos is (0,0) for single viewport apps.
     GL_CALL(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
-    float L = draw_data->DisplayPos.x;
-    float R = draw_data->DisplayPos.x + draw_data->DisplaySize.x;
-    float T = draw_data->DisplayPos.y;
-    float B = draw_data->DisplayPos.y + draw_data->DisplaySize.y;
-#if defined(GL_CLIP_ORIGIN)
-    if (!clip_origin_lower_left) { float tmp = T; T = B; B = tmp; } // Swap top and bottom if origin is upper left
-#endif
-    const float ortho_projection[4][4] =
-    {
-        { 2.0f/(R-L),   0.0f,         0.0f,   0.0f },
-        { 0.0f,         2.0f/(T-B),   0.0f,   0.0f },
-        { 0.0f,         0.0f,        -1.0f,   0.0f },
-        { (R+L)/(L-R),  (T+B)/(B-T),  0.0f,   1.0f },
-    };
     glUseProgram(bd->ShaderHandle);
     glUniform1i(bd->AttribLocationTex, 0);
-    glUniformMatrix4fv(bd->AttribLocationProjMtx, 1, GL_FALSE, &ortho_projection[0][0]);
+    ImGui_ImplOpenGL3_SetupProjection(draw_data->DisplayPos, ImVec2(draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y));
 
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
         glBindSampler(0, 0); // We use combined texture/sampler state. Applications using GL 3.3 and GL ES 3.0 may set that otherwise.
 #endif
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    // Glyph program: font atlas on texture unit 0 like the main program, glyph table on texture unit 1.
+    // Its attributes live in their own vertex array, so they don't disturb the ones setup for ImDrawVert.
+    if (bd->GlyphShaderHandle != 0)
+    {
+        glUseProgram(bd->GlyphShaderHandle);
+        glUniform1i(bd->GlyphAttribLocationTex, 0);
+        glUniform1i(bd->GlyphAttribLocationTable, 1);
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, bd->GlyphTableTexture);
+        glBindSampler(1, 0);
+        glActiveTexture(GL_TEXTURE0);
+        glBindVertexArray(bd->GlyphVertexArray);
+        GL_CALL(glEnableVertexAttribArray(bd->GlyphAttribLocationPos));
+        GL_CALL(glEnableVertexAttribArray(bd->GlyphAttribLocationColor));
+        GL_CALL(glEnableVertexAttribArray(bd->GlyphAttribLocationIndex));
+        glVertexAttribDivisor(bd->GlyphAttribLocationPos, 1);
+        glVertexAttribDivisor(bd->GlyphAttribLocationColor, 1);
+        glVertexAttribDivisor(bd->GlyphAttribLocationIndex, 1);
+        glUseProgram(bd->ShaderHandle);
+    }
+#endif
+
     (void)vertex_array_object;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     glBindVertexArray(vertex_array_object);
 #endif
 
     // Bind vertex/index buffers and setup attributes for ImDrawVert
-    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->VboHandle));
-    GL_CALL(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bd->ElementsHandle));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxPos));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxUV));
     GL_CALL(glEnableVertexAttribArray(bd->AttribLocationVtxColor));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxPos,   2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, pos)));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxUV,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, uv)));
-    GL_CALL(glVertexAttribPointer(bd->AttribLocationVtxColor, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ImDrawVert), (GLvoid*)offsetof(ImDrawVert, col)));
+    bd->BoundVboHandle = 0;
+    ImGui_ImplOpenGL3_BindBuffers(bd->VboHandle, bd->ElementsHandle);
+}
+
+static ImU64 ImGui_ImplOpenGL3_HashMemory(const void* data, size_t size, ImU64 seed)
+{
+    // Word-wise multiplicative hash. Only used to detect changes between frames.
+    // Four independent lanes, so that multiplications don't wait on each other.
+    const unsigned char* p = (const unsigned char*)data;
+    ImU64 h0 = seed ^ (size * 0x9E3779B97F4A7C15ULL), h1 = h0 + 1, h2 = h0 + 2, h3 = h0 + 3;
+    for (; size >= 32; size -= 32, p += 32)
+    {
+        ImU64 v[4];
+        memcpy(v, p, 32);
+        h0 = (h0 ^ v[0]) * 0xFF51AFD7ED558CCDULL; h0 ^= h0 >> 32;
+        h1 = (h1 ^ v[1]) * 0xFF51AFD7ED558CCDULL; h1 ^= h1 >> 32;
+        h2 = (h2 ^ v[2]) * 0xFF51AFD7ED558CCDULL; h2 ^= h2 >> 32;
+        h3 = (h3 ^ v[3]) * 0xFF51AFD7ED558CCDULL; h3 ^= h3 >> 32;
+    }
+    ImU64 h = h0 ^ (h1 * 0xC4CEB9FE1A85EC53ULL) ^ (h2 * 0x9E3779B97F4A7C15ULL) ^ (h3 * 0xFF51AFD7ED558CCDULL);
+    for (; size >= 8; size -= 8, p += 8)
+    {
+        ImU64 v;
+        memcpy(&v, p, 8);
+        h = (h ^ v) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    for (; size > 0; size--, p++)
+        h = (h ^ *p) * 0x100000001B3ULL;
+    return h;
+}
+
+// Return 0 for draw lists with user callbacks, which are never reused from a previous frame as callbacks may depend on external state.
+static ImU64 ImGui_ImplOpenGL3_HashDrawList(ImDrawData* draw_data, const ImDrawList* draw_list)
+{
+    const float display[6] = { draw_data->DisplayPos.x, draw_data->DisplayPos.y, draw_data->DisplaySize.x, draw_data->DisplaySize.y, draw_data->FramebufferScale.x, draw_data->FramebufferScale.y };
+    ImU64 h = ImGui_ImplOpenGL3_HashMemory(display, sizeof(display), 0);
+    h = ImGui_ImplOpenGL3_HashMemory(draw_list->VtxBuffer.Data, (size_t)draw_list->VtxBuffer.Size * sizeof(ImDrawVert), h);
+    h = ImGui_ImplOpenGL3_HashMemory(draw_list->IdxBuffer.Data, (size_t)draw_list->IdxBuffer.Size * sizeof(ImDrawIdx), h);
+    h = ImGui_ImplOpenGL3_HashMemory(draw_list->GlyphBuffer.Data, (size_t)draw_list->GlyphBuffer.Size * sizeof(ImDrawGlyph), h);
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.UserCallback != nullptr)
+            return 0;
+        // Hash fields individually, ImDrawCmd has padding
+        h = ImGui_ImplOpenGL3_HashMemory(&cmd.ClipRect, sizeof(cmd.ClipRect), h);
+        ImTextureID tex_id = cmd.GetTexID();
+        h = ImGui_ImplOpenGL3_HashMemory(&tex_id, sizeof(tex_id), h);
+        const unsigned int offsets[5] = { cmd.VtxOffset, cmd.IdxOffset, cmd.ElemCount, cmd.GlyphOffset, cmd.GlyphCount };
+        h = ImGui_ImplOpenGL3_HashMemory(offsets, sizeof(offsets), h);
+    }
+    return h ? h : 1;
+}
+
+void ImGui_ImplOpenGL3_HashDrawData(ImDrawData* draw_data)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    bd->DrawListHashes.resize(draw_data->CmdListsCount);
+    for (int n = 0; n < draw_data->CmdListsCount; n++)
+        bd->DrawListHashes[n] = ImGui_ImplOpenGL3_HashDrawList(draw_data, draw_data->CmdLists[n]);
+    bd->DrawListHashesData = draw_data;
+}
+
+// Per draw list vertex/index buffers, kept while the draw list is submitted
+static ImGui_ImplOpenGL3_DrawListBuffers* ImGui_ImplOpenGL3_GetDrawListBuffers(const ImDrawList* draw_list)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (ImGui_ImplOpenGL3_DrawListBuffers& it : bd->DrawListBuffers)
+        if (it.DrawList == draw_list)
+        {
+            it.LastFrameUsed = bd->FrameCount;
+            return &it;
+        }
+    bd->DrawListBuffers.resize(bd->DrawListBuffers.Size + 1);
+    ImGui_ImplOpenGL3_DrawListBuffers* buffers = &bd->DrawListBuffers.back();
+    memset((void*)buffers, 0, sizeof(*buffers));
+    buffers->DrawList = draw_list;
+    buffers->LastFrameUsed = bd->FrameCount;
+    GL_CALL(glGenBuffers(1, &buffers->VboHandle));
+    GL_CALL(glGenBuffers(1, &buffers->ElementsHandle));
+    return buffers;
+}
+
+static void ImGui_ImplOpenGL3_DestroyDrawListBuffers()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (ImGui_ImplOpenGL3_DrawListBuffers& buffers : bd->DrawListBuffers)
+    {
+        glDeleteBuffers(1, &buffers.VboHandle);
+        glDeleteBuffers(1, &buffers.ElementsHandle);
+        if (buffers.GlyphsHandle)
+            glDeleteBuffers(1, &buffers.GlyphsHandle);
+    }
+    bd->DrawListBuffers.clear();
+}
+
+// Destroy buffers of draw lists which haven't been submitted during the last frames (e.g. closed windows, tooltips)
+static void ImGui_ImplOpenGL3_GcDrawListBuffers()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int max_unused_frames = 60;
+    bd->UploadStats.BufferBytes = 0;
+    for (int n = 0; n < bd->DrawListBuffers.Size; n++)
+    {
+        ImGui_ImplOpenGL3_DrawListBuffers* buffers = &bd->DrawListBuffers[n];
+        if (buffers->LastFrameUsed < bd->FrameCount - max_unused_frames)
+        {
+            glDeleteBuffers(1, &buffers->VboHandle);
+            glDeleteBuffers(1, &buffers->ElementsHandle);
+            if (buffers->GlyphsHandle)
+                glDeleteBuffers(1, &buffers->GlyphsHandle);
+            bd->DrawListBuffers.erase(buffers);
+            n--;
+            continue;
+        }
+        bd->UploadStats.BufferBytes += buffers->Bytes;
+    }
+}
+
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+// Draw 'count' ImDrawGlyph starting at 'offset' in 'glyphs_handle', as one instanced triangle strip. Scissor and font texture must be set.
+static void ImGui_ImplOpenGL3_RenderGlyphs(GLuint glyphs_handle, unsigned int offset, unsigned int count, GLuint vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    glUseProgram(bd->GlyphShaderHandle);
+    ImGui_ImplOpenGL3_SetupProjectionMatrix(bd->GlyphAttribLocationProjMtx, bd->ProjectionMin, bd->ProjectionMax, 1.0f);
+    glBindVertexArray(bd->GlyphVertexArray);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, glyphs_handle));
+    const size_t base = (size_t)offset * sizeof(ImDrawGlyph);
+    GL_CALL(glVertexAttribPointer(bd->GlyphAttribLocationPos,    2, GL_FLOAT,         GL_FALSE, sizeof(ImDrawGlyph), (GLvoid*)(base + offsetof(ImDrawGlyph, Pos))));
+    GL_CALL(glVertexAttribPointer(bd->GlyphAttribLocationColor,  4, GL_UNSIGNED_BYTE, GL_TRUE,  sizeof(ImDrawGlyph), (GLvoid*)(base + offsetof(ImDrawGlyph, Col))));
+    GL_CALL(glVertexAttribIPointer(bd->GlyphAttribLocationIndex, 1, GL_UNSIGNED_INT,            sizeof(ImDrawGlyph), (GLvoid*)(base + offsetof(ImDrawGlyph, GlyphIndex))));
+    bd->CallStats.FrameDrawCalls++;
+    GL_CALL(glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, (GLsizei)count));
+
+    // Back to ImDrawVert state. GL_ARRAY_BUFFER isn't part of vertex array state, rebind it for ImGui_ImplOpenGL3_BindBuffers().
+    glBindVertexArray(vertex_array_object);
+    GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->BoundVboHandle));
+    glUseProgram(bd->ShaderHandle);
+}
+#endif
+
+// Upload and draw one draw list. Scissor rectangles are projected with clip_off/clip_scale into a render target of height fb_height.
+// 'hash' is the value returned by ImGui_ImplOpenGL3_HashDrawList(): lists with the same hash as on last frame are drawn from their buffers without upload.
+static void ImGui_ImplOpenGL3_RenderDrawList(ImDrawData* draw_data, const ImDrawList* draw_list, ImU64 hash, int fb_width, int fb_height, GLuint vertex_array_object, const ImVec2& clip_off, const ImVec2& clip_scale)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+
+    // Upload vertex/index buffers
+    // - OpenGL drivers are in a very sorry state nowadays....
+    //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
+    //   of leaks on Intel GPU when using multi-viewports on Windows.
+    // - After this we kept hearing of various display corruptions issues. We started disabling on non-Intel GPU, but issues still got reported on Intel.
+    // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
+    //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
+    // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
+    // - With 32-bit ImDrawIdx, draw lists with up to 64K vertices (most of them) get their indices narrowed to 16-bit, halving index upload size.
+    // - Each draw list has its own buffers, which are only uploaded when contents changed since last frame.
+    //   Lists with user callbacks (hash 0) use the shared streaming buffers, which ImDrawCallback_ResetRenderState rebinds.
+    GLenum idx_type = sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+    int idx_stride = (int)sizeof(ImDrawIdx);
+    if (sizeof(ImDrawIdx) == 4 && draw_list->VtxBuffer.Size <= 0x10000)
+    {
+        idx_type = GL_UNSIGNED_SHORT;
+        idx_stride = 2;
+    }
+    const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
+    const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * idx_stride;
+    const GLsizeiptr glyph_buffer_size = (GLsizeiptr)draw_list->GlyphBuffer.Size * (int)sizeof(ImDrawGlyph);
+    ImGui_ImplOpenGL3_DrawListBuffers* buffers = (hash != 0) ? ImGui_ImplOpenGL3_GetDrawListBuffers(draw_list) : nullptr;
+    if (buffers)
+        ImGui_ImplOpenGL3_BindBuffers(buffers->VboHandle, buffers->ElementsHandle);
+    else
+        ImGui_ImplOpenGL3_BindBuffers(bd->VboHandle, bd->ElementsHandle);
+    const bool upload = (buffers == nullptr || buffers->Hash != hash);
+    const GLvoid* idx_buffer_data = (const GLvoid*)draw_list->IdxBuffer.Data;
+    if (upload && idx_stride != (int)sizeof(ImDrawIdx))
+    {
+        bd->IdxNarrowBuffer.resize(draw_list->IdxBuffer.Size);
+        for (int idx_n = 0; idx_n < draw_list->IdxBuffer.Size; idx_n++)
+            bd->IdxNarrowBuffer.Data[idx_n] = (unsigned short)draw_list->IdxBuffer.Data[idx_n];
+        idx_buffer_data = (const GLvoid*)bd->IdxNarrowBuffer.Data;
+    }
+    if (!upload)
+    {
+        bd->UploadStats.FrameListsReused++;
+        bd->UploadStats.FrameBytesReused += (size_t)(vtx_buffer_size + idx_buffer_size + glyph_buffer_size);
+    }
+    else if (buffers)
+    {
+        bd->CallStats.FrameBufferUploads += 2;
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STATIC_DRAW));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, idx_buffer_data, GL_STATIC_DRAW));
+        buffers->Hash = hash;
+        buffers->Bytes = (size_t)(vtx_buffer_size + idx_buffer_size + glyph_buffer_size);
+    }
+    else if (bd->UseBufferSubData)
+    {
+        if (bd->VertexBufferSize < vtx_buffer_size)
+        {
+            bd->VertexBufferSize = vtx_buffer_size;
+            bd->CallStats.FrameBufferUploads++;
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
+        }
+        if (bd->IndexBufferSize < idx_buffer_size)
+        {
+            bd->IndexBufferSize = idx_buffer_size;
+            bd->CallStats.FrameBufferUploads++;
+            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
+        }
+        bd->CallStats.FrameBufferUploads += 2;
+        GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data));
+        GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, idx_buffer_data));
+    }
+    else
+    {
+        bd->CallStats.FrameBufferUploads += 2;
+        GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
+        GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, idx_buffer_data, GL_STREAM_DRAW));
+    }
+    GLuint glyphs_handle = 0;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    if (glyph_buffer_size > 0)
+    {
+        if (buffers && buffers->GlyphsHandle == 0)
+            GL_CALL(glGenBuffers(1, &buffers->GlyphsHandle));
+        glyphs_handle = buffers ? buffers->GlyphsHandle : bd->GlyphsHandle;
+        if (upload)
+        {
+            bd->CallStats.FrameBufferUploads++;
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, glyphs_handle));
+            GL_CALL(glBufferData(GL_ARRAY_BUFFER, glyph_buffer_size, (const GLvoid*)draw_list->GlyphBuffer.Data, buffers ? GL_STATIC_DRAW : GL_STREAM_DRAW));
+            GL_CALL(glBindBuffer(GL_ARRAY_BUFFER, bd->BoundVboHandle));
+        }
+    }
+#endif
+    if (upload)
+    {
+        bd->UploadStats.FrameListsUploaded++;
+        bd->UploadStats.FrameBytesUploaded += (size_t)(vtx_buffer_size + idx_buffer_size + glyph_buffer_size);
+    }
+
+    for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+    {
+        const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+        if (pcmd->UserCallback != nullptr)
+        {
+            // User callback, registered via ImDrawList::AddCallback()
+            // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+            if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
+                ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
+            else
+                pcmd->UserCallback(draw_list, pcmd);
+            bd->BoundVboHandle = 0; // Callback may have bound other buffers
+        }
+        else
+        {
+            // Project scissor/clipping rectangles into framebuffer space
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+
+            // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
+            GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
+
+            // Bind texture, Draw
+            GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
+            bd->CallStats.FrameScissorCalls++;
+            bd->CallStats.FrameTextureBinds++;
+            if (pcmd->ElemCount > 0)
+            {
+                bd->CallStats.FrameDrawCalls++;
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
+                if (bd->GlVersion >= 320)
+                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_stride), (GLint)pcmd->VtxOffset));
+                else
+#endif
+                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, idx_type, (void*)(intptr_t)(pcmd->IdxOffset * idx_stride)));
+            }
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+            if (pcmd->GlyphCount > 0)
+                ImGui_ImplOpenGL3_RenderGlyphs(glyphs_handle, pcmd->GlyphOffset, pcmd->GlyphCount, vertex_array_object);
+#endif
+        }
+    }
+    IM_UNUSED(glyphs_handle);
+}
+
+// Render cache for draw lists flagged with ImDrawListFlags_CachedRender (see ImGuiWindowFlags_CachedRender)
+// - A draw list whose contents are identical during two consecutive frames gets rendered into a texture, which is then composited as a single quad
+//   for as long as contents stay identical. Contents changing on every frame are drawn directly, and never pay for the extra render target pass.
+// - Dear ImGui still submits and tessellates the window every frame: this saves vertex upload and rasterization, not CPU time.
+// - The texture holds premultiplied alpha: drawing with our regular blending over a transparent target yields premultiplied colors, composited with (ONE, ONE_MINUS_SRC_ALPHA).
+static void ImGui_ImplOpenGL3_DestroyRenderCacheEntry(ImGui_ImplOpenGL3_RenderCacheEntry* entry)
+{
+    if (entry->Framebuffer) { glDeleteFramebuffers(1, &entry->Framebuffer); entry->Framebuffer = 0; }
+    if (entry->Texture)     { glDeleteTextures(1, &entry->Texture); entry->Texture = 0; }
+    entry->Width = entry->Height = 0;
+    entry->Valid = false;
+}
+
+static void ImGui_ImplOpenGL3_DestroyRenderCache()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    for (ImGui_ImplOpenGL3_RenderCacheEntry& entry : bd->RenderCache)
+        ImGui_ImplOpenGL3_DestroyRenderCacheEntry(&entry);
+    bd->RenderCache.clear();
+}
+
+// Destroy textures of draw lists which haven't been flagged for caching during the last frames (window hidden, closed, or interacted with)
+static void ImGui_ImplOpenGL3_GcRenderCache()
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const int max_unused_frames = 60;
+    bd->RenderCacheStats.CachedTextures = 0;
+    bd->RenderCacheStats.CachedTextureBytes = 0;
+    for (int n = 0; n < bd->RenderCache.Size; n++)
+    {
+        ImGui_ImplOpenGL3_RenderCacheEntry* entry = &bd->RenderCache[n];
+        if (entry->LastFrameUsed < bd->FrameCount - max_unused_frames)
+        {
+            ImGui_ImplOpenGL3_DestroyRenderCacheEntry(entry);
+            bd->RenderCache.erase(entry);
+            n--;
+            continue;
+        }
+        if (entry->Texture)
+        {
+            bd->RenderCacheStats.CachedTextures++;
+            bd->RenderCacheStats.CachedTextureBytes += (size_t)entry->Width * entry->Height * 4;
+        }
+    }
+}
+
+// Render draw list into the entry texture, covering the area of its vertices within its clipping rectangles. Return false if the render target can't be created.
+static bool ImGui_ImplOpenGL3_FillRenderCacheEntry(ImGui_ImplOpenGL3_RenderCacheEntry* entry, ImDrawData* draw_data, const ImDrawList* draw_list, ImU64 hash, int fb_width, int fb_height, GLuint vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    const ImVec2 clip_off = draw_data->DisplayPos;
+    const ImVec2 clip_scale = draw_data->FramebufferScale;
+
+    // Calculate covered area, snapped to framebuffer pixels so the texture maps 1:1 to the framebuffer.
+    // Also accumulate the area of triangles, which is what drawing the list directly costs in fill.
+    ImVec4 clip_bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    ImVec4 vtx_bb(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
+    float fill_area = 0.0f;
+    for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+    {
+        if (cmd.ClipRect.z <= cmd.ClipRect.x || cmd.ClipRect.w <= cmd.ClipRect.y || (cmd.ElemCount == 0 && cmd.GlyphCount == 0))
+            continue;
+        clip_bb = ImVec4(fminf(clip_bb.x, cmd.ClipRect.x), fminf(clip_bb.y, cmd.ClipRect.y), fmaxf(clip_bb.z, cmd.ClipRect.z), fmaxf(clip_bb.w, cmd.ClipRect.w));
+        const ImDrawIdx* idx = draw_list->IdxBuffer.Data + cmd.IdxOffset;
+        const ImDrawVert* vtx = draw_list->VtxBuffer.Data + cmd.VtxOffset;
+        for (unsigned int idx_n = 0; idx_n + 2 < cmd.ElemCount; idx_n += 3)
+        {
+            const ImVec2 a(vtx[idx[idx_n]].pos.x, vtx[idx[idx_n]].pos.y);
+            const ImVec2 b(vtx[idx[idx_n + 1]].pos.x, vtx[idx[idx_n + 1]].pos.y);
+            const ImVec2 c(vtx[idx[idx_n + 2]].pos.x, vtx[idx[idx_n + 2]].pos.y);
+            const float area = ((b.x - a.x) * (c.y - a.y) - (c.x - a.x) * (b.y - a.y)) * 0.5f;
+            fill_area += area < 0.0f ? -area : area;
+            vtx_bb = ImVec4(fminf(vtx_bb.x, fminf(a.x, fminf(b.x, c.x))), fminf(vtx_bb.y, fminf(a.y, fminf(b.y, c.y))), fmaxf(vtx_bb.z, fmaxf(a.x, fmaxf(b.x, c.x))), fmaxf(vtx_bb.w, fmaxf(a.y, fmaxf(b.y, c.y))));
+        }
+        for (unsigned int glyph_n = 0; glyph_n < cmd.GlyphCount; glyph_n++)
+        {
+            const ImDrawGlyph& glyph = draw_list->GlyphBuffer.Data[cmd.GlyphOffset + glyph_n];
+            if ((int)glyph.GlyphIndex * 8 + 8 > bd->GlyphTable.Size)
+                continue;
+            const float* rect = &bd->GlyphTable.Data[glyph.GlyphIndex * 8];
+            const ImVec2 a(glyph.Pos.x + rect[0], glyph.Pos.y + rect[1]);
+            const ImVec2 b(glyph.Pos.x + rect[2], glyph.Pos.y + rect[3]);
+            fill_area += (b.x - a.x) * (b.y - a.y);
+            vtx_bb = ImVec4(fminf(vtx_bb.x, a.x), fminf(vtx_bb.y, a.y), fmaxf(vtx_bb.z, b.x), fmaxf(vtx_bb.w, b.y));
+        }
+    }
+    const float px_min_x = fmaxf(floorf((fmaxf(vtx_bb.x, clip_bb.x) - clip_off.x) * clip_scale.x), 0.0f);
+    const float px_min_y = fmaxf(floorf((fmaxf(vtx_bb.y, clip_bb.y) - clip_off.y) * clip_scale.y), 0.0f);
+    const float px_max_x = fminf(ceilf((fminf(vtx_bb.z, clip_bb.z) - clip_off.x) * clip_scale.x), (float)fb_width);
+    const float px_max_y = fminf(ceilf((fminf(vtx_bb.w, clip_bb.w) - clip_off.y) * clip_scale.y), (float)fb_height);
+    const int width = (px_max_x > px_min_x) ? (int)(px_max_x - px_min_x) : 0;
+    const int height = (px_max_y > px_min_y) ? (int)(px_max_y - px_min_y) : 0;
+    entry->Min = ImVec2(px_min_x / clip_scale.x + clip_off.x, px_min_y / clip_scale.y + clip_off.y);
+    entry->Max = ImVec2(entry->Min.x + width / clip_scale.x, entry->Min.y + height / clip_scale.y);
+    entry->FillPixels = fill_area * clip_scale.x * clip_scale.y;
+    entry->Valid = true;
+    if (width == 0 || height == 0)
+    {
+        ImGui_ImplOpenGL3_DestroyRenderCacheEntry(entry);
+        entry->Valid = true; // Nothing visible, nothing to composite
+        return true;
+    }
+
+    // (Re)create render target
+    if (entry->Texture == 0 || entry->Width != width || entry->Height != height)
+    {
+        ImGui_ImplOpenGL3_DestroyRenderCacheEntry(entry);
+        GL_CALL(glGenTextures(1, &entry->Texture));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, entry->Texture));
+        bd->CallStats.FrameTextureBinds++;
+        bd->CallStats.FrameFramebufferBinds++;
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+        GL_CALL(glGenFramebuffers(1, &entry->Framebuffer));
+        GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, entry->Framebuffer));
+        GL_CALL(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, entry->Texture, 0));
+        entry->Width = width;
+        entry->Height = height;
+    }
+
+    // Render into texture
+    GLint last_framebuffer; glGetIntegerv(GL_FRAMEBUFFER_BINDING, &last_framebuffer);
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, entry->Framebuffer));
+    bd->CallStats.FrameFramebufferBinds += 2; // And back
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)last_framebuffer));
+        ImGui_ImplOpenGL3_DestroyRenderCacheEntry(entry);
+        return false;
+    }
+    GL_CALL(glViewport(0, 0, (GLsizei)width, (GLsizei)height));
+    glDisable(GL_SCISSOR_TEST);
+#if defined(IMGUI_IMPL_OPENGL_ES2)
+    GLfloat last_clear_color[4]; glGetFloatv(GL_COLOR_CLEAR_VALUE, last_clear_color);
+    glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glClearColor(last_clear_color[0], last_clear_color[1], last_clear_color[2], last_clear_color[3]);
+#else
+    const GLfloat transparent[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    glClearBufferfv(GL_COLOR, 0, transparent);
+#endif
+    glEnable(GL_SCISSOR_TEST);
+    ImGui_ImplOpenGL3_SetupProjection(entry->Min, entry->Max);
+    ImGui_ImplOpenGL3_RenderDrawList(draw_data, draw_list, hash, width, height, vertex_array_object, ImVec2(entry->Min.x, entry->Min.y), clip_scale);
+
+    // Restore target
+    GL_CALL(glBindFramebuffer(GL_FRAMEBUFFER, (GLuint)last_framebuffer));
+    GL_CALL(glViewport(0, 0, (GLsizei)fb_width, (GLsizei)fb_height));
+    ImGui_ImplOpenGL3_SetupProjection(draw_data->DisplayPos, ImVec2(draw_data->DisplayPos.x + draw_data->DisplaySize.x, draw_data->DisplayPos.y + draw_data->DisplaySize.y));
+    return true;
+}
+
+static void ImGui_ImplOpenGL3_CompositeRenderCacheEntry(const ImGui_ImplOpenGL3_RenderCacheEntry* entry, ImDrawData* draw_data, int fb_height)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    if (entry->Texture == 0)
+        return;
+
+    // Texture rows are stored bottom-up, unless the projection was flipped for glClipControl(GL_UPPER_LEFT)
+    const float uv_top = bd->ClipOriginLowerLeft ? 1.0f : 0.0f;
+    const float uv_bottom = 1.0f - uv_top;
+    ImDrawVert vtx[4];
+    vtx[0].pos.x = entry->Min.x; vtx[0].pos.y = entry->Min.y; vtx[0].uv.x = 0.0f; vtx[0].uv.y = uv_top;    vtx[0].col = IM_COL32_WHITE;
+    vtx[1].pos.x = entry->Max.x; vtx[1].pos.y = entry->Min.y; vtx[1].uv.x = 1.0f; vtx[1].uv.y = uv_top;    vtx[1].col = IM_COL32_WHITE;
+    vtx[2].pos.x = entry->Max.x; vtx[2].pos.y = entry->Max.y; vtx[2].uv.x = 1.0f; vtx[2].uv.y = uv_bottom; vtx[2].col = IM_COL32_WHITE;
+    vtx[3].pos.x = entry->Min.x; vtx[3].pos.y = entry->Max.y; vtx[3].uv.x = 0.0f; vtx[3].uv.y = uv_bottom; vtx[3].col = IM_COL32_WHITE;
+    const unsigned short idx[6] = { 0, 1, 2, 0, 2, 3 };
+    ImGui_ImplOpenGL3_BindBuffers(bd->VboHandle, bd->ElementsHandle);
+    GL_CALL(glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)sizeof(vtx), (const GLvoid*)vtx, GL_STREAM_DRAW));
+    GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr)sizeof(idx), (const GLvoid*)idx, GL_STREAM_DRAW));
+    if (bd->UseBufferSubData)
+        bd->VertexBufferSize = bd->IndexBufferSize = 0; // Buffers were reallocated to a smaller size
+
+    const int px_x = (int)((entry->Min.x - draw_data->DisplayPos.x) * draw_data->FramebufferScale.x + 0.5f);
+    const int px_y = (int)((entry->Min.y - draw_data->DisplayPos.y) * draw_data->FramebufferScale.y + 0.5f);
+    GL_CALL(glScissor(px_x, fb_height - px_y - entry->Height, entry->Width, entry->Height));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, entry->Texture));
+    bd->CallStats.FrameBufferUploads += 2;
+    bd->CallStats.FrameScissorCalls++;
+    bd->CallStats.FrameTextureBinds++;
+    bd->CallStats.FrameDrawCalls++;
+    glBlendFuncSeparate(GL_ONE, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    GL_CALL(glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, (void*)0));
+    glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+static void ImGui_ImplOpenGL3_RenderDrawListCached(ImDrawData* draw_data, const ImDrawList* draw_list, ImU64 hash, int fb_width, int fb_height, GLuint vertex_array_object)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    ImGui_ImplOpenGL3_RenderCacheStats& stats = bd->RenderCacheStats;
+
+    ImGui_ImplOpenGL3_RenderCacheEntry* entry = nullptr;
+    for (ImGui_ImplOpenGL3_RenderCacheEntry& it : bd->RenderCache)
+        if (it.DrawList == draw_list)
+            entry = &it;
+    if (hash == 0)
+    {
+        if (entry)
+        {
+            ImGui_ImplOpenGL3_DestroyRenderCacheEntry(entry);
+            bd->RenderCache.erase(entry);
+        }
+        ImGui_ImplOpenGL3_RenderDrawList(draw_data, draw_list, hash, fb_width, fb_height, vertex_array_object, draw_data->DisplayPos, draw_data->FramebufferScale);
+        return;
+    }
+    if (entry == nullptr)
+    {
+        bd->RenderCache.resize(bd->RenderCache.Size + 1);
+        entry = &bd->RenderCache.back();
+        memset((void*)entry, 0, sizeof(*entry));
+        entry->DrawList = draw_list;
+    }
+    entry->LastFrameUsed = bd->FrameCount;
+
+    // Contents changed since last frame: draw directly, and wait for contents to be stable before paying for a render to texture.
+    if (entry->Hash != hash)
+    {
+        entry->Hash = hash;
+        entry->Valid = false;
+        stats.FrameMisses++;
+        stats.TotalMisses++;
+        ImGui_ImplOpenGL3_RenderDrawList(draw_data, draw_list, hash, fb_width, fb_height, vertex_array_object, draw_data->DisplayPos, draw_data->FramebufferScale);
+        return;
+    }
+
+    // Contents identical to last frame: render to texture once, then composite until contents change.
+    if (!entry->Valid)
+    {
+        stats.FrameMisses++;
+        stats.TotalMisses++;
+        if (!ImGui_ImplOpenGL3_FillRenderCacheEntry(entry, draw_data, draw_list, hash, fb_width, fb_height, vertex_array_object))
+        {
+            ImGui_ImplOpenGL3_RenderDrawList(draw_data, draw_list, hash, fb_width, fb_height, vertex_array_object, draw_data->DisplayPos, draw_data->FramebufferScale);
+            return;
+        }
+    }
+    else
+    {
+        stats.FrameHits++;
+        stats.TotalHits++;
+        stats.FrameFillPixelsSaved += entry->FillPixels - (float)(entry->Width * entry->Height);
+    }
+    ImGui_ImplOpenGL3_CompositeRenderCacheEntry(entry, draw_data, fb_height);
+}
+
+void ImGui_ImplOpenGL3_GetUploadStats(ImGui_ImplOpenGL3_UploadStats* out_stats)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    *out_stats = bd->UploadStats;
+}
+
+void ImGui_ImplOpenGL3_GetRenderCacheStats(ImGui_ImplOpenGL3_RenderCacheStats* out_stats)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    *out_stats = bd->RenderCacheStats;
+}
+
+void ImGui_ImplOpenGL3_GetCallStats(ImGui_ImplOpenGL3_CallStats* out_stats)
+{
+    ImGui_ImplOpenGL3_Data* bd = ImGui_ImplOpenGL3_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplOpenGL3_Init()?");
+    *out_stats = bd->CallStats;
 }
 
 // OpenGL3 Render function.
@@ -522,6 +1204,16 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLuint last_texture; glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture);
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     GLuint last_sampler; if (bd->GlVersion >= 330 || bd->GlProfileIsES3) { glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler); } else { last_sampler = 0; }
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    GLuint last_texture_1 = 0, last_sampler_1 = 0;
+    if (bd->GlyphShaderHandle != 0)
+    {
+        glActiveTexture(GL_TEXTURE1);
+        glGetIntegerv(GL_TEXTURE_BINDING_2D, (GLint*)&last_texture_1);
+        glGetIntegerv(GL_SAMPLER_BINDING, (GLint*)&last_sampler_1);
+        glActiveTexture(GL_TEXTURE0);
+    }
 #endif
     GLuint last_array_buffer; glGetIntegerv(GL_ARRAY_BUFFER_BINDING, (GLint*)&last_array_buffer);
 #ifndef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -560,6 +1252,10 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     GLuint vertex_array_object = 0;
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glGenVertexArrays(1, &vertex_array_object));
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    if (bd->GlyphShaderHandle != 0)
+        GL_CALL(glGenVertexArrays(1, &bd->GlyphVertexArray));
 #endif
     ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
 
@@ -568,80 +1264,48 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
     ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
 
     // Render command lists
+    // Use hashes from ImGui_ImplOpenGL3_HashDrawData() when it was called for this draw data, otherwise hash lists as we go.
+    bd->FrameCount++;
+    bd->RenderCacheStats.FrameHits = bd->RenderCacheStats.FrameMisses = 0;
+    bd->RenderCacheStats.FrameFillPixelsSaved = 0.0f;
+    bd->UploadStats.FrameListsUploaded = bd->UploadStats.FrameListsReused = 0;
+    bd->UploadStats.FrameBytesUploaded = bd->UploadStats.FrameBytesReused = 0;
+    memset(&bd->CallStats, 0, sizeof(bd->CallStats));
+    const bool hashes_ready = (bd->DrawListHashesData == draw_data && bd->DrawListHashes.Size == draw_data->CmdListsCount);
+    bd->DrawListHashesData = nullptr;
     for (int n = 0; n < draw_data->CmdListsCount; n++)
     {
         const ImDrawList* draw_list = draw_data->CmdLists[n];
-
-        // Upload vertex/index buffers
-        // - OpenGL drivers are in a very sorry state nowadays....
-        //   During 2021 we attempted to switch from glBufferData() to orphaning+glBufferSubData() following reports
-        //   of leaks on Intel GPU when using multi-viewports on Windows.
-        // - After this we kept hearing of various display corruptions issues. We started disabling on non-Intel GPU, but issues still got reported on Intel.
-        // - We are now back to using exclusively glBufferData(). So bd->UseBufferSubData IS ALWAYS FALSE in this code.
-        //   We are keeping the old code path for a while in case people finding new issues may want to test the bd->UseBufferSubData path.
-        // - See https://github.com/ocornut/imgui/issues/4468 and please report any corruption issues.
-        const GLsizeiptr vtx_buffer_size = (GLsizeiptr)draw_list->VtxBuffer.Size * (int)sizeof(ImDrawVert);
-        const GLsizeiptr idx_buffer_size = (GLsizeiptr)draw_list->IdxBuffer.Size * (int)sizeof(ImDrawIdx);
-        if (bd->UseBufferSubData)
+        ImU64 hash = hashes_ready ? bd->DrawListHashes[n] : ImGui_ImplOpenGL3_HashDrawList(draw_data, draw_list);
+        if (draw_list->GlyphBuffer.Size > 0 && bd->GlyphShaderHandle == 0)
         {
-            if (bd->VertexBufferSize < vtx_buffer_size)
-            {
-                bd->VertexBufferSize = vtx_buffer_size;
-                GL_CALL(glBufferData(GL_ARRAY_BUFFER, bd->VertexBufferSize, nullptr, GL_STREAM_DRAW));
-            }
-            if (bd->IndexBufferSize < idx_buffer_size)
-            {
-                bd->IndexBufferSize = idx_buffer_size;
-                GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, bd->IndexBufferSize, nullptr, GL_STREAM_DRAW));
-            }
-            GL_CALL(glBufferSubData(GL_ARRAY_BUFFER, 0, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data));
-            GL_CALL(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data));
+            // Glyph instances without glyph program (e.g. ImGuiBackendFlags_RendererHasGlyphInstances set by the application on GL 3.2): draw as vertices, through streaming buffers
+            if (bd->GlyphExpandList == nullptr)
+                bd->GlyphExpandList = IM_NEW(ImDrawList)(draw_list->_Data);
+            draw_list->ExpandGlyphsTo(bd->GlyphExpandList);
+            draw_list = bd->GlyphExpandList;
+            hash = 0;
         }
+        if (draw_list->Flags & ImDrawListFlags_CachedRender)
+            ImGui_ImplOpenGL3_RenderDrawListCached(draw_data, draw_list, hash, fb_width, fb_height, vertex_array_object);
         else
-        {
-            GL_CALL(glBufferData(GL_ARRAY_BUFFER, vtx_buffer_size, (const GLvoid*)draw_list->VtxBuffer.Data, GL_STREAM_DRAW));
-            GL_CALL(glBufferData(GL_ELEMENT_ARRAY_BUFFER, idx_buffer_size, (const GLvoid*)draw_list->IdxBuffer.Data, GL_STREAM_DRAW));
-        }
-
-        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
-        {
-            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
-            if (pcmd->UserCallback != nullptr)
-            {
-                // User callback, registered via ImDrawList::AddCallback()
-                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
-                if (pcmd->UserCallback == ImDrawCallback_ResetRenderState)
-                    ImGui_ImplOpenGL3_SetupRenderState(draw_data, fb_width, fb_height, vertex_array_object);
-                else
-                    pcmd->UserCallback(draw_list, pcmd);
-            }
-            else
-            {
-                // Project scissor/clipping rectangles into framebuffer space
-                ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
-                ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
-                if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
-                    continue;
-
-                // Apply scissor/clipping rectangle (Y is inverted in OpenGL)
-                GL_CALL(glScissor((int)clip_min.x, (int)((float)fb_height - clip_max.y), (int)(clip_max.x - clip_min.x), (int)(clip_max.y - clip_min.y)));
-
-                // Bind texture, Draw
-                GL_CALL(glBindTexture(GL_TEXTURE_2D, (GLuint)(intptr_t)pcmd->GetTexID()));
-#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_VTX_OFFSET
-                if (bd->GlVersion >= 320)
-                    GL_CALL(glDrawElementsBaseVertex(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx)), (GLint)pcmd->VtxOffset));
-                else
-#endif
-                GL_CALL(glDrawElements(GL_TRIANGLES, (GLsizei)pcmd->ElemCount, sizeof(ImDrawIdx) == 2 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT, (void*)(intptr_t)(pcmd->IdxOffset * sizeof(ImDrawIdx))));
-            }
-        }
+            ImGui_ImplOpenGL3_RenderDrawList(draw_data, draw_list, hash, fb_width, fb_height, vertex_array_object, clip_off, clip_scale);
     }
 
+    ImGui_ImplOpenGL3_GcRenderCache();
+    ImGui_ImplOpenGL3_GcDrawListBuffers();
+
     // Destroy the temporary VAO
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
     GL_CALL(glDeleteVertexArrays(1, &vertex_array_object));
 #endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    if (bd->GlyphVertexArray != 0)
+    {
+        GL_CALL(glDeleteVertexArrays(1, &bd->GlyphVertexArray));
+        bd->GlyphVertexArray = 0;
+    }
+#endif
 
     // Restore modified GL state
     // This "glIsProgram()" check is required because if the program is "pending deletion" at the time of binding backup, it will have been deleted by now and will cause an OpenGL error. See #6220.
@@ -650,6 +1314,14 @@ void    ImGui_ImplOpenGL3_RenderDrawData(ImDrawData* draw_data)
 #ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_BIND_SAMPLER
     if (bd->GlVersion >= 330 || bd->GlProfileIsES3)
         glBindSampler(0, last_sampler);
+#endif
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    if (bd->GlyphShaderHandle != 0)
+    {
+        glActiveTexture(GL_TEXTURE1);
+        glBindTexture(GL_TEXTURE_2D, last_texture_1);
+        glBindSampler(1, last_sampler_1);
+    }
 #endif
     glActiveTexture(last_active_texture);
 #ifdef IMGUI_IMPL_OPENGL_USE_VERTEX_ARRAY
@@ -711,6 +1383,31 @@ bool ImGui_ImplOpenGL3_CreateFontsTexture()
     // Store identifier
     io.Fonts->SetTexID((ImTextureID)(intptr_t)bd->FontTexture);
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    // Upload glyph table, indexed by ImDrawGlyph::GlyphIndex (see ImFont::GlyphTableOffset). 512 glyphs per row.
+    const int glyph_count = io.Fonts->GlyphTableSize;
+    if (bd->GlyphShaderHandle != 0 && glyph_count > 0)
+    {
+        const int table_width = (glyph_count < 512) ? glyph_count : 512;
+        const int table_height = (glyph_count + 511) / 512;
+        bd->GlyphTable.resize(table_width * table_height * 8);
+        memset(bd->GlyphTable.Data, 0, (size_t)bd->GlyphTable.size_in_bytes());
+        for (const ImFont* font : io.Fonts->Fonts)
+            for (int glyph_n = 0; font->GlyphTableOffset >= 0 && glyph_n < font->Glyphs.Size; glyph_n++)
+            {
+                const ImFontGlyph& glyph = font->Glyphs[glyph_n];
+                float* out = &bd->GlyphTable.Data[(font->GlyphTableOffset + glyph_n) * 8];
+                out[0] = glyph.X0; out[1] = glyph.Y0; out[2] = glyph.X1; out[3] = glyph.Y1;
+                out[4] = glyph.U0; out[5] = glyph.V0; out[6] = glyph.U1; out[7] = glyph.V1;
+            }
+        GL_CALL(glGenTextures(1, &bd->GlyphTableTexture));
+        GL_CALL(glBindTexture(GL_TEXTURE_2D, bd->GlyphTableTexture));
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST)); // No mipmaps, or texelFetch() would read an incomplete texture
+        GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+        GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA32F, table_width * 2, table_height, 0, GL_RGBA, GL_FLOAT, bd->GlyphTable.Data));
+    }
+#endif
+
     // Restore state
     GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
 
@@ -727,6 +1424,14 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
         io.Fonts->SetTexID(0);
         bd->FontTexture = 0;
     }
+    if (bd->GlyphTableTexture)
+    {
+        glDeleteTextures(1, &bd->GlyphTableTexture);
+        bd->GlyphTableTexture = 0;
+    }
+    bd->GlyphTable.clear();
+    for (ImGui_ImplOpenGL3_RenderCacheEntry& entry : bd->RenderCache)
+        entry.Hash = 0; // Cached textures may hold glyphs from the old atlas, and texture identifier may be reused
 }
 
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
@@ -934,6 +1639,67 @@ bool    ImGui_ImplOpenGL3_CreateDeviceObjects()
     glLinkProgram(bd->ShaderHandle);
     CheckProgram(bd->ShaderHandle, "shader program");
 
+#ifdef IMGUI_IMPL_OPENGL_MAY_HAVE_GLYPH_INSTANCES
+    // Glyph program: one instance per ImDrawGlyph, expanded to a quad from gl_VertexID (triangle strip of 4 vertices).
+    // Glyph rectangle and UV come from the glyph table texture. Shares the fragment shader of the main program.
+    if (glsl_version >= 130 && (bd->GlVersion >= 330 || bd->GlProfileIsES3))
+    {
+        const GLchar* glyph_vertex_shader =
+            "#ifdef GL_ES\n"
+            "    precision highp float;\n"
+            "    precision highp int;\n"
+            "#endif\n"
+            "uniform mat4 ProjMtx;\n"
+            "uniform highp sampler2D GlyphTable;\n"
+            "in vec2 GlyphPos;\n"
+            "in vec4 GlyphColor;\n"
+            "in uint GlyphIndex;\n"
+            "out vec2 Frag_UV;\n"
+            "out vec4 Frag_Color;\n"
+            "void main()\n"
+            "{\n"
+            "    ivec2 texel = ivec2(int(GlyphIndex % 512u) * 2, int(GlyphIndex / 512u));\n"
+            "    vec4 rect = texelFetch(GlyphTable, texel, 0);\n"
+            "    vec4 uv = texelFetch(GlyphTable, texel + ivec2(1, 0), 0);\n"
+            "    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));\n"
+            "    Frag_UV = mix(uv.xy, uv.zw, corner);\n"
+            "    Frag_Color = GlyphColor;\n"
+            "    gl_Position = ProjMtx * vec4(GlyphPos + mix(rect.xy, rect.zw, corner),0,1);\n"
+            "}\n";
+        const GLchar* glyph_vertex_shader_with_version[2] = { bd->GlslVersionString, glyph_vertex_shader };
+        GLuint glyph_vert_handle;
+        GL_CALL(glyph_vert_handle = glCreateShader(GL_VERTEX_SHADER));
+        glShaderSource(glyph_vert_handle, 2, glyph_vertex_shader_with_version, nullptr);
+        glCompileShader(glyph_vert_handle);
+        if (CheckShader(glyph_vert_handle, "glyph vertex shader"))
+        {
+            bd->GlyphShaderHandle = glCreateProgram();
+            glAttachShader(bd->GlyphShaderHandle, glyph_vert_handle);
+            glAttachShader(bd->GlyphShaderHandle, frag_handle);
+            glLinkProgram(bd->GlyphShaderHandle);
+            glDetachShader(bd->GlyphShaderHandle, glyph_vert_handle);
+            glDetachShader(bd->GlyphShaderHandle, frag_handle);
+            if (!CheckProgram(bd->GlyphShaderHandle, "glyph shader program"))
+            {
+                glDeleteProgram(bd->GlyphShaderHandle);
+                bd->GlyphShaderHandle = 0;
+            }
+        }
+        glDeleteShader(glyph_vert_handle);
+    }
+    if (bd->GlyphShaderHandle != 0)
+    {
+        bd->GlyphAttribLocationTex = glGetUniformLocation(bd->GlyphShaderHandle, "Texture");
+        bd->GlyphAttribLocationTable = glGetUniformLocation(bd->GlyphShaderHandle, "GlyphTable");
+        bd->GlyphAttribLocationProjMtx = glGetUniformLocation(bd->GlyphShaderHandle, "ProjMtx");
+        bd->GlyphAttribLocationPos = (GLuint)glGetAttribLocation(bd->GlyphShaderHandle, "GlyphPos");
+        bd->GlyphAttribLocationColor = (GLuint)glGetAttribLocation(bd->GlyphShaderHandle, "GlyphColor");
+        bd->GlyphAttribLocationIndex = (GLuint)glGetAttribLocation(bd->GlyphShaderHandle, "GlyphIndex");
+        glGenBuffers(1, &bd->GlyphsHandle);
+        ImGui::GetIO().BackendFlags |= ImGuiBackendFlags_RendererHasGlyphInstances; // We can draw ImDrawCmd::GlyphCount instances from ImDrawList::GlyphBuffer.
+    }
+#endif
+
     glDetachShader(bd->ShaderHandle, vert_handle);
     glDetachShader(bd->ShaderHandle, frag_handle);
     glDeleteShader(vert_handle);
@@ -970,6 +1736,11 @@ void    ImGui_ImplOpenGL3_DestroyDeviceObjects()
     if (bd->VboHandle)      { glDeleteBuffers(1, &bd->VboHandle); bd->VboHandle = 0; }
     if (bd->ElementsHandle) { glDeleteBuffers(1, &bd->ElementsHandle); bd->ElementsHandle = 0; }
     if (bd->ShaderHandle)   { glDeleteProgram(bd->ShaderHandle); bd->ShaderHandle = 0; }
+    if (bd->GlyphsHandle)   { glDeleteBuffers(1, &bd->GlyphsHandle); bd->GlyphsHandle = 0; }
+    if (bd->GlyphShaderHandle) { glDeleteProgram(bd->GlyphShaderHandle); bd->GlyphShaderHandle = 0; }
+    ImGui::GetIO().BackendFlags &= ~ImGuiBackendFlags_RendererHasGlyphInstances;
+    ImGui_ImplOpenGL3_DestroyRenderCache();
+    ImGui_ImplOpenGL3_DestroyDrawListBuffers();
     ImGui_ImplOpenGL3_DestroyFontsTexture();
 }
 
@@ -41,6 +41,44 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateDeviceObjects();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 
+// (Optional) Draw lists unchanged since last frame are not uploaded again, which is detected by hashing their contents.
+// - ImGui_ImplOpenGL3_HashDrawData() doesn't call OpenGL: it may run on a worker thread between ImGui::Render() and ImGui_ImplOpenGL3_RenderDrawData(),
+//   e.g. while the main thread renders the scene. Otherwise ImGui_ImplOpenGL3_RenderDrawData() hashes lists itself.
+struct ImGui_ImplOpenGL3_UploadStats
+{
+    int     FrameListsUploaded;     // During last frame
+    int     FrameListsReused;
+    size_t  FrameBytesUploaded;
+    size_t  FrameBytesReused;       // Not uploaded as contents were unchanged
+    size_t  BufferBytes;            // Total size of per draw list buffers
+};
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_HashDrawData(ImDrawData* draw_data);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_GetUploadStats(ImGui_ImplOpenGL3_UploadStats* out_stats);
+
+// (Optional) Render cache for windows using ImGuiWindowFlags_CachedRender
+struct ImGui_ImplOpenGL3_RenderCacheStats
+{
+    int     FrameHits;              // Draw lists composited from their cached texture during last frame
+    int     FrameMisses;            // Draw lists flagged for caching but drawn directly (changed contents) or re-rendered into their texture
+    int     TotalHits;
+    int     TotalMisses;
+    float   FrameFillPixelsSaved;   // Triangle area not rasterized during last frame thanks to hits, minus the area of composited quads, in framebuffer pixels
+    int     CachedTextures;
+    size_t  CachedTextureBytes;
+};
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_GetRenderCacheStats(ImGui_ImplOpenGL3_RenderCacheStats* out_stats);
+
+// (Optional) OpenGL calls made by the last ImGui_ImplOpenGL3_RenderDrawData(), e.g. to compare backend changes on recorded frames (see imgui_remote.h)
+struct ImGui_ImplOpenGL3_CallStats
+{
+    int     FrameDrawCalls;         // glDrawElements(), glDrawElementsBaseVertex()
+    int     FrameBufferUploads;     // glBufferData(), glBufferSubData()
+    int     FrameTextureBinds;
+    int     FrameScissorCalls;
+    int     FrameFramebufferBinds;  // Render cache: render to texture and back
+};
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_GetCallStats(ImGui_ImplOpenGL3_CallStats* out_stats);
+
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
@@ -0,0 +1,678 @@
+// dear imgui: Renderer Backend for CPU rasterization into a RGBA32 buffer
+// - For headless rendering (e.g. dashboards rendered to images on servers without GPU). No graphics API is used.
+// - Output matches imgui_impl_opengl3 with straight alpha blending, within a few units per channel.
+// This needs to be used along with a Platform Backend, or with io.DisplaySize/io.DeltaTime filled by the application.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID.
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Multi-threaded rasterization. The target is split into tiles, each rasterized by one thread.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+// CHANGELOG
+//  2026-10-18: Contexts sharing a locked font atlas use the font texture created by the atlas owner, without writing to the atlas. Allows one context per thread.
+//  2026-10-18: Initial version.
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_impl_softraster.h"
+#include <stdint.h>     // intptr_t
+#include <string.h>     // memcpy
+#include <math.h>       // floorf, ceilf
+#include <atomic>       // std::atomic
+#include <thread>       // std::thread
+
+// SSE2 is always available on x64, and on x86 when compiling with /arch:SSE2 or -msse2
+#if !defined(IMGUI_IMPL_SOFTRASTER_DISABLE_SSE) && (defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define IMGUI_IMPL_SOFTRASTER_USE_SSE
+#include <emmintrin.h>
+#endif
+
+// Clang/GCC warnings with -Weverything
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wold-style-cast"         // warning: use of old-style cast
+#pragma clang diagnostic ignored "-Wcast-align"             // warning: cast from 'xxxx' to 'yyyy' increases required alignment
+#endif
+
+template<typename T> static inline T ImSrMin(T a, T b)    { return a < b ? a : b; }
+template<typename T> static inline T ImSrMax(T a, T b)    { return a >= b ? a : b; }
+
+//-----------------------------------------------------------------------------
+// 4 floats: either RGBA channels of one pixel, or one value for 4 consecutive pixels
+//-----------------------------------------------------------------------------
+
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE
+typedef __m128 ImSrVec4;
+static inline ImSrVec4 ImSrSet(float a, float b, float c, float d)      { return _mm_setr_ps(a, b, c, d); }
+static inline ImSrVec4 ImSrSplat(float v)                               { return _mm_set1_ps(v); }
+static inline ImSrVec4 ImSrAdd(ImSrVec4 a, ImSrVec4 b)                  { return _mm_add_ps(a, b); }
+static inline ImSrVec4 ImSrSub(ImSrVec4 a, ImSrVec4 b)                  { return _mm_sub_ps(a, b); }
+static inline ImSrVec4 ImSrMul(ImSrVec4 a, ImSrVec4 b)                  { return _mm_mul_ps(a, b); }
+static inline float    ImSrGetW(ImSrVec4 v)                             { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+static inline ImSrVec4 ImSrSplatW(ImSrVec4 v)                           { return _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3)); }
+static inline ImSrVec4 ImSrSetW(ImSrVec4 v, float w)                    { ImSrVec4 t = _mm_shuffle_ps(_mm_set_ss(w), v, _MM_SHUFFLE(3, 2, 0, 0)); return _mm_shuffle_ps(v, t, _MM_SHUFFLE(0, 2, 1, 0)); } // (v.x, v.y, v.z, w)
+static inline ImSrVec4 ImSrFromColor(ImU32 c)                           { __m128i z = _mm_setzero_si128(); __m128i v = _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128((int)c), z), z); return _mm_cvtepi32_ps(v); } // 0..255
+static inline ImU32    ImSrToColor(ImSrVec4 v)                          { __m128i i = _mm_cvtps_epi32(v); i = _mm_packs_epi32(i, i); i = _mm_packus_epi16(i, i); return (ImU32)_mm_cvtsi128_si32(i); } // Round to nearest, saturate
+// Edge functions for 4 pixels: mask of lanes where all >= 0, or > 0 for edges not owning ties
+static inline int      ImSrInsideMask(ImSrVec4 w0, ImSrVec4 w1, ImSrVec4 w2, const ImSrVec4* ties)
+{
+    const __m128 z = _mm_setzero_ps();
+    __m128 in0 = _mm_or_ps(_mm_cmpgt_ps(w0, z), _mm_and_ps(_mm_cmpeq_ps(w0, z), ties[0]));
+    __m128 in1 = _mm_or_ps(_mm_cmpgt_ps(w1, z), _mm_and_ps(_mm_cmpeq_ps(w1, z), ties[1]));
+    __m128 in2 = _mm_or_ps(_mm_cmpgt_ps(w2, z), _mm_and_ps(_mm_cmpeq_ps(w2, z), ties[2]));
+    return _mm_movemask_ps(_mm_and_ps(in0, _mm_and_ps(in1, in2)));
+}
+#else
+struct ImSrVec4 { float x, y, z, w; };
+static inline ImSrVec4 ImSrSet(float a, float b, float c, float d)      { ImSrVec4 r = { a, b, c, d }; return r; }
+static inline ImSrVec4 ImSrSplat(float v)                               { return ImSrSet(v, v, v, v); }
+static inline ImSrVec4 ImSrAdd(ImSrVec4 a, ImSrVec4 b)                  { return ImSrSet(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w); }
+static inline ImSrVec4 ImSrSub(ImSrVec4 a, ImSrVec4 b)                  { return ImSrSet(a.x - b.x, a.y - b.y, a.z - b.z, a.w - b.w); }
+static inline ImSrVec4 ImSrMul(ImSrVec4 a, ImSrVec4 b)                  { return ImSrSet(a.x * b.x, a.y * b.y, a.z * b.z, a.w * b.w); }
+static inline float    ImSrGetW(ImSrVec4 v)                             { return v.w; }
+static inline ImSrVec4 ImSrSplatW(ImSrVec4 v)                           { return ImSrSplat(v.w); }
+static inline ImSrVec4 ImSrSetW(ImSrVec4 v, float w)                    { v.w = w; return v; }
+static inline ImSrVec4 ImSrFromColor(ImU32 c)                           { return ImSrSet((float)(c & 0xFF), (float)((c >> 8) & 0xFF), (float)((c >> 16) & 0xFF), (float)(c >> 24)); }
+static inline ImU32    ImSrToChannel(float v)                           { return v <= 0.0f ? 0 : v >= 255.0f ? 255 : (ImU32)(int)(v + 0.5f); }
+static inline ImU32    ImSrToColor(ImSrVec4 v)                          { return ImSrToChannel(v.x) | (ImSrToChannel(v.y) << 8) | (ImSrToChannel(v.z) << 16) | (ImSrToChannel(v.w) << 24); }
+static inline int      ImSrInsideMask(ImSrVec4 w0, ImSrVec4 w1, ImSrVec4 w2, const ImSrVec4* ties)
+{
+    const float* a = &w0.x; const float* b = &w1.x; const float* c = &w2.x;
+    int mask = 0;
+    for (int n = 0; n < 4; n++)
+        if ((a[n] > 0.0f || (a[n] == 0.0f && ties[0].x != 0.0f)) && (b[n] > 0.0f || (b[n] == 0.0f && ties[1].x != 0.0f)) && (c[n] > 0.0f || (c[n] == 0.0f && ties[2].x != 0.0f)))
+            mask |= 1 << n;
+    return mask;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Backend data
+//-----------------------------------------------------------------------------
+
+static const int ImGui_ImplSoftRaster_TileSize = 64;
+
+// Value of an attribute at pixel center (x+0.5,y+0.5) = C + Dx*(x+0.5) + Dy*(y+0.5). For edges, inside is >= 0.
+struct ImGui_ImplSoftRaster_Plane
+{
+    float           Dx, Dy, C;
+};
+
+// Triangle or axis-aligned quad, in target pixel coordinates
+struct ImGui_ImplSoftRaster_Prim
+{
+    int             MinX, MinY, MaxX, MaxY;     // Pixels to consider, within scissor rectangle: [Min,Max)
+    bool            IsQuad;                     // All pixels within Min/Max are covered: no edge functions
+    bool            ConstSrc;                   // Color and UV are constant: source color is ConstColor
+    bool            TexelAligned;               // Quad with UV mapping 1 texel per pixel, centered: sample texels directly
+    const ImGui_ImplSoftRaster_Texture* Tex;
+    ImGui_ImplSoftRaster_Plane Edges[3];
+    bool            EdgeOwnsTies[3];            // Pixel centers exactly on the edge are inside (so that pixels on shared edges are drawn once)
+    ImGui_ImplSoftRaster_Plane U, V;            // In texels, minus 0.5 (so that integer values are texel centers)
+    ImSrVec4        ColorC, ColorDx, ColorDy;   // Color planes (RGBA, 0..1)
+    ImSrVec4        ConstColor;                 // When ConstSrc: color * texel, 0..255
+    int             TexelX, TexelY;             // When TexelAligned: texel at MinX,MinY
+};
+
+struct ImGui_ImplSoftRaster_Data
+{
+    int                         ThreadsCount;
+    ImGui_ImplSoftRaster_Texture FontTexture;
+    ImVector<ImU32>             FontPixels;
+    bool                        FontTextureShared;  // Using io.Fonts->TexID of a shared atlas, owned by another context
+    ImVector<ImGui_ImplSoftRaster_Prim> Prims;
+    ImVector<int>               TileOffsets;    // Prims of tile n are TilePrims[TileOffsets[n] .. TileOffsets[n+1]]
+    ImVector<int>               TilePrims;
+    int                         TilesX, TilesY;
+    const ImGui_ImplSoftRaster_Target* Target;
+    std::atomic<int>            NextTile;
+
+    ImGui_ImplSoftRaster_Data() : ThreadsCount(1), FontTextureShared(false), TilesX(0), TilesY(0), Target(nullptr), NextTile(0) { memset((void*)&FontTexture, 0, sizeof(FontTexture)); }
+};
+
+// Backend data stored in io.BackendRendererUserData to allow support for multiple Dear ImGui contexts
+// It is STRONGLY preferred that you use docking branch with multi-viewports (== single Dear ImGui context + multiple windows) instead of multiple Dear ImGui contexts.
+static ImGui_ImplSoftRaster_Data* ImGui_ImplSoftRaster_GetBackendData()
+{
+    return ImGui::GetCurrentContext() ? (ImGui_ImplSoftRaster_Data*)ImGui::GetIO().BackendRendererUserData : nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// Functions
+//-----------------------------------------------------------------------------
+
+bool    ImGui_ImplSoftRaster_Init(int threads_count)
+{
+    ImGuiIO& io = ImGui::GetIO();
+    IMGUI_CHECKVERSION();
+    IM_ASSERT(io.BackendRendererUserData == nullptr && "Already initialized a renderer backend!");
+
+    // Setup backend capabilities flags
+    ImGui_ImplSoftRaster_Data* bd = IM_NEW(ImGui_ImplSoftRaster_Data)();
+    io.BackendRendererUserData = (void*)bd;
+    io.BackendRendererName = "imgui_impl_softraster";
+    io.BackendFlags |= ImGuiBackendFlags_RendererHasVtxOffset;  // We can honor the ImDrawCmd::VtxOffset field, allowing for large meshes.
+
+    if (threads_count <= 0)
+        threads_count = (int)std::thread::hardware_concurrency();
+    bd->ThreadsCount = threads_count > 0 ? threads_count : 1;
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_Shutdown()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "No renderer backend to shutdown, or already shutdown?");
+    ImGuiIO& io = ImGui::GetIO();
+
+    ImGui_ImplSoftRaster_DestroyFontsTexture();
+    io.BackendRendererName = nullptr;
+    io.BackendRendererUserData = nullptr;
+    io.BackendFlags &= ~ImGuiBackendFlags_RendererHasVtxOffset;
+    IM_DELETE(bd);
+}
+
+void    ImGui_ImplSoftRaster_NewFrame()
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftRaster_Init()?");
+
+    if (!bd->FontTexture.Pixels && !bd->FontTextureShared)
+        ImGui_ImplSoftRaster_CreateFontsTexture();
+}
+
+bool    ImGui_ImplSoftRaster_CreateFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+
+    // Shared atlas locked by its owner (e.g. contexts running on worker threads): use the texture created by the owner, don't write to the atlas.
+    if (io.Fonts->Locked && io.Fonts->TexID != 0)
+    {
+        bd->FontTextureShared = true;
+        return true;
+    }
+
+    // Build texture atlas. Copy pixels, as the atlas may be cleared with ClearTexData().
+    unsigned char* pixels;
+    int width, height;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &width, &height);
+    bd->FontPixels.resize(width * height);
+    memcpy(bd->FontPixels.Data, pixels, (size_t)width * height * 4);
+    bd->FontTexture.Pixels = bd->FontPixels.Data;
+    bd->FontTexture.Width = width;
+    bd->FontTexture.Height = height;
+
+    // Store our identifier
+    io.Fonts->SetTexID((ImTextureID)(intptr_t)&bd->FontTexture);
+    return true;
+}
+
+void    ImGui_ImplSoftRaster_DestroyFontsTexture()
+{
+    ImGuiIO& io = ImGui::GetIO();
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    bd->FontTextureShared = false;
+    if (bd->FontTexture.Pixels)
+    {
+        bd->FontPixels.clear();
+        memset((void*)&bd->FontTexture, 0, sizeof(bd->FontTexture));
+        io.Fonts->SetTexID(0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Setup
+//-----------------------------------------------------------------------------
+
+static inline ImSrVec4 ImGui_ImplSoftRaster_SampleBilinear(const ImGui_ImplSoftRaster_Texture* tex, float u, float v)
+{
+    // u/v are in texels, minus 0.5. Clamp to edge.
+    const float fx = floorf(u), fy = floorf(v);
+    const float ax = u - fx, ay = v - fy;
+    const int max_x = tex->Width - 1, max_y = tex->Height - 1;
+    int x0 = (int)fx, y0 = (int)fy;
+    int x1 = x0 + 1, y1 = y0 + 1;
+    x0 = x0 < 0 ? 0 : x0 > max_x ? max_x : x0;
+    x1 = x1 < 0 ? 0 : x1 > max_x ? max_x : x1;
+    y0 = y0 < 0 ? 0 : y0 > max_y ? max_y : y0;
+    y1 = y1 < 0 ? 0 : y1 > max_y ? max_y : y1;
+    const ImU32* row0 = tex->Pixels + y0 * tex->Width;
+    const ImU32* row1 = tex->Pixels + y1 * tex->Width;
+    if (row0[x0] == row0[x1] && row0[x0] == row1[x0] && row0[x0] == row1[x1])
+        return ImSrFromColor(row0[x0]); // Common within glyphs and solid areas
+    const ImSrVec4 t00 = ImSrFromColor(row0[x0]), t10 = ImSrFromColor(row0[x1]);
+    const ImSrVec4 t01 = ImSrFromColor(row1[x0]), t11 = ImSrFromColor(row1[x1]);
+    const ImSrVec4 top = ImSrAdd(t00, ImSrMul(ImSrSub(t10, t00), ImSrSplat(ax)));
+    const ImSrVec4 bot = ImSrAdd(t01, ImSrMul(ImSrSub(t11, t01), ImSrSplat(ax)));
+    return ImSrAdd(top, ImSrMul(ImSrSub(bot, top), ImSrSplat(ay)));
+}
+
+// Vertex positions are snapped to 1/256 pixel like GPUs do, so that coverage of pixel centers matches closely
+static inline float ImGui_ImplSoftRaster_SnapToSubPixel(float v)
+{
+    return floorf(v * 256.0f + 0.5f) * (1.0f / 256.0f);
+}
+
+static void ImGui_ImplSoftRaster_SetupPlane(ImGui_ImplSoftRaster_Plane* plane, const ImVec2& p0, const ImVec2& p1, const ImVec2& p2, float inv_det, float a0, float a1, float a2)
+{
+    const float d1 = a1 - a0, d2 = a2 - a0;
+    const float e1x = p1.x - p0.x, e1y = p1.y - p0.y, e2x = p2.x - p0.x, e2y = p2.y - p0.y;
+    plane->Dx = (d1 * e2y - d2 * e1y) * inv_det;
+    plane->Dy = (d2 * e1x - d1 * e2x) * inv_det;
+    plane->C = a0 - plane->Dx * p0.x - plane->Dy * p0.y;
+}
+
+// Edge a->b. Coefficients are computed from endpoints in a canonical order, then negated if needed,
+// so that the shared edge of two adjacent triangles evaluates to exactly opposite values: pixels on it are drawn once.
+static void ImGui_ImplSoftRaster_SetupEdge(ImGui_ImplSoftRaster_Plane* edge, bool* owns_ties, ImVec2 a, ImVec2 b)
+{
+    const bool swap = (a.x > b.x) || (a.x == b.x && a.y > b.y);
+    if (swap) { ImVec2 t = a; a = b; b = t; }
+    edge->Dx = a.y - b.y;
+    edge->Dy = b.x - a.x;
+    edge->C = a.x * b.y - b.x * a.y;
+    if (swap) { edge->Dx = -edge->Dx; edge->Dy = -edge->Dy; edge->C = -edge->C; }
+    *owns_ties = (edge->Dx > 0.0f) || (edge->Dx == 0.0f && edge->Dy < 0.0f); // Left and bottom edges, as GL rasterizers do with their bottom-up window coordinates
+}
+
+static void ImGui_ImplSoftRaster_SetupSource(ImGui_ImplSoftRaster_Prim* prim, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2)
+{
+    const ImU32 col = v0->col;
+    prim->ConstSrc = (col == v1->col && col == v2->col && v0->uv.x == v1->uv.x && v0->uv.x == v2->uv.x && v0->uv.y == v1->uv.y && v0->uv.y == v2->uv.y);
+    if (prim->ConstSrc)
+    {
+        const ImSrVec4 texel = ImGui_ImplSoftRaster_SampleBilinear(prim->Tex, prim->U.C, prim->V.C);
+        prim->ConstColor = ImSrMul(ImSrMul(ImSrFromColor(col), ImSrSplat(1.0f / 255.0f)), texel);
+    }
+}
+
+// Axis-aligned rectangle with constant color, split in two triangles by a diagonal: (i0,i1,i2) (i0,i2,i3)
+static bool ImGui_ImplSoftRaster_SetupQuad(ImGui_ImplSoftRaster_Prim* prim, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImDrawVert* v3, const ImVec2& off, const ImVec2& scale)
+{
+    if (v0->col != v1->col || v0->col != v2->col || v0->col != v3->col)
+        return false;
+    const ImDrawVert* vx; // Vertex sharing Y with v0, other vertex sharing X with v0 is vy
+    const ImDrawVert* vy;
+    if (v0->pos.y == v1->pos.y && v1->pos.x == v2->pos.x && v2->pos.y == v3->pos.y && v3->pos.x == v0->pos.x)
+        vx = v1, vy = v3;
+    else if (v0->pos.x == v1->pos.x && v1->pos.y == v2->pos.y && v2->pos.x == v3->pos.x && v3->pos.y == v0->pos.y)
+        vx = v3, vy = v1;
+    else
+        return false;
+    // U must only depend on X, V only on Y
+    if (v0->uv.y != vx->uv.y || vy->uv.y != v2->uv.y || v0->uv.x != vy->uv.x || vx->uv.x != v2->uv.x)
+        return false;
+    const float x0 = ImGui_ImplSoftRaster_SnapToSubPixel((v0->pos.x - off.x) * scale.x), x1 = ImGui_ImplSoftRaster_SnapToSubPixel((vx->pos.x - off.x) * scale.x);
+    const float y0 = ImGui_ImplSoftRaster_SnapToSubPixel((v0->pos.y - off.y) * scale.y), y1 = ImGui_ImplSoftRaster_SnapToSubPixel((vy->pos.y - off.y) * scale.y);
+    if (x0 == x1 || y0 == y1)
+        return false;
+    const ImGui_ImplSoftRaster_Texture* tex = prim->Tex;
+    const float u0 = v0->uv.x * tex->Width - 0.5f, u1 = vx->uv.x * tex->Width - 0.5f;
+    const float w0 = v0->uv.y * tex->Height - 0.5f, w1 = vy->uv.y * tex->Height - 0.5f;
+    prim->IsQuad = true;
+    prim->U.Dx = (u1 - u0) / (x1 - x0); prim->U.Dy = 0.0f; prim->U.C = u0 - prim->U.Dx * x0;
+    prim->V.Dx = 0.0f; prim->V.Dy = (w1 - w0) / (y1 - y0); prim->V.C = w0 - prim->V.Dy * y0;
+    prim->ColorC = ImSrMul(ImSrFromColor(v0->col), ImSrSplat(1.0f / 255.0f));
+    prim->ColorDx = prim->ColorDy = ImSrSplat(0.0f);
+    ImGui_ImplSoftRaster_SetupSource(prim, v0, vx, v2);
+
+    // Pixels whose center is within [min_x,max_x) and (min_y,max_y]: same tie rules as triangles, see ImGui_ImplSoftRaster_SetupEdge()
+    const float min_x = x0 < x1 ? x0 : x1, max_x = x0 < x1 ? x1 : x0;
+    const float min_y = y0 < y1 ? y0 : y1, max_y = y0 < y1 ? y1 : y0;
+    const int px0 = (int)ceilf(min_x - 0.5f), px1 = (int)ceilf(max_x - 0.5f);
+    const int py0 = (int)floorf(min_y - 0.5f) + 1, py1 = (int)floorf(max_y - 0.5f) + 1;
+    prim->MinX = px0 > prim->MinX ? px0 : prim->MinX;
+    prim->MinY = py0 > prim->MinY ? py0 : prim->MinY;
+    prim->MaxX = px1 < prim->MaxX ? px1 : prim->MaxX;
+    prim->MaxY = py1 < prim->MaxY ? py1 : prim->MaxY;
+
+    // Glyphs and images drawn at their size, at integer positions
+    const float tx = prim->U.C + prim->U.Dx * (prim->MinX + 0.5f);
+    const float ty = prim->V.C + prim->V.Dy * (prim->MinY + 0.5f);
+    prim->TexelAligned = !prim->ConstSrc && prim->U.Dx == 1.0f && prim->V.Dy == 1.0f && tx == floorf(tx) && ty == floorf(ty);
+    if (prim->TexelAligned)
+    {
+        prim->TexelX = (int)tx;
+        prim->TexelY = (int)ty;
+        // Texel fetches must stay within texture
+        if (prim->TexelX < 0 || prim->TexelY < 0 || prim->TexelX + (prim->MaxX - prim->MinX) > tex->Width || prim->TexelY + (prim->MaxY - prim->MinY) > tex->Height)
+            prim->TexelAligned = false;
+    }
+    return true;
+}
+
+static bool ImGui_ImplSoftRaster_SetupTriangle(ImGui_ImplSoftRaster_Prim* prim, const ImDrawVert* v0, const ImDrawVert* v1, const ImDrawVert* v2, const ImVec2& off, const ImVec2& scale)
+{
+    ImVec2 p0(ImGui_ImplSoftRaster_SnapToSubPixel((v0->pos.x - off.x) * scale.x), ImGui_ImplSoftRaster_SnapToSubPixel((v0->pos.y - off.y) * scale.y));
+    ImVec2 p1(ImGui_ImplSoftRaster_SnapToSubPixel((v1->pos.x - off.x) * scale.x), ImGui_ImplSoftRaster_SnapToSubPixel((v1->pos.y - off.y) * scale.y));
+    ImVec2 p2(ImGui_ImplSoftRaster_SnapToSubPixel((v2->pos.x - off.x) * scale.x), ImGui_ImplSoftRaster_SnapToSubPixel((v2->pos.y - off.y) * scale.y));
+    float det = (p1.x - p0.x) * (p2.y - p0.y) - (p2.x - p0.x) * (p1.y - p0.y);
+    if (det == 0.0f)
+        return false;
+    if (det < 0.0f)
+    {
+        ImVec2 tp = p1; p1 = p2; p2 = tp;
+        const ImDrawVert* tv = v1; v1 = v2; v2 = tv;
+        det = -det;
+    }
+
+    // Bounding box of pixel centers
+    const float min_x = ImSrMin(p0.x, ImSrMin(p1.x, p2.x)), max_x = ImSrMax(p0.x, ImSrMax(p1.x, p2.x));
+    const float min_y = ImSrMin(p0.y, ImSrMin(p1.y, p2.y)), max_y = ImSrMax(p0.y, ImSrMax(p1.y, p2.y));
+    const int px0 = (int)floorf(min_x), px1 = (int)ceilf(max_x);
+    const int py0 = (int)floorf(min_y), py1 = (int)ceilf(max_y);
+    prim->MinX = px0 > prim->MinX ? px0 : prim->MinX;
+    prim->MinY = py0 > prim->MinY ? py0 : prim->MinY;
+    prim->MaxX = px1 < prim->MaxX ? px1 : prim->MaxX;
+    prim->MaxY = py1 < prim->MaxY ? py1 : prim->MaxY;
+    if (prim->MinX >= prim->MaxX || prim->MinY >= prim->MaxY)
+        return false;
+
+    prim->IsQuad = false;
+    prim->TexelAligned = false;
+    ImGui_ImplSoftRaster_SetupEdge(&prim->Edges[0], &prim->EdgeOwnsTies[0], p1, p2);
+    ImGui_ImplSoftRaster_SetupEdge(&prim->Edges[1], &prim->EdgeOwnsTies[1], p2, p0);
+    ImGui_ImplSoftRaster_SetupEdge(&prim->Edges[2], &prim->EdgeOwnsTies[2], p0, p1);
+
+    const float inv_det = 1.0f / det;
+    const ImGui_ImplSoftRaster_Texture* tex = prim->Tex;
+    ImGui_ImplSoftRaster_SetupPlane(&prim->U, p0, p1, p2, inv_det, v0->uv.x * tex->Width - 0.5f, v1->uv.x * tex->Width - 0.5f, v2->uv.x * tex->Width - 0.5f);
+    ImGui_ImplSoftRaster_SetupPlane(&prim->V, p0, p1, p2, inv_det, v0->uv.y * tex->Height - 0.5f, v1->uv.y * tex->Height - 0.5f, v2->uv.y * tex->Height - 0.5f);
+    const ImSrVec4 c0 = ImSrFromColor(v0->col), c1 = ImSrFromColor(v1->col), c2 = ImSrFromColor(v2->col);
+    ImGui_ImplSoftRaster_Plane planes[4];
+    const float* f0 = (const float*)&c0; const float* f1 = (const float*)&c1; const float* f2 = (const float*)&c2;
+    for (int n = 0; n < 4; n++)
+        ImGui_ImplSoftRaster_SetupPlane(&planes[n], p0, p1, p2, inv_det, f0[n] / 255.0f, f1[n] / 255.0f, f2[n] / 255.0f);
+    prim->ColorC = ImSrSet(planes[0].C, planes[1].C, planes[2].C, planes[3].C);
+    prim->ColorDx = ImSrSet(planes[0].Dx, planes[1].Dx, planes[2].Dx, planes[3].Dx);
+    prim->ColorDy = ImSrSet(planes[0].Dy, planes[1].Dy, planes[2].Dy, planes[3].Dy);
+    ImGui_ImplSoftRaster_SetupSource(prim, v0, v1, v2);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Rasterization
+//-----------------------------------------------------------------------------
+
+// Blend with (SRC_ALPHA, ONE_MINUS_SRC_ALPHA) for color, (ONE, ONE_MINUS_SRC_ALPHA) for alpha. 'src' is 0..255.
+static inline ImU32 ImGui_ImplSoftRaster_Blend(ImSrVec4 src, ImU32 dst)
+{
+    const float src_a = ImSrGetW(src) * (1.0f / 255.0f);
+    const ImSrVec4 src_factor = ImSrSetW(ImSrSplat(src_a), 1.0f);
+    const ImSrVec4 out = ImSrAdd(ImSrMul(src, src_factor), ImSrMul(ImSrFromColor(dst), ImSrSplat(1.0f - src_a)));
+    return ImSrToColor(out);
+}
+
+static inline ImSrVec4 ImGui_ImplSoftRaster_Shade(const ImGui_ImplSoftRaster_Prim* prim, float px, float py)
+{
+    const ImSrVec4 color = ImSrAdd(ImSrAdd(prim->ColorC, ImSrMul(prim->ColorDx, ImSrSplat(px))), ImSrMul(prim->ColorDy, ImSrSplat(py)));
+    const float u = prim->U.C + prim->U.Dx * px + prim->U.Dy * py;
+    const float v = prim->V.C + prim->V.Dx * px + prim->V.Dy * py;
+    return ImSrMul(color, ImGui_ImplSoftRaster_SampleBilinear(prim->Tex, u, v));
+}
+
+static void ImGui_ImplSoftRaster_RasterizeQuad(const ImGui_ImplSoftRaster_Prim* prim, const ImGui_ImplSoftRaster_Target* target, int x0, int y0, int x1, int y1)
+{
+    if (prim->ConstSrc)
+    {
+        const ImSrVec4 src = prim->ConstColor;
+        if (ImSrGetW(src) >= 255.0f)
+        {
+            const ImU32 col = ImSrToColor(src);
+            for (int y = y0; y < y1; y++)
+            {
+                ImU32* dst = target->Pixels + y * target->Stride;
+                for (int x = x0; x < x1; x++)
+                    dst[x] = col;
+            }
+            return;
+        }
+        if (ImSrGetW(src) <= 0.0f)
+            return;
+        for (int y = y0; y < y1; y++)
+        {
+            ImU32* dst = target->Pixels + y * target->Stride;
+            int x = x0;
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE
+            // Same operations as ImGui_ImplSoftRaster_Blend(), on 4 pixels at a time
+            const __m128 src_term = _mm_mul_ps(src, ImSrSetW(ImSrSplat(ImSrGetW(src) * (1.0f / 255.0f)), 1.0f));
+            const __m128 dst_factor = _mm_set1_ps(1.0f - ImSrGetW(src) * (1.0f / 255.0f));
+            const __m128i z = _mm_setzero_si128();
+            for (; x + 4 <= x1; x += 4)
+            {
+                const __m128i d = _mm_loadu_si128((const __m128i*)(dst + x));
+                const __m128i d_lo = _mm_unpacklo_epi8(d, z), d_hi = _mm_unpackhi_epi8(d, z);
+                const __m128 o0 = _mm_add_ps(src_term, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(d_lo, z)), dst_factor));
+                const __m128 o1 = _mm_add_ps(src_term, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(d_lo, z)), dst_factor));
+                const __m128 o2 = _mm_add_ps(src_term, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(d_hi, z)), dst_factor));
+                const __m128 o3 = _mm_add_ps(src_term, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(d_hi, z)), dst_factor));
+                const __m128i o01 = _mm_packs_epi32(_mm_cvtps_epi32(o0), _mm_cvtps_epi32(o1));
+                const __m128i o23 = _mm_packs_epi32(_mm_cvtps_epi32(o2), _mm_cvtps_epi32(o3));
+                _mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(o01, o23));
+            }
+#endif
+            for (; x < x1; x++)
+                dst[x] = ImGui_ImplSoftRaster_Blend(src, dst[x]);
+        }
+        return;
+    }
+    if (prim->TexelAligned)
+    {
+        const ImSrVec4 color = prim->ColorC;
+        const ImGui_ImplSoftRaster_Texture* tex = prim->Tex;
+        for (int y = y0; y < y1; y++)
+        {
+            ImU32* dst = target->Pixels + y * target->Stride;
+            const ImU32* src = tex->Pixels + (prim->TexelY + y - prim->MinY) * tex->Width + (prim->TexelX - prim->MinX);
+            for (int x = x0; x < x1; x++)
+            {
+                const ImU32 texel = src[x];
+                if (texel == 0)
+                    continue; // Transparent black: blending is a no-op
+                dst[x] = ImGui_ImplSoftRaster_Blend(ImSrMul(color, ImSrFromColor(texel)), dst[x]);
+            }
+        }
+        return;
+    }
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* dst = target->Pixels + y * target->Stride;
+        const float py = y + 0.5f;
+        for (int x = x0; x < x1; x++)
+            dst[x] = ImGui_ImplSoftRaster_Blend(ImGui_ImplSoftRaster_Shade(prim, x + 0.5f, py), dst[x]);
+    }
+}
+
+static void ImGui_ImplSoftRaster_RasterizeTriangle(const ImGui_ImplSoftRaster_Prim* prim, const ImGui_ImplSoftRaster_Target* target, int x0, int y0, int x1, int y1)
+{
+    // Edge functions are evaluated 4 pixels at a time, always as (Dx*px + Dy*py) + C so that results don't depend on which pixels are grouped.
+    ImSrVec4 ties[3];
+    for (int n = 0; n < 3; n++)
+    {
+#ifdef IMGUI_IMPL_SOFTRASTER_USE_SSE
+        ties[n] = _mm_castsi128_ps(_mm_set1_epi32(prim->EdgeOwnsTies[n] ? -1 : 0));
+#else
+        ties[n] = ImSrSplat(prim->EdgeOwnsTies[n] ? 1.0f : 0.0f);
+#endif
+    }
+    const ImSrVec4 lane_offsets = ImSrSet(0.5f, 1.5f, 2.5f, 3.5f);
+    const ImSrVec4 e0_dx = ImSrSplat(prim->Edges[0].Dx), e1_dx = ImSrSplat(prim->Edges[1].Dx), e2_dx = ImSrSplat(prim->Edges[2].Dx);
+    const ImSrVec4 e0_c = ImSrSplat(prim->Edges[0].C), e1_c = ImSrSplat(prim->Edges[1].C), e2_c = ImSrSplat(prim->Edges[2].C);
+    for (int y = y0; y < y1; y++)
+    {
+        ImU32* dst = target->Pixels + y * target->Stride;
+        const float py = y + 0.5f;
+        const ImSrVec4 e0_y = ImSrSplat(prim->Edges[0].Dy * py), e1_y = ImSrSplat(prim->Edges[1].Dy * py), e2_y = ImSrSplat(prim->Edges[2].Dy * py);
+        for (int x = x0; x < x1; x += 4)
+        {
+            const ImSrVec4 px = ImSrAdd(ImSrSplat((float)x), lane_offsets);
+            const ImSrVec4 w0 = ImSrAdd(ImSrAdd(ImSrMul(e0_dx, px), e0_y), e0_c);
+            const ImSrVec4 w1 = ImSrAdd(ImSrAdd(ImSrMul(e1_dx, px), e1_y), e1_c);
+            const ImSrVec4 w2 = ImSrAdd(ImSrAdd(ImSrMul(e2_dx, px), e2_y), e2_c);
+            int mask = ImSrInsideMask(w0, w1, w2, ties);
+            if (x + 4 > x1)
+                mask &= (1 << (x1 - x)) - 1;
+            for (int lane = 0; mask != 0; lane++, mask >>= 1)
+            {
+                if ((mask & 1) == 0)
+                    continue;
+                const ImSrVec4 src = prim->ConstSrc ? prim->ConstColor : ImGui_ImplSoftRaster_Shade(prim, x + lane + 0.5f, py);
+                dst[x + lane] = ImGui_ImplSoftRaster_Blend(src, dst[x + lane]);
+            }
+        }
+    }
+}
+
+// Worker: pick tiles until all are done
+static void ImGui_ImplSoftRaster_RasterizeTiles(ImGui_ImplSoftRaster_Data* bd)
+{
+    const ImGui_ImplSoftRaster_Target* target = bd->Target;
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    for (int tile_n = bd->NextTile.fetch_add(1); tile_n < tiles_count; tile_n = bd->NextTile.fetch_add(1))
+    {
+        const int tile_x0 = (tile_n % bd->TilesX) * ImGui_ImplSoftRaster_TileSize;
+        const int tile_y0 = (tile_n / bd->TilesX) * ImGui_ImplSoftRaster_TileSize;
+        const int tile_x1 = ImSrMin(tile_x0 + ImGui_ImplSoftRaster_TileSize, target->Width);
+        const int tile_y1 = ImSrMin(tile_y0 + ImGui_ImplSoftRaster_TileSize, target->Height);
+        for (int n = bd->TileOffsets[tile_n]; n < bd->TileOffsets[tile_n + 1]; n++)
+        {
+            const ImGui_ImplSoftRaster_Prim* prim = &bd->Prims[bd->TilePrims[n]];
+            const int x0 = ImSrMax(prim->MinX, tile_x0), y0 = ImSrMax(prim->MinY, tile_y0);
+            const int x1 = ImSrMin(prim->MaxX, tile_x1), y1 = ImSrMin(prim->MaxY, tile_y1);
+            if (x0 >= x1 || y0 >= y1)
+                continue;
+            if (prim->IsQuad)
+                ImGui_ImplSoftRaster_RasterizeQuad(prim, target, x0, y0, x1, y1);
+            else
+                ImGui_ImplSoftRaster_RasterizeTriangle(prim, target, x0, y0, x1, y1);
+        }
+    }
+}
+
+void    ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, const ImGui_ImplSoftRaster_Target* target)
+{
+    ImGui_ImplSoftRaster_Data* bd = ImGui_ImplSoftRaster_GetBackendData();
+    IM_ASSERT(bd != nullptr && "Context or backend not initialized! Did you call ImGui_ImplSoftRaster_Init()?");
+    IM_ASSERT(target->Pixels != nullptr && target->Stride >= target->Width);
+    if (target->Width <= 0 || target->Height <= 0)
+        return;
+
+    // Setup primitives, in submission order
+    // Project scissor/clipping rectangles into target space the same way as imgui_impl_opengl3 does with glScissor(), for matching output.
+    const ImVec2 clip_off = draw_data->DisplayPos;         // (0,0) unless using multi-viewports
+    const ImVec2 clip_scale = draw_data->FramebufferScale; // (1,1) unless using retina display which are often (2,2)
+    const int fb_height = target->Height;
+    bd->Prims.resize(0);
+    for (const ImDrawList* draw_list : draw_data->CmdLists)
+    {
+        for (int cmd_i = 0; cmd_i < draw_list->CmdBuffer.Size; cmd_i++)
+        {
+            const ImDrawCmd* pcmd = &draw_list->CmdBuffer[cmd_i];
+            if (pcmd->UserCallback != nullptr)
+            {
+                // User callback, registered via ImDrawList::AddCallback()
+                // (ImDrawCallback_ResetRenderState is a special callback value used by the user to request the renderer to reset render state.)
+                if (pcmd->UserCallback != ImDrawCallback_ResetRenderState)
+                    pcmd->UserCallback(draw_list, pcmd);
+                continue;
+            }
+
+            ImVec2 clip_min((pcmd->ClipRect.x - clip_off.x) * clip_scale.x, (pcmd->ClipRect.y - clip_off.y) * clip_scale.y);
+            ImVec2 clip_max((pcmd->ClipRect.z - clip_off.x) * clip_scale.x, (pcmd->ClipRect.w - clip_off.y) * clip_scale.y);
+            if (clip_max.x <= clip_min.x || clip_max.y <= clip_min.y)
+                continue;
+            const int scissor_x = (int)clip_min.x, scissor_w = (int)(clip_max.x - clip_min.x);
+            const int scissor_y = fb_height - ((int)((float)fb_height - clip_max.y) + (int)(clip_max.y - clip_min.y)); // Top row, from the bottom-up rectangle given to glScissor()
+            const int scissor_h = (int)(clip_max.y - clip_min.y);
+            const int min_x = ImSrMax(scissor_x, 0), max_x = ImSrMin(scissor_x + scissor_w, target->Width);
+            const int min_y = ImSrMax(scissor_y, 0), max_y = ImSrMin(scissor_y + scissor_h, target->Height);
+            if (min_x >= max_x || min_y >= max_y)
+                continue;
+
+            const ImGui_ImplSoftRaster_Texture* tex = (const ImGui_ImplSoftRaster_Texture*)(intptr_t)pcmd->GetTexID();
+            IM_ASSERT(tex != nullptr && tex->Pixels != nullptr);
+            const ImDrawIdx* idx = draw_list->IdxBuffer.Data + pcmd->IdxOffset;
+            const ImDrawVert* vtx = draw_list->VtxBuffer.Data + pcmd->VtxOffset;
+            const unsigned int elem_count = pcmd->ElemCount;
+            for (unsigned int idx_n = 0; idx_n + 2 < elem_count; idx_n += 3)
+            {
+                bd->Prims.resize(bd->Prims.Size + 1);
+                ImGui_ImplSoftRaster_Prim* prim = &bd->Prims.back();
+                prim->MinX = min_x; prim->MinY = min_y; prim->MaxX = max_x; prim->MaxY = max_y;
+                prim->Tex = tex;
+
+                // Rectangles are emitted as (i0,i1,i2) (i0,i2,i3)
+                const ImDrawIdx i0 = idx[idx_n], i1 = idx[idx_n + 1], i2 = idx[idx_n + 2];
+                if (idx_n + 5 < elem_count && idx[idx_n + 3] == i0 && idx[idx_n + 4] == i2)
+                    if (ImGui_ImplSoftRaster_SetupQuad(prim, &vtx[i0], &vtx[i1], &vtx[i2], &vtx[idx[idx_n + 5]], clip_off, clip_scale))
+                    {
+                        idx_n += 3;
+                        if (prim->MinX >= prim->MaxX || prim->MinY >= prim->MaxY)
+                            bd->Prims.pop_back();
+                        continue;
+                    }
+                if (!ImGui_ImplSoftRaster_SetupTriangle(prim, &vtx[i0], &vtx[i1], &vtx[i2], clip_off, clip_scale))
+                    bd->Prims.pop_back();
+            }
+        }
+    }
+
+    // Bin primitives into tiles, preserving order: count, prefix sum, fill.
+    const int tile_size = ImGui_ImplSoftRaster_TileSize;
+    bd->TilesX = (target->Width + tile_size - 1) / tile_size;
+    bd->TilesY = (target->Height + tile_size - 1) / tile_size;
+    const int tiles_count = bd->TilesX * bd->TilesY;
+    bd->TileOffsets.resize(tiles_count + 1);
+    memset(bd->TileOffsets.Data, 0, (size_t)bd->TileOffsets.size_in_bytes());
+    for (const ImGui_ImplSoftRaster_Prim& prim : bd->Prims)
+        for (int ty = prim.MinY / tile_size; ty <= (prim.MaxY - 1) / tile_size; ty++)
+            for (int tx = prim.MinX / tile_size; tx <= (prim.MaxX - 1) / tile_size; tx++)
+                bd->TileOffsets[ty * bd->TilesX + tx + 1]++;
+    for (int n = 0; n < tiles_count; n++)
+        bd->TileOffsets[n + 1] += bd->TileOffsets[n];
+    bd->TilePrims.resize(bd->TileOffsets[tiles_count]);
+    for (int prim_n = 0; prim_n < bd->Prims.Size; prim_n++)
+    {
+        const ImGui_ImplSoftRaster_Prim& prim = bd->Prims[prim_n];
+        for (int ty = prim.MinY / tile_size; ty <= (prim.MaxY - 1) / tile_size; ty++)
+            for (int tx = prim.MinX / tile_size; tx <= (prim.MaxX - 1) / tile_size; tx++)
+                bd->TilePrims[bd->TileOffsets[ty * bd->TilesX + tx]++] = prim_n;
+    }
+    for (int n = tiles_count; n > 0; n--) // Fill pass advanced each offset to the next tile start: shift back
+        bd->TileOffsets[n] = bd->TileOffsets[n - 1];
+    bd->TileOffsets[0] = 0;
+
+    // Rasterize tiles on worker threads and this thread
+    bd->Target = target;
+    bd->NextTile = 0;
+    const int threads_count = ImSrMin(bd->ThreadsCount, tiles_count);
+    std::thread* threads = (threads_count > 1) ? (std::thread*)IM_ALLOC(sizeof(std::thread) * (threads_count - 1)) : nullptr;
+    for (int n = 0; n < threads_count - 1; n++)
+        IM_PLACEMENT_NEW(&threads[n]) std::thread(ImGui_ImplSoftRaster_RasterizeTiles, bd);
+    ImGui_ImplSoftRaster_RasterizeTiles(bd);
+    for (int n = 0; n < threads_count - 1; n++)
+    {
+        threads[n].join();
+        threads[n].~thread();
+    }
+    if (threads)
+        IM_FREE(threads);
+    bd->Target = nullptr;
+}
+
+//-----------------------------------------------------------------------------
+
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
+
+#endif // #ifndef IMGUI_DISABLE
@@ -0,0 +1,65 @@
+// dear imgui: Renderer Backend for CPU rasterization into a RGBA32 buffer
+// - For headless rendering (e.g. dashboards rendered to images on servers without GPU). No graphics API is used.
+// - Output matches imgui_impl_opengl3 with straight alpha blending, within a few units per channel.
+// This needs to be used along with a Platform Backend, or with io.DisplaySize/io.DeltaTime filled by the application.
+
+// Implemented features:
+//  [X] Renderer: User texture binding. Use 'ImGui_ImplSoftRaster_Texture*' as ImTextureID.
+//  [X] Renderer: Large meshes support (64k+ vertices) even with 16-bit indices (ImGuiBackendFlags_RendererHasVtxOffset).
+//  [X] Renderer: Multi-threaded rasterization. The target is split into tiles, each rasterized by one thread.
+
+// How it works:
+// - Triangles are set up once (edge functions, attribute planes), clipped to their scissor rectangle and binned into 64x64 pixel tiles.
+// - Pairs of triangles forming an axis-aligned rectangle with constant color (most of them: rectangles, glyphs, images) are merged into
+//   a single quad primitive without edge functions.
+// - Worker threads pick tiles and draw the primitives of each tile in submission order, so blending order matches GPU backends.
+// - Vertices are snapped to 1/256 pixel and pixel centers exactly on an edge are drawn by one triangle only, like GPUs do, so coverage matches.
+// - Edge functions and attribute interpolation are evaluated 4 pixels at a time with SSE2 when available.
+// - Textures are sampled with bilinear filtering and clamp to edge addressing. Colors are blended in float, output is 8-bit per channel.
+
+// Running one context per thread (IMGUI_USE_THREAD_LOCAL_CONTEXT in imconfig.h), e.g. to render many dashboards concurrently:
+// - Create the font atlas and a context owning it on the main thread, init this backend and call ImGui_ImplSoftRaster_CreateFontsTexture(),
+//   then lock the atlas (atlas->Locked = true) before starting threads. The owner context must outlive the other ones.
+// - On each thread: ImGui::CreateContext(atlas), then ImGui_ImplSoftRaster_Init(1) so that each context rasterizes on its own thread only.
+//   Contexts sharing a locked atlas use the owner's font texture and never write to the atlas.
+
+// You can use unmodified imgui_impl_* files in your project. See examples/ folder for examples of using this.
+// Prefer including the entire imgui/ repository into your project (either as a copy or as a submodule), and only build the backends you need.
+// Learn about Dear ImGui:
+// - FAQ                  https://dearimgui.com/faq
+// - Getting Started      https://dearimgui.com/getting-started
+// - Documentation        https://dearimgui.com/docs (same as your local docs/ folder).
+// - Introduction, links and more at the top of imgui.cpp
+
+#pragma once
+#include "imgui.h"      // IMGUI_IMPL_API
+#ifndef IMGUI_DISABLE
+
+// Texture in RGBA32 format (ImU32 in IM_COL32() order), referenced by ImTextureID. Pixels are not copied and must stay valid while referenced.
+struct ImGui_ImplSoftRaster_Texture
+{
+    const ImU32*    Pixels;
+    int             Width;
+    int             Height;
+};
+
+// Render target in RGBA32 format (ImU32 in IM_COL32() order). Not cleared by ImGui_ImplSoftRaster_RenderDrawData().
+struct ImGui_ImplSoftRaster_Target
+{
+    ImU32*          Pixels;
+    int             Width;
+    int             Height;
+    int             Stride;             // Distance between rows, in pixels
+};
+
+// Follow "Getting Started" link and check examples/ folder to learn about using backends!
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_Init(int threads_count = 0);   // 0: one thread per hardware thread
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_Shutdown();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_NewFrame();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_RenderDrawData(ImDrawData* draw_data, const ImGui_ImplSoftRaster_Target* target);
+
+// (Optional) Called by Init/NewFrame/Shutdown
+IMGUI_IMPL_API bool     ImGui_ImplSoftRaster_CreateFontsTexture();
+IMGUI_IMPL_API void     ImGui_ImplSoftRaster_DestroyFontsTexture();
+
+#endif // #ifndef IMGUI_DISABLE
@@ -62,13 +62,16 @@ Index of this file:
 #if (defined __SSE__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))) && !defined(IMGUI_DISABLE_SSE)
 #define IMGUI_ENABLE_SSE
 #include <immintrin.h>
+#if (defined __SSE2__ || defined __x86_64__ || defined _M_X64 || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+#define IMGUI_ENABLE_SSE2
+#endif
 #if (defined __AVX__ || defined __SSE4_2__)
 #define IMGUI_ENABLE_SSE4_2
 #include <nmmintrin.h>
 #endif
 #endif
 // Emscripten has partial SSE 4.2 support where _mm_crc32_u32 is not available. See https://emscripten.org/docs/porting/simd.html#id11 and #8213
-#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(__EMSCRIPTEN__)
+#if defined(IMGUI_ENABLE_SSE4_2) && !defined(IMGUI_USE_LEGACY_CRC32_ADLER) && !defined(IMGUI_USE_FAST_HASH) && !defined(__EMSCRIPTEN__)
 #define IMGUI_ENABLE_SSE4_2_CRC
 #endif
 
@@ -212,8 +215,12 @@ typedef int ImGuiWindowRefreshFlags;    // -> enum ImGuiWindowRefreshFlags_ // F
 //-----------------------------------------------------------------------------
 
 #ifndef GImGui
+#ifdef IMGUI_USE_THREAD_LOCAL_CONTEXT
+extern thread_local ImGuiContext* GImGui; // Current implicit context pointer, one per thread
+#else
 extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 #endif
+#endif
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -357,6 +364,32 @@ extern IMGUI_API ImGuiContext* GImGui;  // Current implicit context pointer
 // Helpers: Hashing
 IMGUI_API ImGuiID       ImHashData(const void* data, size_t data_size, ImGuiID seed = 0);
 IMGUI_API ImGuiID       ImHashStr(const char* data, size_t data_size = 0, ImGuiID seed = 0);
+#ifdef IMGUI_USE_FAST_HASH
+// Fast hash is split in two steps: a seedless 64-bit hash of the bytes, then a cheap combine with the seed (= parent ID).
+// This is what allows string literals to be hashed at compile-time. Everything here is C++11 constexpr so it has to be written recursively.
+// - ImHashStrConst() follows the same "###" rule as ImHashStr(): only the part starting at the last "###" is hashed.
+// - Only meant for short literals (recursion depth grows with string length).
+// - Internal use only: IM_HASH_STR_LITERAL() covers the fixed IDs created by Dear ImGui itself. There is no public entry point,
+//   labels passed to public functions (e.g. Button("OK"), PushID("Node")) are still hashed at runtime by ImHashStr().
+#define IM_HASH_P0                      0xA0761D6478BD642FULL
+#define IM_HASH_P1                      0xE7037ED1A0B428DBULL
+static constexpr ImU64  ImHashXorShift(ImU64 h, int shift)                 { return h ^ (h >> shift); }
+static constexpr ImU64  ImHashFastStep(ImU64 h, ImU64 w)                    { return ImHashXorShift((h ^ w) * IM_HASH_P1, 31); }
+static constexpr ImU64  ImHashFastFmix(ImU64 h)                             { return ImHashXorShift(ImHashXorShift(ImHashXorShift(h, 33) * 0xFF51AFD7ED558CCDULL, 33) * 0xC4CEB9FE1A85EC53ULL, 33); }
+static constexpr ImGuiID ImHashFastCombine(ImU64 raw_hash, ImGuiID seed)    { return (ImGuiID)((ImHashXorShift(raw_hash ^ ((ImU64)seed * IM_HASH_P0), 32) * IM_HASH_P1) >> 32); }
+static constexpr ImU64  ImHashLoadConst(const char* p, size_t n)            { return n == 0 ? 0 : (ImU64)(unsigned char)p[0] | (ImHashLoadConst(p + 1, n - 1) << 8); }
+static constexpr ImU64  ImHashBlocksConst(const char* p, size_t n, ImU64 h) { return n >= 8 ? ImHashBlocksConst(p + 8, n - 8, ImHashFastStep(h, ImHashLoadConst(p, 8))) : n > 0 ? ImHashFastStep(h, ImHashLoadConst(p, n)) : h; }
+static constexpr ImU64  ImHashDataRawConst(const char* p, size_t n)         { return ImHashFastFmix(ImHashBlocksConst(p, n, IM_HASH_P0) ^ n); }
+static constexpr size_t ImStrlenConst(const char* s, size_t n = 0)          { return s[n] == 0 ? n : ImStrlenConst(s, n + 1); }
+static constexpr size_t ImHashStrFindIdMarkerConst(const char* s, size_t i, size_t last) { return s[i] == 0 ? last : ImHashStrFindIdMarkerConst(s, i + 1, (s[i] == '#' && s[i + 1] == '#' && s[i + 2] == '#') ? i : last); }
+static constexpr ImU64  ImHashStrRawConst2(const char* s, size_t start)     { return ImHashDataRawConst(s + start, ImStrlenConst(s + start)); }
+static constexpr ImU64  ImHashStrRawConst(const char* s)                    { return ImHashStrRawConst2(s, ImHashStrFindIdMarkerConst(s, 0, 0)); }
+IMGUI_API ImU64         ImHashDataRaw(const void* data, size_t data_size);  // Seedless 64-bit hash, == ImHashDataRawConst()
+template<ImU64 V> struct ImHashConstant { static const ImU64 Value = V; };   // Force compile-time evaluation
+#define IM_HASH_STR_LITERAL(_LITERAL, _SEED)    ImHashFastCombine(ImHashConstant<ImHashStrRawConst(_LITERAL)>::Value, _SEED)   // == ImHashStr(_LITERAL, 0, _SEED), evaluated at compile-time
+#else
+#define IM_HASH_STR_LITERAL(_LITERAL, _SEED)    ImHashStr(_LITERAL, sizeof(_LITERAL) - 1, _SEED)
+#endif
 
 // Helpers: Sorting
 #ifndef ImQsort
@@ -399,6 +432,9 @@ IMGUI_API int           ImFormatString(char* buf, size_t buf_size, const char* f
 IMGUI_API int           ImFormatStringV(char* buf, size_t buf_size, const char* fmt, va_list args) IM_FMTLIST(3);
 IMGUI_API void          ImFormatStringToTempBuffer(const char** out_buf, const char** out_buf_end, const char* fmt, ...) IM_FMTARGS(3);
 IMGUI_API void          ImFormatStringToTempBufferV(const char** out_buf, const char** out_buf_end, const char* fmt, va_list args) IM_FMTLIST(3);
+IMGUI_API int           ImFormatFloatFixed(char* buf, int buf_size, double v, int precision);   // Same as "%.Nf" without printf(). Return -1 if caller needs to fall back to ImFormatString().
+IMGUI_API const char*   ImParseDouble(const char* str, double* out);                            // Same as strtod(), faster for short decimal numbers. Return NULL if no number was parsed.
+IMGUI_API const char*   ImParseFloat(const char* str, float* out);                              // Same as strtof(), faster for short decimal numbers. Return NULL if no number was parsed.
 IMGUI_API const char*   ImParseFormatFindStart(const char* format);
 IMGUI_API const char*   ImParseFormatFindEnd(const char* format);
 IMGUI_API const char*   ImParseFormatTrimDecorations(const char* format, char* buf, size_t buf_size);
@@ -777,6 +813,43 @@ IMGUI_API ImGuiStoragePair* ImLowerBound(ImGuiStoragePair* in_begin, ImGuiStorag
 #endif
 #define IM_DRAWLIST_ARCFAST_SAMPLE_MAX                          IM_DRAWLIST_ARCFAST_TABLE_SIZE // Sample index _PathArcToFastEx() for 360 angle.
 
+// ImFontWrapCache: word-wrapped text shorter than this is laid out every time, as hashing it would cost about as much.
+#ifndef IM_FONT_WRAP_CACHE_MIN_TEXT_LENGTH
+#define IM_FONT_WRAP_CACHE_MIN_TEXT_LENGTH                      256
+#endif
+#define IM_FONT_WRAP_CACHE_MAX_UNUSED_FRAMES                    60 // Entries not used for this many frames are discarded.
+
+// Line breaks of a word-wrapped text, for a given font, size and wrap width
+struct ImFontWrapCacheEntry
+{
+    ImGuiID         Key;                    // Hash of TextHash, Font, FontSize, WrapWidth
+    ImGuiID         TextHash;               // Hash of text contents
+    int             TextLength;
+    ImFont*         Font;
+    const float*    FontAdvanceX;           // == Font->IndexAdvanceX.Data, so that rebuilding fonts invalidates the entry
+    float           FontSize;
+    float           WrapWidth;
+    int             LastFrameUsed;
+    ImVec2          Size;                   // == Font->CalcTextSizeA(FontSize, FLT_MAX, WrapWidth, text)
+    ImVector<int>   LineEnds;               // Offset of the end of each line (wrap position or '\n'). The next line starts after skipping blanks and one '\n'.
+};
+
+// Cache of word-wrapped text layouts, reused across frames by ImFont::RenderText() and ImGui::CalcTextSize().
+// Entries are keyed by text contents, so editing a text simply creates a new entry, and the old one expires.
+struct IMGUI_API ImFontWrapCache
+{
+    ImVector<ImFontWrapCacheEntry> Entries;
+    ImGuiStorage    EntriesMap;             // Key -> index in Entries
+    int             FrameCount;
+
+    ~ImFontWrapCache()                      { Clear(); }
+
+    // Return NULL when text is too short to be worth caching
+    const ImFontWrapCacheEntry* GetEntry(ImFont* font, float size, float wrap_width, const char* text_begin, const char* text_end);
+    void            NewFrame();             // Discard entries not used recently
+    void            Clear()                 { Entries.clear_destruct(); EntriesMap.Clear(); }
+};
+
 // Data shared between all ImDrawList instances
 // Conceptually this could have been called e.g. ImDrawListSharedContext
 // Typically one ImGui context would create and maintain one of this.
@@ -792,8 +865,10 @@ struct IMGUI_API ImDrawListSharedData
     float           CircleSegmentMaxError;      // Number of circle segments to use per pixel of radius for AddCircle() etc
     float           InitialFringeScale;         // Initial scale to apply to AA fringe
     ImDrawListFlags InitialFlags;               // Initial flags at the beginning of the frame (it is possible to alter flags on a per-drawlist basis afterwards)
+    ImFontAtlas*    GlyphTableAtlas;            // Atlas whose glyph table is used by the renderer for ImDrawGlyph::GlyphIndex (ImDrawListFlags_GlyphInstances)
     ImVec4          ClipRectFullscreen;         // Value for PushClipRectFullscreen()
     ImVector<ImVec2> TempBuffer;                // Temporary write buffer
+    ImFontWrapCache WrapCache;                  // Line breaks of long word-wrapped texts
 
     // Lookup tables
     ImVec2          ArcFastVtx[IM_DRAWLIST_ARCFAST_TABLE_SIZE]; // Sample points on the quarter of the circle.
@@ -994,6 +1069,7 @@ enum ImGuiSelectableFlagsPrivate_
 // Extend ImGuiTreeNodeFlags_
 enum ImGuiTreeNodeFlagsPrivate_
 {
+    ImGuiTreeNodeFlags_NoStoreOpen                = 1 << 27,// Open state is provided with SetNextItemOpen() and not stored in window storage (used by TreeViewNode())
     ImGuiTreeNodeFlags_ClipLabelForTrailingButton = 1 << 28,// FIXME-WIP: Hard-coded for CollapsingHeader()
     ImGuiTreeNodeFlags_UpsideDownArrow            = 1 << 29,// FIXME-WIP: Turn Down arrow into an Up arrow, for reversed trees (#6517)
     ImGuiTreeNodeFlags_OpenOnMask_                = ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_OpenOnArrow,
@@ -1563,8 +1639,14 @@ struct ImGuiListClipperData
     int                             ItemsFrozen;
     ImVector<ImGuiListClipperRange> Ranges;
 
+    // Variable item heights (ImGuiListClipper::ItemsHeights != NULL)
+    int                             MeasureItem;            // Item displayed by previous step, to measure (-1 if none)
+    float                           MeasureItemPosY;        // Cursor position when MeasureItem was displayed
+    int                             VisibleItemEnd;         // End of visible range, extended while measured items end before VisibleMaxY
+    float                           VisibleMaxY;
+
     ImGuiListClipperData()          { memset(this, 0, sizeof(*this)); }
-    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; Ranges.resize(0); }
+    void                            Reset(ImGuiListClipper* clipper) { ListClipper = clipper; StepNo = ItemsFrozen = 0; MeasureItem = -1; VisibleItemEnd = 0; VisibleMaxY = 0.0f; Ranges.resize(0); }
 };
 
 //-----------------------------------------------------------------------------
@@ -2064,6 +2146,7 @@ struct ImGuiContext
 {
     bool                    Initialized;
     bool                    FontAtlasOwnedByContext;            // IO.Fonts-> is owned by the ImGuiContext and will be destructed along with it.
+    bool                    FontAtlasLockedByFrame;             // IO.Fonts-> was locked by NewFrame() and will be unlocked by EndFrame(). Atlases already locked (e.g. shared between threads) are left untouched.
     ImGuiIO                 IO;
     ImGuiPlatformIO         PlatformIO;
     ImGuiStyle              Style;
@@ -2081,6 +2164,10 @@ struct ImGuiContext
     bool                    WithinFrameScope;                   // Set by NewFrame(), cleared by EndFrame()
     bool                    WithinFrameScopeWithImplicitWindow; // Set by NewFrame(), cleared by EndFrame() when the implicit debug window has been pushed
     bool                    GcCompactAll;                       // Request full GC
+    size_t                  GcTransientBytes;                   // Capacity of transient windows/tables buffers, measured by GcUpdateMemoryBudget()
+    size_t                  GcTransientBytesMax;                // Peak value of GcTransientBytes
+    int                     GcBudgetCompactCount;               // Number of windows/tables compacted to fit io.ConfigMemoryCompactBudget
+    int                     GcShrinkCount;                      // Number of draw lists shrunk by io.ConfigMemoryShrinkToFit
     bool                    TestEngineHookItems;                // Will call test engine hooks: ImGuiTestEngineHook_ItemAdd(), ImGuiTestEngineHook_ItemInfo(), ImGuiTestEngineHook_Log()
     void*                   TestEngine;                         // Test engine user data
     char                    ContextName[16];                    // Storage for a context name (to facilitate debugging multi-context setups)
@@ -2592,6 +2679,10 @@ struct IMGUI_API ImGuiWindow
 
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
+    int                     MemoryDrawListIdxPeak;              // Largest idx/vtx count since MemoryShrinkTime, to release capacity left over by a transient spike
+    int                     MemoryDrawListVtxPeak;
+    float                   MemoryShrinkTime;                   // Start of the current peak measurement period
+    size_t                  MemoryTransientBytes;               // Capacity of transient buffers, measured by GcUpdateMemoryBudget()
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
 
 public:
@@ -2698,7 +2789,9 @@ struct IMGUI_API ImGuiTabBar
 //-----------------------------------------------------------------------------
 
 #define IM_COL32_DISABLE                IM_COL32(0,0,0,1)   // Special sentinel code which cannot be used as a regular color.
-#define IMGUI_TABLE_MAX_COLUMNS         512                 // May be further lifted
+#ifndef IMGUI_TABLE_MAX_COLUMNS
+#define IMGUI_TABLE_MAX_COLUMNS         512                 // May be raised in imconfig.h for very wide tables, up to 32767 as ImGuiTableColumnIdx is 16-bit.
+#endif
 
 // Our current column maximum is 64 but we may raise that in the future.
 typedef ImS16 ImGuiTableColumnIdx;
@@ -2866,10 +2959,15 @@ struct IMGUI_API ImGuiTable
     ImVector<ImGuiTableInstanceData>    InstanceDataExtra;  // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableColumnSortSpecs   SortSpecsSingle;
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
+    ImVector<float>             ColumnsMaxXByOrder;         // Display order -> right edge of column (== start of next column). Running sum of widths, ascending within frozen and within unfrozen columns. See TableFindColumnOrderAtX().
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
     ImGuiTableColumnIdx         SortSpecsCount;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns using fixed width (<= ColumnsCount)
+    ImGuiTableColumnIdx         ColumnsVisibleCount;        // Number of visible (not clipped) columns. Only those get a draw channel.
+    ImGuiTableColumnIdx         VisibleUnfrozenOrderMin;    // Display order of first unfrozen column requesting output (visible or auto-fitting), -1 if none. See TableGetVisibleColumnsRange().
+    ImGuiTableColumnIdx         VisibleUnfrozenOrderMax;    // Display order of last unfrozen column requesting output, -1 if none.
+    ImGuiTableColumnIdx         FreezeColumnsOrderEnd;      // Display order of first unfrozen column (== ColumnsCount when all columns are frozen, 0 when none are).
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
     ImGuiTableColumnIdx         AngledHeadersCount;         // Count columns with angled headers
     ImGuiTableColumnIdx         HoveredColumnBody;          // Index of column whose visible region is being hovered. Important: == ColumnsCount when hovering empty region after the right-most column!
@@ -2929,6 +3027,7 @@ struct IMGUI_API ImGuiTableTempData
 {
     int                         TableIndex;                 // Index in g.Tables.Buf[] pool
     float                       LastTimeActive;             // Last timestamp this structure was used
+    int                         LastFrameActive;            // Last frame this structure was used
     float                       AngledHeadersExtraWidth;    // Used in EndTable()
     ImVector<ImGuiTableHeaderData> AngledHeadersRequests;   // Used in TableAngledHeadersRow()
 
@@ -3369,6 +3468,8 @@ namespace ImGui
     IMGUI_API const char*   TableGetColumnName(const ImGuiTable* table, int column_n);
     IMGUI_API ImGuiID       TableGetColumnResizeID(ImGuiTable* table, int column_n, int instance_no = 0);
     IMGUI_API float         TableCalcMaxColumnWidth(const ImGuiTable* table, int column_n);
+    IMGUI_API bool          TableGetVisibleColumnsRange(const ImGuiTable* table, int* out_order_min, int* out_order_max);
+    IMGUI_API int           TableFindColumnOrderAtX(const ImGuiTable* table, float x);
     IMGUI_API void          TableSetColumnWidthAutoSingle(ImGuiTable* table, int column_n);
     IMGUI_API void          TableSetColumnWidthAutoAll(ImGuiTable* table);
     IMGUI_API void          TableRemove(ImGuiTable* table);
@@ -3512,6 +3613,8 @@ namespace ImGui
     IMGUI_API void          GcCompactTransientMiscBuffers();
     IMGUI_API void          GcCompactTransientWindowBuffers(ImGuiWindow* window);
     IMGUI_API void          GcAwakeTransientWindowBuffers(ImGuiWindow* window);
+    IMGUI_API size_t        GcCalcTransientWindowBuffersSize(ImGuiWindow* window);
+    IMGUI_API void          GcUpdateMemoryBudget();
 
     // Error handling, State Recovery
     IMGUI_API bool          ErrorLog(const char* msg);
@@ -3525,6 +3628,9 @@ namespace ImGui
 
     // Debug Tools
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+#ifdef IMGUI_DEBUG_ALLOC_CALL_SITES
+    IMGUI_API const void*   DebugGetAllocCallSite();                        // Address of code which called MemAlloc(), for use by a custom allocator function
+#endif
     IMGUI_API void          DebugDrawCursorPos(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawLineExtents(ImU32 col = IM_COL32(255, 0, 0, 255));
     IMGUI_API void          DebugDrawItemRect(ImU32 col = IM_COL32(255, 0, 0, 255));
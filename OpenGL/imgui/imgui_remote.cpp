@@ -0,0 +1,1151 @@
+// dear imgui: streaming of draw data to remote viewers
+// See imgui_remote.h for details.
+
+// Message format (little-endian):
+//   Header:        u32 magic, u8 version, u8 flags (RemoteMessageFlags_), u16 reserved, u32 body size, u32 packed body size
+//   Body:          u32 frame index, u8 sizeof(ImDrawVert), u8 sizeof(ImDrawIdx), 6 floats: DisplayPos, DisplaySize, FramebufferScale
+//                  u16 textures count, for each: u16 texture index, u32 width, u32 height, width*height RGBA32 pixels
+//                  u16 draw lists count, for each: u8 RemoteListOp_, then for RemoteListOp_Delta, for each of the 3 streams:
+//                  varint prefix size, varint suffix size, varint middle size, u8 RemoteMiddleOp_, middle bytes
+//   Streams:       commands: 30 bytes each (ClipRect, u16 texture index, VtxOffset, IdxOffset, ElemCount)
+//                  vertices: ImDrawVert array
+//                  indices: ImDrawIdx array, each one stored as difference with previous one (so that shifted index ranges stay equal)
+// The body is compressed as a sequence of LZ4-style tokens: u8 token (literals count << 4 | match length - 4), extra literals count bytes,
+// literals, then except for the last token: u16 match offset, extra match length bytes.
+
+#if defined(_MSC_VER) && !defined(_CRT_SECURE_NO_WARNINGS)
+#define _CRT_SECURE_NO_WARNINGS
+#endif
+
+#include "imgui.h"
+#ifndef IMGUI_DISABLE
+#include "imgui_remote.h"
+#include <stdio.h>          // FILE, fopen, fwrite, fread
+#include <string.h>         // memcpy, memcmp, strlen
+#include <chrono>           // std::chrono::steady_clock
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#ifdef _MSC_VER
+#pragma comment(lib, "ws2_32")
+#endif
+typedef SOCKET RemoteSocket;
+#define REMOTE_INVALID_SOCKET   INVALID_SOCKET
+#define REMOTE_WOULD_BLOCK()    (WSAGetLastError() == WSAEWOULDBLOCK)
+#define REMOTE_CLOSE_SOCKET     closesocket
+#else
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+typedef int RemoteSocket;
+#define REMOTE_INVALID_SOCKET   (-1)
+#define REMOTE_WOULD_BLOCK()    (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)
+#define REMOTE_CLOSE_SOCKET     close
+#endif
+#ifdef MSG_NOSIGNAL
+#define REMOTE_SEND_FLAGS       MSG_NOSIGNAL    // Don't raise SIGPIPE when the viewer went away
+#else
+#define REMOTE_SEND_FLAGS       0
+#endif
+
+static const ImU32  REMOTE_MAGIC = 0x53524D49;      // "IMRS"
+static const int    REMOTE_VERSION = 1;
+static const int    REMOTE_HEADER_SIZE = 16;
+static const int    REMOTE_MAX_MESSAGE_SIZE = 256 * 1024 * 1024;
+static const int    REMOTE_CMD_SIZE = 30;
+static const ImU16  REMOTE_TEX_UNKNOWN = 0xFFFF;
+static const ImU16  REMOTE_TEX_RESET_RENDER_STATE = 0xFFFE;
+static const int    REMOTE_HASH_BITS = 14;
+
+enum RemoteMessageFlags_
+{
+    RemoteMessageFlags_KeyFrame     = 1 << 0,
+    RemoteMessageFlags_Compressed   = 1 << 1,
+};
+
+enum RemoteListOp_
+{
+    RemoteListOp_Unchanged  = 0,
+    RemoteListOp_Delta      = 1,
+};
+
+enum RemoteMiddleOp_
+{
+    RemoteMiddleOp_Copy     = 0,    // Middle bytes replace previous ones
+    RemoteMiddleOp_Xor      = 1,    // Same size as previous middle: bytes are XOR-ed with previous ones
+};
+
+static double RemoteGetTime()
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//-----------------------------------------------------------------------------
+// Serialization helpers
+//-----------------------------------------------------------------------------
+
+static void RemoteWriteBytes(ImVector<unsigned char>* buf, const void* data, int size)
+{
+    const int offset = buf->Size;
+    buf->resize(offset + size);
+    if (size > 0)
+        memcpy(buf->Data + offset, data, (size_t)size);
+}
+static void RemoteWriteU8(ImVector<unsigned char>* buf, int v)      { buf->push_back((unsigned char)v); }
+static void RemoteWriteU16(ImVector<unsigned char>* buf, int v)     { unsigned char b[2] = { (unsigned char)v, (unsigned char)(v >> 8) }; RemoteWriteBytes(buf, b, 2); }
+static void RemoteWriteU32(ImVector<unsigned char>* buf, ImU32 v)   { unsigned char b[4] = { (unsigned char)v, (unsigned char)(v >> 8), (unsigned char)(v >> 16), (unsigned char)(v >> 24) }; RemoteWriteBytes(buf, b, 4); }
+static void RemoteWriteFloat(ImVector<unsigned char>* buf, float v) { ImU32 u; memcpy(&u, &v, 4); RemoteWriteU32(buf, u); }
+static void RemoteWriteVarInt(ImVector<unsigned char>* buf, ImU32 v)
+{
+    while (v >= 0x80)
+    {
+        RemoteWriteU8(buf, (int)(v & 0x7F) | 0x80);
+        v >>= 7;
+    }
+    RemoteWriteU8(buf, (int)v);
+}
+static void RemotePatchU32(unsigned char* p, ImU32 v)               { p[0] = (unsigned char)v; p[1] = (unsigned char)(v >> 8); p[2] = (unsigned char)(v >> 16); p[3] = (unsigned char)(v >> 24); }
+static ImU32 RemoteLoadU32(const unsigned char* p)                  { return (ImU32)p[0] | ((ImU32)p[1] << 8) | ((ImU32)p[2] << 16) | ((ImU32)p[3] << 24); }
+
+// Bounds-checked reader: reading past the end sets Error and returns zeros
+struct RemoteReader
+{
+    const unsigned char* P;
+    const unsigned char* End;
+    bool            Error;
+
+    RemoteReader(const unsigned char* p, int size) : P(p), End(p + size), Error(false) {}
+    const unsigned char* Skip(int size)     { if (size < 0 || End - P < size) { Error = true; P = End; return NULL; } const unsigned char* r = P; P += size; return r; }
+    int     ReadU8()                        { const unsigned char* p = Skip(1); return p ? p[0] : 0; }
+    int     ReadU16()                       { const unsigned char* p = Skip(2); return p ? (p[0] | (p[1] << 8)) : 0; }
+    ImU32   ReadU32()                       { const unsigned char* p = Skip(4); return p ? RemoteLoadU32(p) : 0; }
+    float   ReadFloat()                     { ImU32 u = ReadU32(); float v; memcpy(&v, &u, 4); return v; }
+    int     ReadVarInt()
+    {
+        ImU32 v = 0;
+        for (int shift = 0; shift < 32; shift += 7)
+        {
+            const int b = ReadU8();
+            v |= (ImU32)(b & 0x7F) << shift;
+            if ((b & 0x80) == 0)
+                break;
+        }
+        if (v > (ImU32)REMOTE_MAX_MESSAGE_SIZE)
+            Error = true;
+        return Error ? 0 : (int)v;
+    }
+};
+
+//-----------------------------------------------------------------------------
+// Compression
+//-----------------------------------------------------------------------------
+
+static void RemoteWriteLength(ImVector<unsigned char>* out, int len)
+{
+    for (; len >= 255; len -= 255)
+        RemoteWriteU8(out, 255);
+    RemoteWriteU8(out, len);
+}
+
+static void RemoteWriteSequence(ImVector<unsigned char>* out, const unsigned char* literals, int literals_count, int match_offset, int match_len)
+{
+    const int lit_token = literals_count < 15 ? literals_count : 15;
+    const int match_token = match_len == 0 ? 0 : (match_len - 4 < 15 ? match_len - 4 : 15);
+    RemoteWriteU8(out, (lit_token << 4) | match_token);
+    if (lit_token == 15)
+        RemoteWriteLength(out, literals_count - 15);
+    RemoteWriteBytes(out, literals, literals_count);
+    if (match_len == 0)
+        return;
+    RemoteWriteU16(out, match_offset);
+    if (match_token == 15)
+        RemoteWriteLength(out, match_len - 4 - 15);
+}
+
+// Greedy LZ77 with a hash table of 4-byte sequences and 64 KB window. Append to 'out'.
+static void RemoteCompress(const unsigned char* src, int src_size, ImVector<int>* hash_table, ImVector<unsigned char>* out)
+{
+    hash_table->resize(1 << REMOTE_HASH_BITS);
+    memset(hash_table->Data, 0xFF, (size_t)hash_table->size_in_bytes());
+    int* table = hash_table->Data;
+    int anchor = 0;
+    int pos = 0;
+    while (pos + 4 <= src_size)
+    {
+        const ImU32 seq = RemoteLoadU32(src + pos);
+        const ImU32 hash = (seq * 2654435761u) >> (32 - REMOTE_HASH_BITS);
+        const int ref = table[hash];
+        table[hash] = pos;
+        if (ref < 0 || pos - ref > 0xFFFF || RemoteLoadU32(src + ref) != seq)
+        {
+            pos += 1 + ((pos - anchor) >> 6); // Skip faster through incompressible data
+            continue;
+        }
+        int len = 4;
+        while (pos + len < src_size && src[ref + len] == src[pos + len])
+            len++;
+        RemoteWriteSequence(out, src + anchor, pos - anchor, pos - ref, len);
+        pos += len;
+        anchor = pos;
+    }
+    RemoteWriteSequence(out, src + anchor, src_size - anchor, 0, 0);
+}
+
+static int RemoteReadLength(RemoteReader* r, int len)
+{
+    if (len != 15)
+        return len;
+    for (int b = 255; b == 255 && !r->Error; )
+    {
+        b = r->ReadU8();
+        len += b;
+    }
+    return len;
+}
+
+static bool RemoteDecompress(const unsigned char* src, int src_size, unsigned char* dst, int dst_size)
+{
+    RemoteReader r(src, src_size);
+    int out = 0;
+    while (r.P < r.End)
+    {
+        const int token = r.ReadU8();
+        const int literals_count = RemoteReadLength(&r, token >> 4);
+        const unsigned char* literals = r.Skip(literals_count);
+        if (r.Error || literals_count > dst_size - out)
+            return false;
+        memcpy(dst + out, literals, (size_t)literals_count);
+        out += literals_count;
+        if (r.P == r.End)
+            break;
+        const int offset = r.ReadU16();
+        const int match_len = RemoteReadLength(&r, token & 15) + 4;
+        if (r.Error || offset == 0 || offset > out || match_len > dst_size - out)
+            return false;
+        const unsigned char* match = dst + out - offset;
+        if (offset >= match_len)
+            memcpy(dst + out, match, (size_t)match_len);
+        else
+            for (int n = 0; n < match_len; n++) // Overlapping: repeats last 'offset' bytes
+                dst[out + n] = match[n];
+        out += match_len;
+    }
+    return out == dst_size;
+}
+
+//-----------------------------------------------------------------------------
+// Delta encoding of streams
+//-----------------------------------------------------------------------------
+
+static void RemoteEncodeStream(ImVector<unsigned char>* out, const unsigned char* curr, int curr_size, const unsigned char* prev, int prev_size)
+{
+    const int common_max = curr_size < prev_size ? curr_size : prev_size;
+    int prefix = 0;
+    while (prefix < common_max && curr[prefix] == prev[prefix])
+        prefix++;
+    int suffix = 0;
+    while (suffix < common_max - prefix && curr[curr_size - 1 - suffix] == prev[prev_size - 1 - suffix])
+        suffix++;
+    const int middle_size = curr_size - prefix - suffix;
+    const bool xor_middle = middle_size > 0 && middle_size == prev_size - prefix - suffix;
+    RemoteWriteVarInt(out, (ImU32)prefix);
+    RemoteWriteVarInt(out, (ImU32)suffix);
+    RemoteWriteVarInt(out, (ImU32)middle_size);
+    RemoteWriteU8(out, xor_middle ? RemoteMiddleOp_Xor : RemoteMiddleOp_Copy);
+    const int offset = out->Size;
+    RemoteWriteBytes(out, curr + prefix, middle_size);
+    if (xor_middle)
+        for (int n = 0; n < middle_size; n++)
+            out->Data[offset + n] ^= prev[prefix + n];
+}
+
+static bool RemoteDecodeStream(RemoteReader* r, ImVector<unsigned char>* out, const unsigned char* prev, int prev_size)
+{
+    const int prefix = r->ReadVarInt();
+    const int suffix = r->ReadVarInt();
+    const int middle_size = r->ReadVarInt();
+    const int op = r->ReadU8();
+    const unsigned char* middle = r->Skip(middle_size);
+    if (r->Error || prefix + suffix > prev_size || (op == RemoteMiddleOp_Xor && prefix + middle_size + suffix != prev_size) || op > RemoteMiddleOp_Xor)
+        return false;
+    RemoteWriteBytes(out, prev, prefix);
+    const int offset = out->Size;
+    RemoteWriteBytes(out, middle, middle_size);
+    if (op == RemoteMiddleOp_Xor)
+        for (int n = 0; n < middle_size; n++)
+            out->Data[offset + n] ^= prev[prefix + n];
+    RemoteWriteBytes(out, prev + prev_size - suffix, suffix);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteEncoder
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteEncoder::ImGuiRemoteEncoder()
+{
+    memset(&Stats, 0, sizeof(Stats));
+    FontTexID = 0;
+    KeyFrameRequested = true;
+    ExpandedList = NULL;
+}
+
+ImGuiRemoteEncoder::~ImGuiRemoteEncoder()
+{
+    Clear();
+}
+
+void ImGuiRemoteEncoder::SetTexture(ImTextureID tex_id, const ImU32* pixels, int width, int height)
+{
+    int tex_n = 0;
+    while (tex_n < Textures.Size && Textures[tex_n].TexID != tex_id)
+        tex_n++;
+    IM_ASSERT(tex_n < REMOTE_TEX_RESET_RENDER_STATE && "Too many textures!");
+    if (tex_n == Textures.Size)
+    {
+        ImGuiRemoteTexture new_tex;
+        memset(&new_tex, 0, sizeof(new_tex));
+        new_tex.TexID = tex_id;
+        Textures.push_back(new_tex);
+    }
+    ImGuiRemoteTexture& tex = Textures[tex_n];
+    if (tex.Width * tex.Height != width * height)
+    {
+        // Size changed: rebuild pixel storage without previous pixels of this texture
+        ImVector<ImU32> pixels_storage;
+        for (ImGuiRemoteTexture& other : Textures)
+        {
+            if (&other == &tex)
+                continue;
+            const int offset = pixels_storage.Size;
+            pixels_storage.resize(offset + other.Width * other.Height);
+            memcpy(pixels_storage.Data + offset, TexturePixels.Data + other.PixelsOffset, (size_t)other.Width * other.Height * 4);
+            other.PixelsOffset = offset;
+        }
+        tex.PixelsOffset = pixels_storage.Size;
+        pixels_storage.resize(pixels_storage.Size + width * height);
+        TexturePixels.swap(pixels_storage);
+    }
+    tex.Width = width;
+    tex.Height = height;
+    tex.Dirty = true;
+    memcpy(TexturePixels.Data + tex.PixelsOffset, pixels, (size_t)width * height * 4);
+}
+
+void ImGuiRemoteEncoder::RequestKeyFrame()
+{
+    KeyFrameRequested = true;
+}
+
+void ImGuiRemoteEncoder::Clear()
+{
+    PrevFrame.clear();
+    CurrFrame.clear();
+    PrevLists.clear();
+    CurrLists.clear();
+    Body.clear();
+    HashTable.clear();
+    Textures.clear();
+    TexturePixels.clear();
+    FontTexID = 0;
+    KeyFrameRequested = true;
+    if (ExpandedList)
+        IM_DELETE(ExpandedList);
+    ExpandedList = NULL;
+}
+
+void ImGuiRemoteEncoder::EncodeFrame(ImDrawData* draw_data, ImVector<unsigned char>* out_message)
+{
+    const double start_time = RemoteGetTime();
+
+    // Register font atlas, or send it again after it was rebuilt
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    if (atlas->TexID != FontTexID)
+    {
+        unsigned char* pixels;
+        int width, height;
+        atlas->GetTexDataAsRGBA32(&pixels, &width, &height);
+        SetTexture(atlas->TexID, (const ImU32*)(const void*)pixels, width, height);
+        FontTexID = atlas->TexID;
+    }
+
+    const bool key_frame = KeyFrameRequested;
+    KeyFrameRequested = false;
+    Body.resize(0);
+    RemoteWriteU32(&Body, (ImU32)Stats.FrameCount);
+    RemoteWriteU8(&Body, (int)sizeof(ImDrawVert));
+    RemoteWriteU8(&Body, (int)sizeof(ImDrawIdx));
+    RemoteWriteFloat(&Body, draw_data->DisplayPos.x);
+    RemoteWriteFloat(&Body, draw_data->DisplayPos.y);
+    RemoteWriteFloat(&Body, draw_data->DisplaySize.x);
+    RemoteWriteFloat(&Body, draw_data->DisplaySize.y);
+    RemoteWriteFloat(&Body, draw_data->FramebufferScale.x);
+    RemoteWriteFloat(&Body, draw_data->FramebufferScale.y);
+
+    // Texture updates
+    int textures_count = 0;
+    for (ImGuiRemoteTexture& tex : Textures)
+        if (tex.Dirty || key_frame)
+            textures_count++;
+    RemoteWriteU16(&Body, textures_count);
+    for (int tex_n = 0; tex_n < Textures.Size; tex_n++)
+    {
+        ImGuiRemoteTexture& tex = Textures[tex_n];
+        if (!tex.Dirty && !key_frame)
+            continue;
+        RemoteWriteU16(&Body, tex_n);
+        RemoteWriteU32(&Body, (ImU32)tex.Width);
+        RemoteWriteU32(&Body, (ImU32)tex.Height);
+        RemoteWriteBytes(&Body, TexturePixels.Data + tex.PixelsOffset, tex.Width * tex.Height * 4);
+        tex.Dirty = false;
+    }
+
+    // Serialize draw lists
+    CurrFrame.resize(0);
+    CurrLists.resize(draw_data->CmdListsCount);
+    int raw_bytes = 0;
+    for (int list_n = 0; list_n < draw_data->CmdListsCount; list_n++)
+    {
+        const ImDrawList* draw_list = draw_data->CmdLists[list_n];
+        ImGuiRemoteListStreams& streams = CurrLists[list_n];
+        if (draw_list->GlyphBuffer.Size > 0)
+        {
+            if (ExpandedList == NULL)
+                ExpandedList = IM_NEW(ImDrawList)(draw_list->_Data);
+            draw_list->ExpandGlyphsTo(ExpandedList);
+            draw_list = ExpandedList;
+        }
+
+        streams.Offsets[0] = CurrFrame.Size;
+        int last_tex_n = -1;
+        ImTextureID last_tex_id = 0;
+        for (const ImDrawCmd& cmd : draw_list->CmdBuffer)
+        {
+            int tex_n;
+            if (cmd.UserCallback == ImDrawCallback_ResetRenderState)
+                tex_n = REMOTE_TEX_RESET_RENDER_STATE;
+            else if (cmd.UserCallback != NULL)
+                continue;
+            else if (last_tex_n != -1 && cmd.GetTexID() == last_tex_id)
+                tex_n = last_tex_n;
+            else
+            {
+                tex_n = 0;
+                while (tex_n < Textures.Size && Textures[tex_n].TexID != cmd.GetTexID())
+                    tex_n++;
+                if (tex_n == Textures.Size)
+                    tex_n = REMOTE_TEX_UNKNOWN;
+                last_tex_n = tex_n;
+                last_tex_id = cmd.GetTexID();
+            }
+            RemoteWriteFloat(&CurrFrame, cmd.ClipRect.x);
+            RemoteWriteFloat(&CurrFrame, cmd.ClipRect.y);
+            RemoteWriteFloat(&CurrFrame, cmd.ClipRect.z);
+            RemoteWriteFloat(&CurrFrame, cmd.ClipRect.w);
+            RemoteWriteU16(&CurrFrame, tex_n);
+            RemoteWriteU32(&CurrFrame, cmd.VtxOffset);
+            RemoteWriteU32(&CurrFrame, cmd.IdxOffset);
+            RemoteWriteU32(&CurrFrame, cmd.ElemCount);
+        }
+        streams.Sizes[0] = CurrFrame.Size - streams.Offsets[0];
+
+        streams.Offsets[1] = CurrFrame.Size;
+        streams.Sizes[1] = draw_list->VtxBuffer.size_in_bytes();
+        RemoteWriteBytes(&CurrFrame, draw_list->VtxBuffer.Data, streams.Sizes[1]);
+
+        streams.Offsets[2] = CurrFrame.Size;
+        streams.Sizes[2] = draw_list->IdxBuffer.size_in_bytes();
+        CurrFrame.resize(CurrFrame.Size + streams.Sizes[2]);
+        unsigned char* idx_deltas = CurrFrame.Data + streams.Offsets[2];
+        ImDrawIdx prev_idx = 0;
+        for (int idx_n = 0; idx_n < draw_list->IdxBuffer.Size; idx_n++)
+        {
+            const ImDrawIdx idx = draw_list->IdxBuffer.Data[idx_n];
+            const ImDrawIdx delta = (ImDrawIdx)(idx - prev_idx);
+            memcpy(idx_deltas + idx_n * sizeof(ImDrawIdx), &delta, sizeof(ImDrawIdx));
+            prev_idx = idx;
+        }
+        raw_bytes += streams.Sizes[0] + streams.Sizes[1] + streams.Sizes[2];
+    }
+
+    // Delta-encode against previous frame
+    int lists_changed = 0;
+    RemoteWriteU16(&Body, draw_data->CmdListsCount);
+    for (int list_n = 0; list_n < CurrLists.Size; list_n++)
+    {
+        const ImGuiRemoteListStreams& curr = CurrLists[list_n];
+        const ImGuiRemoteListStreams* prev = (!key_frame && list_n < PrevLists.Size) ? &PrevLists[list_n] : NULL;
+        bool unchanged = (prev != NULL);
+        for (int stream_n = 0; stream_n < 3 && unchanged; stream_n++)
+            unchanged = curr.Sizes[stream_n] == prev->Sizes[stream_n] && memcmp(CurrFrame.Data + curr.Offsets[stream_n], PrevFrame.Data + prev->Offsets[stream_n], (size_t)curr.Sizes[stream_n]) == 0;
+        if (unchanged)
+        {
+            RemoteWriteU8(&Body, RemoteListOp_Unchanged);
+            continue;
+        }
+        RemoteWriteU8(&Body, RemoteListOp_Delta);
+        for (int stream_n = 0; stream_n < 3; stream_n++)
+            RemoteEncodeStream(&Body, CurrFrame.Data + curr.Offsets[stream_n], curr.Sizes[stream_n],
+                prev ? PrevFrame.Data + prev->Offsets[stream_n] : NULL, prev ? prev->Sizes[stream_n] : 0);
+        lists_changed++;
+    }
+    PrevFrame.swap(CurrFrame);
+    PrevLists.swap(CurrLists);
+
+    // Header and compressed body. Keep body uncompressed if compression doesn't help.
+    const int message_offset = out_message->Size;
+    RemoteWriteU32(out_message, REMOTE_MAGIC);
+    RemoteWriteU8(out_message, REMOTE_VERSION);
+    RemoteWriteU8(out_message, 0);
+    RemoteWriteU16(out_message, 0);
+    RemoteWriteU32(out_message, (ImU32)Body.Size);
+    RemoteWriteU32(out_message, 0);
+    RemoteCompress(Body.Data, Body.Size, &HashTable, out_message);
+    int flags = (key_frame ? RemoteMessageFlags_KeyFrame : 0) | RemoteMessageFlags_Compressed;
+    if (out_message->Size - message_offset - REMOTE_HEADER_SIZE >= Body.Size)
+    {
+        out_message->resize(message_offset + REMOTE_HEADER_SIZE);
+        RemoteWriteBytes(out_message, Body.Data, Body.Size);
+        flags &= ~RemoteMessageFlags_Compressed;
+    }
+    const int message_size = out_message->Size - message_offset;
+    out_message->Data[message_offset + 5] = (unsigned char)flags;
+    RemotePatchU32(out_message->Data + message_offset + 12, (ImU32)(message_size - REMOTE_HEADER_SIZE));
+
+    Stats.FrameCount++;
+    Stats.KeyFrameCount += key_frame ? 1 : 0;
+    Stats.FrameBytes = message_size;
+    Stats.FrameRawBytes = raw_bytes;
+    Stats.FrameListsChanged = lists_changed;
+    Stats.FrameListsUnchanged = draw_data->CmdListsCount - lists_changed;
+    Stats.FrameTime = RemoteGetTime() - start_time;
+    Stats.TotalBytes += (ImU64)message_size;
+    Stats.TotalRawBytes += (ImU64)raw_bytes;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteDecoder
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteDecoder::ImGuiRemoteDecoder()
+{
+    CreateTextureFunc = NULL;
+    DestroyTextureFunc = NULL;
+    UserData = NULL;
+    memset(&Stats, 0, sizeof(Stats));
+    HasPrevFrame = false;
+}
+
+ImGuiRemoteDecoder::~ImGuiRemoteDecoder()
+{
+    Clear();
+}
+
+void ImGuiRemoteDecoder::Clear()
+{
+    for (ImDrawList* draw_list : DrawLists)
+        IM_DELETE(draw_list);
+    DrawLists.clear();
+    DrawData.Clear();
+    DrawData.CmdLists.clear();
+    for (ImGuiRemoteTexture& tex : Textures)
+        if (tex.TexID != 0 && DestroyTextureFunc != NULL)
+            DestroyTextureFunc(tex.TexID, UserData);
+    Textures.clear();
+    PrevFrame.clear();
+    CurrFrame.clear();
+    PrevLists.clear();
+    CurrLists.clear();
+    Body.clear();
+    HasPrevFrame = false;
+}
+
+int ImGuiRemoteDecoder::GetMessageSize(const void* data, int data_size)
+{
+    const unsigned char* p = (const unsigned char*)data;
+    if (data_size >= 4 && RemoteLoadU32(p) != REMOTE_MAGIC)
+        return -1;
+    if (data_size < REMOTE_HEADER_SIZE)
+        return 0;
+    const ImU32 packed_size = RemoteLoadU32(p + 12);
+    if (p[4] != REMOTE_VERSION || packed_size > (ImU32)REMOTE_MAX_MESSAGE_SIZE || RemoteLoadU32(p + 8) > (ImU32)REMOTE_MAX_MESSAGE_SIZE)
+        return -1;
+    return REMOTE_HEADER_SIZE + (int)packed_size;
+}
+
+bool ImGuiRemoteDecoder::DecodeFrame(const void* message, int message_size)
+{
+    const double start_time = RemoteGetTime();
+    if (GetMessageSize(message, message_size) != message_size)
+        return false;
+    const unsigned char* header = (const unsigned char*)message;
+    const int flags = header[5];
+    const int body_size = (int)RemoteLoadU32(header + 8);
+    const bool key_frame = (flags & RemoteMessageFlags_KeyFrame) != 0;
+    if (!key_frame && !HasPrevFrame)
+        return false;
+
+    // Decompress
+    const unsigned char* body = header + REMOTE_HEADER_SIZE;
+    if (flags & RemoteMessageFlags_Compressed)
+    {
+        Body.resize(body_size);
+        if (!RemoteDecompress(body, message_size - REMOTE_HEADER_SIZE, Body.Data, body_size))
+            return false;
+        body = Body.Data;
+    }
+    else if (body_size != message_size - REMOTE_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    // Frame header
+    RemoteReader r(body, body_size);
+    r.ReadU32(); // Frame index
+    if (r.ReadU8() != (int)sizeof(ImDrawVert) || r.ReadU8() != (int)sizeof(ImDrawIdx))
+        return false;
+    ImVec2 display_pos, display_size, framebuffer_scale;
+    display_pos.x = r.ReadFloat();
+    display_pos.y = r.ReadFloat();
+    display_size.x = r.ReadFloat();
+    display_size.y = r.ReadFloat();
+    framebuffer_scale.x = r.ReadFloat();
+    framebuffer_scale.y = r.ReadFloat();
+
+    // Texture updates
+    const int textures_count = r.ReadU16();
+    for (int n = 0; n < textures_count && !r.Error; n++)
+    {
+        const int tex_n = r.ReadU16();
+        const ImU32 width = r.ReadU32(), height = r.ReadU32();
+        if (tex_n >= REMOTE_TEX_RESET_RENDER_STATE || width == 0 || height == 0 || width > 16384 || height > 16384)
+            return false;
+        const unsigned char* pixels = r.Skip((int)(width * height * 4));
+        if (r.Error)
+            return false;
+        while (Textures.Size <= tex_n)
+        {
+            ImGuiRemoteTexture new_tex;
+            memset(&new_tex, 0, sizeof(new_tex));
+            Textures.push_back(new_tex);
+        }
+        ImGuiRemoteTexture& tex = Textures[tex_n];
+        if (tex.TexID != 0 && DestroyTextureFunc != NULL)
+            DestroyTextureFunc(tex.TexID, UserData);
+        tex.TexID = CreateTextureFunc ? CreateTextureFunc((const ImU32*)(const void*)pixels, (int)width, (int)height, UserData) : 0;
+        tex.Width = (int)width;
+        tex.Height = (int)height;
+    }
+
+    // Rebuild streams from previous frame. Draw data is invalid until all lists are rebuilt, and a key frame is needed after an error.
+    const int prev_lists_count = DrawData.Valid ? DrawData.CmdListsCount : 0;
+    DrawData.Valid = false;
+    HasPrevFrame = false;
+    const int lists_count = r.ReadU16();
+    CurrFrame.resize(0);
+    CurrLists.resize(lists_count);
+    int lists_changed = 0;
+    for (int list_n = 0; list_n < lists_count && !r.Error; list_n++)
+    {
+        ImGuiRemoteListStreams& curr = CurrLists[list_n];
+        const ImGuiRemoteListStreams* prev = (!key_frame && list_n < PrevLists.Size) ? &PrevLists[list_n] : NULL;
+        const int op = r.ReadU8();
+        if (op == RemoteListOp_Unchanged && prev == NULL)
+            return false;
+        if (op != RemoteListOp_Unchanged && op != RemoteListOp_Delta)
+            return false;
+        for (int stream_n = 0; stream_n < 3; stream_n++)
+        {
+            const unsigned char* prev_data = prev ? PrevFrame.Data + prev->Offsets[stream_n] : NULL;
+            const int prev_size = prev ? prev->Sizes[stream_n] : 0;
+            curr.Offsets[stream_n] = CurrFrame.Size;
+            if (op == RemoteListOp_Unchanged)
+                RemoteWriteBytes(&CurrFrame, prev_data, prev_size);
+            else if (!RemoteDecodeStream(&r, &CurrFrame, prev_data, prev_size))
+                return false;
+            curr.Sizes[stream_n] = CurrFrame.Size - curr.Offsets[stream_n];
+        }
+        if (curr.Sizes[0] % REMOTE_CMD_SIZE != 0 || curr.Sizes[1] % sizeof(ImDrawVert) != 0 || curr.Sizes[2] % sizeof(ImDrawIdx) != 0)
+            return false;
+
+        // Rebuild changed draw lists
+        if (list_n >= DrawLists.Size)
+            DrawLists.push_back(IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData()));
+        if (op == RemoteListOp_Unchanged && list_n < prev_lists_count)
+            continue;
+        lists_changed++;
+        ImDrawList* draw_list = DrawLists[list_n];
+        const int vtx_count = curr.Sizes[1] / (int)sizeof(ImDrawVert);
+        const int idx_count = curr.Sizes[2] / (int)sizeof(ImDrawIdx);
+        draw_list->VtxBuffer.resize(vtx_count);
+        if (vtx_count > 0)
+            memcpy(draw_list->VtxBuffer.Data, CurrFrame.Data + curr.Offsets[1], (size_t)curr.Sizes[1]);
+        draw_list->IdxBuffer.resize(idx_count);
+        const unsigned char* idx_deltas = CurrFrame.Data + curr.Offsets[2];
+        ImDrawIdx idx = 0;
+        for (int idx_n = 0; idx_n < idx_count; idx_n++)
+        {
+            ImDrawIdx delta;
+            memcpy(&delta, idx_deltas + idx_n * sizeof(ImDrawIdx), sizeof(ImDrawIdx));
+            idx = (ImDrawIdx)(idx + delta);
+            draw_list->IdxBuffer.Data[idx_n] = idx;
+        }
+        draw_list->CmdBuffer.resize(0);
+        RemoteReader cmd_reader(CurrFrame.Data + curr.Offsets[0], curr.Sizes[0]);
+        while (cmd_reader.P < cmd_reader.End)
+        {
+            ImDrawCmd cmd;
+            cmd.ClipRect.x = cmd_reader.ReadFloat();
+            cmd.ClipRect.y = cmd_reader.ReadFloat();
+            cmd.ClipRect.z = cmd_reader.ReadFloat();
+            cmd.ClipRect.w = cmd_reader.ReadFloat();
+            const int tex_n = cmd_reader.ReadU16();
+            cmd.VtxOffset = cmd_reader.ReadU32();
+            cmd.IdxOffset = cmd_reader.ReadU32();
+            cmd.ElemCount = cmd_reader.ReadU32();
+            if (tex_n == REMOTE_TEX_RESET_RENDER_STATE)
+            {
+                cmd.UserCallback = ImDrawCallback_ResetRenderState;
+                draw_list->CmdBuffer.push_back(cmd);
+                continue;
+            }
+            if (tex_n >= Textures.Size)
+                continue; // Texture unknown to the application, or not sent
+
+            // Renderers trust indices: check them
+            if ((ImU64)cmd.IdxOffset + cmd.ElemCount > (ImU64)idx_count)
+                return false;
+            for (unsigned int idx_n = cmd.IdxOffset; idx_n < cmd.IdxOffset + cmd.ElemCount; idx_n++)
+                if ((ImU64)cmd.VtxOffset + draw_list->IdxBuffer.Data[idx_n] >= (ImU64)vtx_count)
+                    return false;
+            cmd.TextureId = Textures[tex_n].TexID;
+            draw_list->CmdBuffer.push_back(cmd);
+        }
+    }
+    if (r.Error)
+        return false;
+    PrevFrame.swap(CurrFrame);
+    PrevLists.swap(CurrLists);
+    HasPrevFrame = true;
+
+    // Expose draw data. Lists after the last one used are kept for later frames.
+    DrawData.Clear();
+    DrawData.Valid = true;
+    DrawData.CmdListsCount = lists_count;
+    DrawData.CmdLists.resize(lists_count);
+    for (int list_n = 0; list_n < lists_count; list_n++)
+    {
+        ImDrawList* draw_list = DrawLists[list_n];
+        DrawData.CmdLists[list_n] = draw_list;
+        DrawData.TotalVtxCount += draw_list->VtxBuffer.Size;
+        DrawData.TotalIdxCount += draw_list->IdxBuffer.Size;
+    }
+    DrawData.DisplayPos = display_pos;
+    DrawData.DisplaySize = display_size;
+    DrawData.FramebufferScale = framebuffer_scale;
+
+    Stats.FrameCount++;
+    Stats.KeyFrameCount += key_frame ? 1 : 0;
+    Stats.FrameBytes = message_size;
+    Stats.FrameRawBytes = PrevFrame.Size;
+    Stats.FrameListsChanged = lists_changed;
+    Stats.FrameListsUnchanged = lists_count - lists_changed;
+    Stats.FrameTime = RemoteGetTime() - start_time;
+    Stats.TotalBytes += (ImU64)message_size;
+    Stats.TotalRawBytes += (ImU64)PrevFrame.Size;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// Sockets
+//-----------------------------------------------------------------------------
+
+static bool RemoteInitSockets()
+{
+#ifdef _WIN32
+    static bool initialized = false;
+    if (!initialized)
+    {
+        WSADATA wsa_data;
+        initialized = (WSAStartup(MAKEWORD(2, 2), &wsa_data) == 0);
+    }
+    return initialized;
+#else
+    return true;
+#endif
+}
+
+static void RemoteSetNonBlocking(RemoteSocket s)
+{
+#ifdef _WIN32
+    u_long non_blocking = 1;
+    ioctlsocket(s, FIONBIO, &non_blocking);
+#else
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL, 0) | O_NONBLOCK);
+#endif
+#ifdef SO_NOSIGPIPE
+    int one = 1;
+    setsockopt(s, SOL_SOCKET, SO_NOSIGPIPE, &one, sizeof(one));
+#endif
+}
+
+static void RemoteSetNoDelay(RemoteSocket s)
+{
+    int one = 1;
+    setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (const char*)&one, sizeof(one)); // Fails harmlessly on Unix domain sockets
+}
+
+// Create a socket bound ('listen' = true) or connected to 'address'
+static RemoteSocket RemoteOpenSocket(const char* address, bool listen)
+{
+    if (!RemoteInitSockets())
+        return REMOTE_INVALID_SOCKET;
+#ifndef _WIN32
+    if (strncmp(address, "unix:", 5) == 0)
+    {
+        sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        if (strlen(address + 5) >= sizeof(addr.sun_path))
+            return REMOTE_INVALID_SOCKET;
+        strcpy(addr.sun_path, address + 5);
+        RemoteSocket s = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (s == REMOTE_INVALID_SOCKET)
+            return s;
+        if (listen)
+            unlink(addr.sun_path); // Left by a previous run
+        if (listen ? (bind(s, (sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(s, 1) != 0) : (connect(s, (sockaddr*)&addr, sizeof(addr)) != 0))
+        {
+            REMOTE_CLOSE_SOCKET(s);
+            return REMOTE_INVALID_SOCKET;
+        }
+        return s;
+    }
+#endif
+
+    // "host:port"
+    char host[256];
+    const char* port = strrchr(address, ':');
+    if (port == NULL || port - address >= (int)sizeof(host))
+        return REMOTE_INVALID_SOCKET;
+    memcpy(host, address, (size_t)(port - address));
+    host[port - address] = 0;
+    port++;
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags = listen ? AI_PASSIVE : 0;
+    addrinfo* results = NULL;
+    if (getaddrinfo(host[0] ? host : NULL, port, &hints, &results) != 0)
+        return REMOTE_INVALID_SOCKET;
+    RemoteSocket s = REMOTE_INVALID_SOCKET;
+    for (addrinfo* ai = results; ai != NULL && s == REMOTE_INVALID_SOCKET; ai = ai->ai_next)
+    {
+        s = socket(ai->ai_family, ai->ai_socktype, ai->ai_protocol);
+        if (s == REMOTE_INVALID_SOCKET)
+            continue;
+        int one = 1;
+        if (listen)
+            setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (const char*)&one, sizeof(one));
+        if (listen ? (bind(s, ai->ai_addr, (int)ai->ai_addrlen) != 0 || ::listen(s, 1) != 0) : (connect(s, ai->ai_addr, (int)ai->ai_addrlen) != 0))
+        {
+            REMOTE_CLOSE_SOCKET(s);
+            s = REMOTE_INVALID_SOCKET;
+        }
+    }
+    freeaddrinfo(results);
+    if (s != REMOTE_INVALID_SOCKET && !listen)
+        RemoteSetNoDelay(s);
+    return s;
+}
+
+static void RemoteCloseSocket(ImS64* s)
+{
+    if (*s != -1)
+        REMOTE_CLOSE_SOCKET((RemoteSocket)*s);
+    *s = -1;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteServer
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteServer::ImGuiRemoteServer()
+{
+    FramesSent = FramesDropped = 0;
+    ListenSocket = ClientSocket = -1;
+    SendOffset = 0;
+}
+
+ImGuiRemoteServer::~ImGuiRemoteServer()
+{
+    Close();
+}
+
+bool ImGuiRemoteServer::Listen(const char* address)
+{
+    Close();
+    RemoteSocket s = RemoteOpenSocket(address, true);
+    if (s == REMOTE_INVALID_SOCKET)
+        return false;
+    RemoteSetNonBlocking(s);
+    ListenSocket = (ImS64)s;
+    return true;
+}
+
+// Also release memory, so that this can be called before uninstalling custom allocators
+void ImGuiRemoteServer::Close()
+{
+    RemoteCloseSocket(&ClientSocket);
+    RemoteCloseSocket(&ListenSocket);
+    Encoder.Clear();
+    SendBuffer.clear();
+    SendOffset = 0;
+}
+
+bool ImGuiRemoteServer::AcceptClient()
+{
+    if (ListenSocket == -1 || ClientSocket != -1)
+        return false;
+    RemoteSocket s = accept((RemoteSocket)ListenSocket, NULL, NULL);
+    if (s == REMOTE_INVALID_SOCKET)
+        return false;
+    RemoteSetNonBlocking(s);
+    RemoteSetNoDelay(s);
+    ClientSocket = (ImS64)s;
+    SendBuffer.resize(0);
+    SendOffset = 0;
+    Encoder.RequestKeyFrame();
+    return true;
+}
+
+bool ImGuiRemoteServer::SendFrame(ImDrawData* draw_data)
+{
+    AcceptClient();
+    if (ClientSocket == -1)
+        return true;
+
+    // Finish sending the previous message first: next message is delta-encoded against it.
+    // Then encode this frame in the same call, so the viewer doesn't stay one frame behind.
+    bool frame_encoded = false;
+    while (true)
+    {
+        if (SendOffset == SendBuffer.Size)
+        {
+            if (frame_encoded)
+                return true;
+            SendBuffer.resize(0);
+            SendOffset = 0;
+            Encoder.EncodeFrame(draw_data, &SendBuffer);
+            FramesSent++;
+            frame_encoded = true;
+        }
+        const int sent = (int)send((RemoteSocket)ClientSocket, (const char*)SendBuffer.Data + SendOffset, SendBuffer.Size - SendOffset, REMOTE_SEND_FLAGS);
+        if (sent > 0)
+            SendOffset += sent;
+        else if (sent < 0 && REMOTE_WOULD_BLOCK())
+        {
+            if (!frame_encoded)
+                FramesDropped++;
+            return false;
+        }
+        else
+        {
+            RemoteCloseSocket(&ClientSocket); // Viewer went away
+            return true;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteClient
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteClient::ImGuiRemoteClient()
+{
+    Socket = -1;
+}
+
+ImGuiRemoteClient::~ImGuiRemoteClient()
+{
+    Close();
+}
+
+bool ImGuiRemoteClient::Connect(const char* address)
+{
+    Close();
+    RemoteSocket s = RemoteOpenSocket(address, false);
+    if (s == REMOTE_INVALID_SOCKET)
+        return false;
+    RemoteSetNonBlocking(s);
+    Socket = (ImS64)s;
+    return true;
+}
+
+// Keep last decoded frame and textures, so that it can still be displayed
+void ImGuiRemoteClient::Close()
+{
+    RemoteCloseSocket(&Socket);
+    RecvBuffer.clear();
+}
+
+bool ImGuiRemoteClient::Poll()
+{
+    if (Socket == -1)
+        return false;
+    for (;;)
+    {
+        const int chunk_size = 64 * 1024;
+        const int offset = RecvBuffer.Size;
+        RecvBuffer.resize(offset + chunk_size);
+        const int received = (int)recv((RemoteSocket)Socket, (char*)RecvBuffer.Data + offset, chunk_size, 0);
+        RecvBuffer.resize(offset + (received > 0 ? received : 0));
+        if (received > 0)
+            continue;
+        if (received < 0 && REMOTE_WOULD_BLOCK())
+            break;
+        Close(); // Server went away
+        return false;
+    }
+
+    // Decode all complete messages, as each one depends on the previous one
+    bool decoded = false;
+    int consumed = 0;
+    for (;;)
+    {
+        const int message_size = ImGuiRemoteDecoder::GetMessageSize(RecvBuffer.Data + consumed, RecvBuffer.Size - consumed);
+        if (message_size == 0 || message_size > RecvBuffer.Size - consumed)
+            break;
+        if (message_size < 0 || !Decoder.DecodeFrame(RecvBuffer.Data + consumed, message_size))
+        {
+            Close();
+            return decoded;
+        }
+        consumed += message_size;
+        decoded = true;
+    }
+    if (consumed > 0)
+        RecvBuffer.erase(RecvBuffer.Data, RecvBuffer.Data + consumed);
+    return decoded;
+}
+
+//-----------------------------------------------------------------------------
+// ImGuiRemoteRecorder, ImGuiRemotePlayer
+//-----------------------------------------------------------------------------
+
+ImGuiRemoteRecorder::ImGuiRemoteRecorder()
+{
+    FramesRecorded = 0;
+    File = NULL;
+}
+
+ImGuiRemoteRecorder::~ImGuiRemoteRecorder()
+{
+    Close();
+}
+
+bool ImGuiRemoteRecorder::Open(const char* filename)
+{
+    Close();
+    File = (void*)fopen(filename, "wb");
+    return File != NULL;
+}
+
+// Also release memory, so that this can be called before uninstalling custom allocators
+void ImGuiRemoteRecorder::Close()
+{
+    if (File != NULL)
+        fclose((FILE*)File);
+    File = NULL;
+    FramesRecorded = 0;
+    Encoder.Clear();
+    Message.clear();
+}
+
+bool ImGuiRemoteRecorder::RecordFrame(ImDrawData* draw_data)
+{
+    if (File == NULL)
+        return false;
+    Message.resize(0);
+    Encoder.EncodeFrame(draw_data, &Message);
+    if (fwrite(Message.Data, 1, (size_t)Message.Size, (FILE*)File) != (size_t)Message.Size)
+    {
+        Close();
+        return false;
+    }
+    FramesRecorded++;
+    return true;
+}
+
+ImGuiRemotePlayer::ImGuiRemotePlayer()
+{
+    FrameIndex = 0;
+}
+
+bool ImGuiRemotePlayer::Load(const char* filename)
+{
+    Clear();
+    FILE* f = fopen(filename, "rb");
+    if (f == NULL)
+        return false;
+    const int chunk_size = 1024 * 1024;
+    for (;;)
+    {
+        const int offset = Data.Size;
+        Data.resize(offset + chunk_size);
+        const int read = (int)fread(Data.Data + offset, 1, (size_t)chunk_size, f);
+        Data.resize(offset + read);
+        if (read < chunk_size)
+            break;
+    }
+    fclose(f);
+
+    // Index messages. A truncated last message (e.g. application killed while recording) is ignored.
+    for (int offset = 0; offset < Data.Size; )
+    {
+        const int message_size = ImGuiRemoteDecoder::GetMessageSize(Data.Data + offset, Data.Size - offset);
+        if (message_size < 0)
+        {
+            Clear();
+            return false;
+        }
+        if (message_size == 0 || message_size > Data.Size - offset)
+            break;
+        FrameOffsets.push_back(offset);
+        offset += message_size;
+    }
+    return FrameOffsets.Size > 0;
+}
+
+void ImGuiRemotePlayer::Clear()
+{
+    Decoder.Clear();
+    Data.clear();
+    FrameOffsets.clear();
+    FrameIndex = 0;
+}
+
+bool ImGuiRemotePlayer::NextFrame()
+{
+    if (FrameIndex >= FrameOffsets.Size)
+    {
+        FrameIndex = 0;
+        return false;
+    }
+    const int offset = FrameOffsets[FrameIndex];
+    const int end = (FrameIndex + 1 < FrameOffsets.Size) ? FrameOffsets[FrameIndex + 1] : Data.Size;
+    FrameIndex++;
+    return Decoder.DecodeFrame(Data.Data + offset, end - offset);
+}
+
+#endif // #ifndef IMGUI_DISABLE
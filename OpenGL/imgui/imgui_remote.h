@@ -0,0 +1,196 @@
+// dear imgui: streaming of draw data to remote viewers
+// - ImGuiRemoteEncoder serializes ImDrawData (commands, vertices, indices, texture updates) into compact binary messages.
+//   Each draw list is delta-encoded against the same draw list of the previous message: unchanged lists cost 1 byte, changed ones
+//   only carry the bytes between their common prefix and suffix, XOR-ed with the previous bytes when the size didn't change.
+//   Messages are then compressed with a LZ4-style byte-oriented compressor.
+// - ImGuiRemoteDecoder rebuilds an ImDrawData from messages, to render with any renderer backend. Textures are created through callbacks.
+// - ImGuiRemoteServer/ImGuiRemoteClient carry messages over TCP, or Unix domain sockets on POSIX systems with "unix:/path" addresses.
+//   The server never blocks: when the viewer hasn't received the previous frame yet, the new frame is dropped.
+// - ImGuiRemoteRecorder/ImGuiRemotePlayer write messages to a file and play them back, e.g. to benchmark renderer backends with the exact
+//   same frames on every run. A recording is a sequence of messages starting with a key frame, which includes the font atlas.
+// - Both ends must be built with the same ImDrawVert layout and ImDrawIdx size.
+// - Glyph instances (ImGuiBackendFlags_RendererHasGlyphInstances) are converted to vertices before encoding, so viewers don't need the glyph table.
+// - User callbacks (ImDrawList::AddCallback()) can't be sent and are skipped, except ImDrawCallback_ResetRenderState.
+//   Commands using a texture not registered with SetTexture() are skipped too. The font atlas is registered automatically.
+
+// Usage (application):
+//   static ImGuiRemoteServer server;
+//   server.Listen("127.0.0.1:7070");
+//   [...]
+//   ImGui::Render();
+//   server.SendFrame(ImGui::GetDrawData());
+// Usage (viewer, with its own Dear ImGui context and renderer backend):
+//   static ImGuiRemoteClient client;
+//   client.Decoder.CreateTextureFunc = MyCreateTexture;
+//   client.Decoder.DestroyTextureFunc = MyDestroyTexture;
+//   client.Connect("127.0.0.1:7070");
+//   [...]
+//   client.Poll();
+//   if (client.Decoder.HasFrame())
+//       ImGui_ImplOpenGL3_RenderDrawData(client.Decoder.GetDrawData());
+// Usage (recording, then playback with textures created like for a viewer):
+//   recorder.Open("ui.imrec");
+//   [...]
+//   recorder.RecordFrame(ImGui::GetDrawData());
+//   [...]
+//   player.Load("ui.imrec");
+//   while (player.NextFrame())
+//       ImGui_ImplOpenGL3_RenderDrawData(player.Decoder.GetDrawData());
+
+#pragma once
+#include "imgui.h"      // IMGUI_API
+#ifndef IMGUI_DISABLE
+
+// Create a texture from RGBA32 pixels (ImU32 in IM_COL32() order), and destroy it
+typedef ImTextureID (*ImGuiRemoteCreateTextureFunc)(const ImU32* pixels, int width, int height, void* user_data);
+typedef void        (*ImGuiRemoteDestroyTextureFunc)(ImTextureID tex_id, void* user_data);
+
+struct ImGuiRemoteStats
+{
+    int             FrameCount;             // Messages encoded or decoded
+    int             KeyFrameCount;          // Messages not depending on previous one
+    int             FrameBytes;             // Size of last message
+    int             FrameRawBytes;          // Size of last frame's commands, vertices and indices, before delta encoding and compression
+    int             FrameListsChanged;
+    int             FrameListsUnchanged;
+    double          FrameTime;              // Time spent encoding or decoding last message, in seconds
+    ImU64           TotalBytes;
+    ImU64           TotalRawBytes;
+};
+
+// Per draw list: location of serialized streams (commands, vertices, delta-coded indices) in a frame buffer
+struct ImGuiRemoteListStreams
+{
+    int             Offsets[3];
+    int             Sizes[3];
+};
+
+struct ImGuiRemoteTexture
+{
+    ImTextureID     TexID;                  // Encoder: application texture. Decoder: texture created by CreateTextureFunc.
+    int             Width;
+    int             Height;
+    int             PixelsOffset;           // Encoder: offset in TexturePixels[]
+    bool            Dirty;                  // Encoder: to send with next message
+};
+
+struct ImGuiRemoteEncoder
+{
+    ImGuiRemoteStats Stats;
+
+    // [Internal]
+    ImVector<unsigned char> PrevFrame, CurrFrame;           // Serialized draw lists of previous and current frame
+    ImVector<ImGuiRemoteListStreams> PrevLists, CurrLists;
+    ImVector<unsigned char> Body;                           // Message before compression
+    ImVector<int>   HashTable;                              // Compressor state
+    ImVector<ImGuiRemoteTexture> Textures;                  // Index in this array identifies a texture in messages
+    ImVector<ImU32> TexturePixels;
+    ImTextureID     FontTexID;
+    bool            KeyFrameRequested;
+    ImDrawList*     ExpandedList;                           // Copy of a draw list with glyph instances converted to vertices, created on first use
+
+    IMGUI_API ImGuiRemoteEncoder();
+    IMGUI_API ~ImGuiRemoteEncoder();
+    IMGUI_API void  SetTexture(ImTextureID tex_id, const ImU32* pixels, int width, int height); // Register or update a texture, sent with next message
+    IMGUI_API void  RequestKeyFrame();                      // Next message won't depend on previous ones (e.g. for a new viewer)
+    IMGUI_API void  EncodeFrame(ImDrawData* draw_data, ImVector<unsigned char>* out_message); // Append message to 'out_message'
+    IMGUI_API void  Clear();
+};
+
+struct ImGuiRemoteDecoder
+{
+    ImGuiRemoteCreateTextureFunc  CreateTextureFunc;
+    ImGuiRemoteDestroyTextureFunc DestroyTextureFunc;
+    void*           UserData;
+    ImGuiRemoteStats Stats;
+
+    // [Internal]
+    ImDrawData      DrawData;
+    ImVector<ImDrawList*> DrawLists;                        // Reused across messages, so renderers can recognize unchanged lists
+    ImVector<unsigned char> PrevFrame, CurrFrame;
+    ImVector<ImGuiRemoteListStreams> PrevLists, CurrLists;
+    ImVector<unsigned char> Body;
+    ImVector<ImGuiRemoteTexture> Textures;
+    bool            HasPrevFrame;
+
+    IMGUI_API ImGuiRemoteDecoder();
+    IMGUI_API ~ImGuiRemoteDecoder();
+    IMGUI_API static int GetMessageSize(const void* data, int data_size);  // Size of message at 'data', 0 if more data is needed to tell, -1 if not a message
+    IMGUI_API bool  DecodeFrame(const void* message, int message_size);     // Return false on invalid message, or delta message without previous one
+    IMGUI_API bool  HasFrame() const { return DrawData.Valid; }
+    IMGUI_API ImDrawData* GetDrawData() { return &DrawData; }
+    IMGUI_API void  Clear();                                // Destroy draw lists and textures. Requires the Dear ImGui context used for decoding.
+};
+
+struct ImGuiRemoteServer
+{
+    ImGuiRemoteEncoder Encoder;
+    int             FramesSent;
+    int             FramesDropped;                          // Viewer didn't receive previous frame yet
+
+    // [Internal]
+    ImS64           ListenSocket;                           // -1 when none
+    ImS64           ClientSocket;
+    ImVector<unsigned char> SendBuffer;
+    int             SendOffset;
+
+    IMGUI_API ImGuiRemoteServer();
+    IMGUI_API ~ImGuiRemoteServer();
+    IMGUI_API bool  Listen(const char* address);            // "host:port", or "unix:/path" on POSIX systems
+    IMGUI_API void  Close();
+    IMGUI_API bool  IsListening() const { return ListenSocket != -1; }
+    IMGUI_API bool  IsClientConnected() const { return ClientSocket != -1; }
+    IMGUI_API bool  AcceptClient();                         // Return true when a new viewer connected. Called by SendFrame().
+    IMGUI_API bool  SendFrame(ImDrawData* draw_data);       // Return false when the frame was dropped or is still being sent, so the caller can render again later
+};
+
+struct ImGuiRemoteClient
+{
+    ImGuiRemoteDecoder Decoder;
+
+    // [Internal]
+    ImS64           Socket;                                 // -1 when none
+    ImVector<unsigned char> RecvBuffer;
+
+    IMGUI_API ImGuiRemoteClient();
+    IMGUI_API ~ImGuiRemoteClient();
+    IMGUI_API bool  Connect(const char* address);           // Blocking. "host:port", or "unix:/path" on POSIX systems.
+    IMGUI_API void  Close();
+    IMGUI_API bool  IsConnected() const { return Socket != -1; }
+    IMGUI_API bool  Poll();                                 // Receive and decode pending messages, without blocking. Return true when a new frame was decoded.
+};
+
+struct ImGuiRemoteRecorder
+{
+    ImGuiRemoteEncoder Encoder;
+    int             FramesRecorded;
+
+    // [Internal]
+    void*           File;                                   // FILE*, NULL when not recording
+    ImVector<unsigned char> Message;
+
+    IMGUI_API ImGuiRemoteRecorder();
+    IMGUI_API ~ImGuiRemoteRecorder();
+    IMGUI_API bool  Open(const char* filename);             // Create or overwrite file. First recorded frame is a key frame.
+    IMGUI_API void  Close();
+    IMGUI_API bool  IsRecording() const { return File != NULL; }
+    IMGUI_API bool  RecordFrame(ImDrawData* draw_data);     // Return false on write error, which closes the file
+};
+
+struct ImGuiRemotePlayer
+{
+    ImGuiRemoteDecoder Decoder;
+    int             FrameIndex;                             // Next frame to decode
+
+    // [Internal]
+    ImVector<unsigned char> Data;                           // Whole recording, so playback doesn't measure file reads
+    ImVector<int>   FrameOffsets;
+
+    IMGUI_API ImGuiRemotePlayer();
+    IMGUI_API bool  Load(const char* filename);             // Return false if the file can't be read or isn't a recording
+    IMGUI_API void  Clear();                                // Also destroy decoded draw lists and textures, see ImGuiRemoteDecoder::Clear()
+    IMGUI_API int   GetFrameCount() const { return FrameOffsets.Size; }
+    IMGUI_API bool  NextFrame();                            // Decode frame FrameIndex, then advance. Return false after the last frame (next call restarts from first frame), or on invalid data (Decoder.HasFrame() then returns false).
+};
+
+#endif // #ifndef IMGUI_DISABLE
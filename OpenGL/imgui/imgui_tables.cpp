@@ -14,6 +14,7 @@ Index of this file:
 // [SECTION] Tables: Columns width management
 // [SECTION] Tables: Drawing
 // [SECTION] Tables: Sorting
+// [SECTION] Tables: Sort cache (ImGuiTableSortCache)
 // [SECTION] Tables: Headers
 // [SECTION] Tables: Context Menu
 // [SECTION] Tables: Settings (.ini data)
@@ -266,6 +267,7 @@ static const int TABLE_DRAW_CHANNEL_NOCLIP = 2;                     // When usin
 static const float TABLE_BORDER_SIZE                     = 1.0f;    // FIXME-TABLE: Currently hard-coded because of clipping assumptions with outer borders rendering.
 static const float TABLE_RESIZE_SEPARATOR_HALF_THICKNESS = 4.0f;    // Extend outside inner borders.
 static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/timer before making the hover feedback (color+cursor) visible because tables/columns tends to be more cramped.
+IM_STATIC_ASSERT(IMGUI_TABLE_MAX_COLUMNS <= 32767); // ImGuiTableColumnIdx is ImS16
 
 // Helper
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
@@ -301,6 +303,18 @@ inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_w
     return flags;
 }
 
+// Iterate frozen columns then unfrozen columns requesting output, in display order, skipping the rest of a wide table.
+// Pass -1 to get the first one. Returns -1 when done.
+static inline int TableNextVisibleColumnOrder(const ImGuiTable* table, int order_n)
+{
+    order_n++;
+    if (order_n < table->FreezeColumnsOrderEnd)
+        return order_n;
+    if (table->VisibleUnfrozenOrderMin == -1 || order_n > table->VisibleUnfrozenOrderMax)
+        return -1;
+    return ImMax(order_n, (int)table->VisibleUnfrozenOrderMin);
+}
+
 ImGuiTable* ImGui::TableFindByID(ImGuiID id)
 {
     ImGuiContext& g = *GImGui;
@@ -554,6 +568,7 @@ bool    ImGui::BeginTableEx(const char* name, ImGuiID id, int columns_count, ImG
         g.TablesLastTimeActive.resize(table_idx + 1, -1.0f);
     g.TablesLastTimeActive[table_idx] = (float)g.Time;
     temp_data->LastTimeActive = (float)g.Time;
+    temp_data->LastFrameActive = g.FrameCount;
     table->MemoryCompacted = false;
 
     // Setup memory buffer (clear data if columns count changed)
@@ -1053,6 +1068,10 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
     ImRect host_clip_rect = table->InnerClipRect;
     //host_clip_rect.Max.x += table->CellPaddingX + table->CellSpacingX2;
     ImBitArrayClearAllBits(table->VisibleMaskByIndex, table->ColumnsCount);
+    table->ColumnsVisibleCount = 0;
+    table->VisibleUnfrozenOrderMin = table->VisibleUnfrozenOrderMax = -1;
+    table->FreezeColumnsOrderEnd = (table->FreezeColumnsCount > 0) ? table->ColumnsCount : 0;
+    table->ColumnsMaxXByOrder.resize(table->ColumnsCount);
     for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
     {
         const int column_n = table->DisplayOrderToIndex[order_n];
@@ -1065,6 +1084,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         {
             offset_x += work_rect.Min.x - table->OuterRect.Min.x;
             offset_x_frozen = false;
+            table->FreezeColumnsOrderEnd = (ImGuiTableColumnIdx)order_n;
         }
 
         // Clear status flags
@@ -1082,6 +1102,7 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             column->IsVisibleX = column->IsVisibleY = column->IsRequestOutput = false;
             column->IsSkipItems = true;
             column->ItemWidth = 1.0f;
+            table->ColumnsMaxXByOrder[order_n] = offset_x;
             continue;
         }
 
@@ -1120,10 +1141,19 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         column->IsVisibleY = true; // (column->ClipRect.Max.y > column->ClipRect.Min.y);
         const bool is_visible = column->IsVisibleX; //&& column->IsVisibleY;
         if (is_visible)
+        {
             ImBitArraySetBit(table->VisibleMaskByIndex, column_n);
+            table->ColumnsVisibleCount++;
+        }
 
         // Mark column as requesting output from user. Note that fixed + non-resizable sets are auto-fitting at all times and therefore always request output.
         column->IsRequestOutput = is_visible || column->AutoFitQueue != 0 || column->CannotSkipItemsQueue != 0;
+        if ((column->IsRequestOutput || table->LastResizedColumn == column_n) && order_n >= table->FreezeColumnsOrderEnd) // Also keep resizing a column scrolled out of view
+        {
+            if (table->VisibleUnfrozenOrderMin == -1)
+                table->VisibleUnfrozenOrderMin = (ImGuiTableColumnIdx)order_n;
+            table->VisibleUnfrozenOrderMax = (ImGuiTableColumnIdx)order_n;
+        }
 
         // Mark column as SkipItems (ignoring all items/layout)
         // (table->HostSkipItems is a copy of inner_window->SkipItems before we cleared it above in Part 2)
@@ -1140,13 +1170,6 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
         if (column->SortOrder != -1)
             column->Flags |= ImGuiTableColumnFlags_IsSorted;
 
-        // Detect hovered column
-        if (is_hovering_table && mouse_skewed_x >= column->ClipRect.Min.x && mouse_skewed_x < column->ClipRect.Max.x)
-        {
-            column->Flags |= ImGuiTableColumnFlags_IsHovered;
-            table->HoveredColumnBody = (ImGuiTableColumnIdx)column_n;
-        }
-
         // Alignment
         // FIXME-TABLE: This align based on the whole column width, not per-cell, and therefore isn't useful in
         // many cases (to be able to honor this we might be able to store a log of cells width, per row, for
@@ -1185,15 +1208,35 @@ void ImGui::TableUpdateLayout(ImGuiTable* table)
             host_clip_rect.Min.x = ImClamp(column->MaxX + TABLE_BORDER_SIZE, host_clip_rect.Min.x, host_clip_rect.Max.x);
 
         offset_x += column->WidthGiven + table->CellSpacingX1 + table->CellSpacingX2 + table->CellPaddingX * 2.0f;
+        table->ColumnsMaxXByOrder[order_n] = offset_x;
         visible_n++;
     }
 
+    // Detect hovered column
+    if (is_hovering_table)
+    {
+        const int order_n = TableFindColumnOrderAtX(table, mouse_skewed_x);
+        const int column_n = (order_n != -1) ? table->DisplayOrderToIndex[order_n] : -1;
+        ImGuiTableColumn* column = (column_n != -1) ? &table->Columns[column_n] : NULL;
+        if (column && mouse_skewed_x >= column->ClipRect.Min.x && mouse_skewed_x < column->ClipRect.Max.x)
+        {
+            column->Flags |= ImGuiTableColumnFlags_IsHovered;
+            table->HoveredColumnBody = (ImGuiTableColumnIdx)column_n;
+        }
+    }
+
     // In case the table is visible (e.g. decorations) but all columns clipped, we keep a column visible.
     // Else if give no chance to a clipper-savy user to submit rows and therefore total contents height used by scrollbar.
     if (has_at_least_one_column_requesting_output == false)
     {
-        table->Columns[table->LeftMostEnabledColumn].IsRequestOutput = true;
-        table->Columns[table->LeftMostEnabledColumn].IsSkipItems = false;
+        ImGuiTableColumn* column = &table->Columns[table->LeftMostEnabledColumn];
+        column->IsRequestOutput = true;
+        column->IsSkipItems = false;
+        if (column->DisplayOrder >= table->FreezeColumnsOrderEnd)
+        {
+            table->VisibleUnfrozenOrderMin = (table->VisibleUnfrozenOrderMin == -1) ? column->DisplayOrder : ImMin(table->VisibleUnfrozenOrderMin, column->DisplayOrder);
+            table->VisibleUnfrozenOrderMax = ImMax(table->VisibleUnfrozenOrderMax, column->DisplayOrder);
+        }
     }
 
     // [Part 7] Detect/store when we are hovering the unused space after the right-most column (so e.g. context menus can react on it)
@@ -1296,7 +1339,7 @@ void ImGui::TableUpdateBorders(ImGuiTable* table)
     const float hit_y2_body = ImMax(table->OuterRect.Max.y, hit_y1 + table_instance->LastOuterHeight - table->AngledHeadersHeight);
     const float hit_y2_head = hit_y1 + table_instance->LastTopHeadersRowHeight;
 
-    for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+    for (int order_n = TableNextVisibleColumnOrder(table, -1); order_n != -1; order_n = TableNextVisibleColumnOrder(table, order_n))
     {
         if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
             continue;
@@ -1423,6 +1466,7 @@ void    ImGui::EndTable()
         ImDrawChannel* dummy_channel = &table->DrawSplitter._Channels[table->DummyDrawChannel];
         dummy_channel->_CmdBuffer.resize(0);
         dummy_channel->_IdxBuffer.resize(0);
+        dummy_channel->_GlyphBuffer.resize(0);
     }
 #endif
 
@@ -1696,6 +1740,8 @@ void ImGui::TableSetupScrollFreeze(int columns, int rows)
 // - TableSetColumnEnabled()
 // - TableGetColumnFlags()
 // - TableGetCellBgRect() [Internal]
+// - TableGetVisibleColumnsRange() [Internal]
+// - TableFindColumnOrderAtX() [Internal]
 // - TableGetColumnResizeID() [Internal]
 // - TableGetHoveredColumn() [Internal]
 // - TableGetHoveredRow() [Internal]
@@ -1787,6 +1833,42 @@ ImRect ImGui::TableGetCellBgRect(const ImGuiTable* table, int column_n)
     return ImRect(x1, table->RowPosY1, x2, table->RowPosY2);
 }
 
+// Return the range of unfrozen columns requesting output, in display order, so a caller submitting a very wide table
+// can skip calling TableSetColumnIndex() on the columns that are horizontally clipped.
+// Frozen columns (see TableSetupScrollFreeze()) are at display order 0..table->FreezeColumnsOrderEnd-1 and are not included.
+// The range covers visible columns plus clipped ones that still need their contents (e.g. auto-fitting for a few frames)
+// or are being resized.
+// Use table->DisplayOrderToIndex[] to convert to column indices. Returns false when no unfrozen column requests output.
+bool ImGui::TableGetVisibleColumnsRange(const ImGuiTable* table, int* out_order_min, int* out_order_max)
+{
+    IM_ASSERT(table->IsLayoutLocked && "Need to call after BeginTable() and TableSetupColumn()/TableHeadersRow() or first row.");
+    *out_order_min = table->VisibleUnfrozenOrderMin;
+    *out_order_max = table->VisibleUnfrozenOrderMax;
+    return table->VisibleUnfrozenOrderMin != -1;
+}
+
+// Return display order of the enabled column at screen position x, or -1. Binary search in ColumnsMaxXByOrder[].
+// This doesn't check clipping: a frozen column covers the unfrozen ones scrolled under it.
+int ImGui::TableFindColumnOrderAtX(const ImGuiTable* table, float x)
+{
+    const int freeze_end = table->FreezeColumnsOrderEnd;
+    const bool in_frozen = (freeze_end > 0 && x < table->ColumnsMaxXByOrder[freeze_end - 1]);
+    const float* first = table->ColumnsMaxXByOrder.Data + (in_frozen ? 0 : freeze_end);
+    const float* last = table->ColumnsMaxXByOrder.Data + (in_frozen ? freeze_end : table->ColumnsCount);
+    while (first < last) // Find first column ending after x. Hidden columns have zero width so are never returned.
+    {
+        const float* mid = first + (last - first) / 2;
+        if (*mid <= x)
+            first = mid + 1;
+        else
+            last = mid;
+    }
+    const int order_n = (int)(first - table->ColumnsMaxXByOrder.Data);
+    if (order_n == (in_frozen ? freeze_end : table->ColumnsCount))
+        return -1;
+    return (x >= table->Columns[table->DisplayOrderToIndex[order_n]].MinX) ? order_n : -1;
+}
+
 // Return the resizing ID for the right-side of the given column.
 ImGuiID ImGui::TableGetColumnResizeID(ImGuiTable* table, int column_n, int instance_no)
 {
@@ -2486,13 +2568,15 @@ void ImGui::TablePopBackgroundChannel()
 // - Clip                         --> 2+D+N channels
 // - FreezeRows                   --> 2+D+N*2 (unless scrolling value is zero)
 // - FreezeRows || FreezeColunns  --> 3+D+N*2 (unless scrolling value is zero)
-// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0.
+// Where D is 1 if any column is clipped or hidden (dummy channel) otherwise 0,
+// and N is the number of visible columns: clipped columns all share the dummy channel, so a very wide
+// scrolling table only pays for the columns in view.
 void ImGui::TableSetupDrawChannels(ImGuiTable* table)
 {
     const int freeze_row_multiplier = (table->FreezeRowsCount > 0) ? 2 : 1;
-    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsEnabledCount;
+    const int channels_for_row = (table->Flags & ImGuiTableFlags_NoClip) ? 1 : table->ColumnsVisibleCount;
     const int channels_for_bg = 1 + 1 * freeze_row_multiplier;
-    const int channels_for_dummy = (table->ColumnsEnabledCount < table->ColumnsCount || (memcmp(table->VisibleMaskByIndex, table->EnabledMaskByIndex, ImBitArrayGetStorageSizeInBytes(table->ColumnsCount)) != 0)) ? +1 : 0;
+    const int channels_for_dummy = (table->ColumnsVisibleCount < table->ColumnsCount) ? +1 : 0; // Visible columns are a subset of enabled columns
     const int channels_total = channels_for_bg + (channels_for_row * freeze_row_multiplier) + channels_for_dummy;
     table->DrawSplitter->Split(table->InnerWindow->DrawList, channels_total);
     table->DummyDrawChannel = (ImGuiTableDrawChannelIdx)((channels_for_dummy > 0) ? channels_total - 1 : -1);
@@ -2574,7 +2658,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     MergeGroup merge_groups[4];
 
     // Use a reusable temp buffer for the merge masks as they are dynamically sized.
-    const int max_draw_channels = (4 + table->ColumnsCount * 2);
+    const int max_draw_channels = splitter->_Count;
     const int size_for_masks_bitarrays_one = (int)ImBitArrayGetStorageSizeInBytes(max_draw_channels);
     g.TempBuffer.reserve(size_for_masks_bitarrays_one * 5);
     memset(g.TempBuffer.Data, 0, size_for_masks_bitarrays_one * 5);
@@ -2583,8 +2667,9 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
     ImBitArrayPtr remaining_mask = (ImBitArrayPtr)(void*)(g.TempBuffer.Data + (size_for_masks_bitarrays_one * 4));
 
     // 1. Scan channels and take note of those which can be merged
-    for (int column_n = 0; column_n < table->ColumnsCount; column_n++)
+    for (int order_n = TableNextVisibleColumnOrder(table, -1); order_n != -1; order_n = TableNextVisibleColumnOrder(table, order_n))
     {
+        const int column_n = table->DisplayOrderToIndex[order_n];
         if (!IM_BITARRAY_TESTBIT(table->VisibleMaskByIndex, column_n))
             continue;
         ImGuiTableColumn* column = &table->Columns[column_n];
@@ -2596,7 +2681,7 @@ void ImGui::TableMergeDrawChannels(ImGuiTable* table)
 
             // Don't attempt to merge if there are multiple draw calls within the column
             ImDrawChannel* src_channel = &splitter->_Channels[channel_no];
-            if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
+            if (src_channel->_CmdBuffer.Size > 0 && src_channel->_CmdBuffer.back().ElemCount == 0 && src_channel->_CmdBuffer.back().GlyphCount == 0 && src_channel->_CmdBuffer.back().UserCallback == NULL) // Equivalent of PopUnusedDrawCmd()
                 src_channel->_CmdBuffer.pop_back();
             if (src_channel->_CmdBuffer.Size != 1)
                 continue;
@@ -2756,7 +2841,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
     const float draw_y2_head = table->IsUsingHeaders ? ImMin(table->InnerRect.Max.y, (table->FreezeRowsCount >= 1 ? table->InnerRect.Min.y : table->WorkRect.Min.y) + table_instance->LastTopHeadersRowHeight) : draw_y1;
     if (table->Flags & ImGuiTableFlags_BordersInnerV)
     {
-        for (int order_n = 0; order_n < table->ColumnsCount; order_n++)
+        for (int order_n = TableNextVisibleColumnOrder(table, -1); order_n != -1; order_n = TableNextVisibleColumnOrder(table, order_n))
         {
             if (!IM_BITARRAY_TESTBIT(table->EnabledMaskByDisplayOrder, order_n))
                 continue;
@@ -3019,6 +3104,346 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
     table->SortSpecs.SpecsCount = table->SortSpecsCount;
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Tables: Sort cache (ImGuiTableSortCache)
+//-------------------------------------------------------------------------
+// - ImGuiTableSortCache::Update()
+// - TableSortCacheCompare() [Internal]
+// - TableSortCacheSortRange() [Internal]
+// - TableSortCacheMergeRunsCoRank() [Internal]
+// - TableSortCacheMergeRuns() [Internal]
+// - TableSortCacheAddSortSteps() [Internal]
+// - TableSortCacheRunSteps() [Internal]
+//-------------------------------------------------------------------------
+// The compare function may be called from multiple threads at the same time when ParallelForFunc is set.
+// A sort is planned as a list of steps (jobs) which are independent within a pass:
+// - Pass 1: each step sorts a chunk of 'ItemsPerJob' items (insertion sort of small runs + bottom-up merge).
+// - Next passes: sorted chunks are merged pairwise until a single run remains. Each merge is split into steps producing
+//   'ItemsPerJob' items of the output each, so that the last merges can also run in parallel.
+// Passes are dispatched to ParallelForFunc one after the other. With ItemsPerUpdate > 0, steps are instead run one
+// at a time on the calling thread, until the budget of the current Update() call is spent.
+//-------------------------------------------------------------------------
+
+enum ImGuiTableSortCacheStepKind
+{
+    ImGuiTableSortCacheStepKind_SortRange,      // Sort Data[Offset..End) using Temp[] as scratch
+    ImGuiTableSortCacheStepKind_MergeRuns,      // Merge [Offset..Mid) and [Mid..End) from one buffer into the other, only writing output items [PieceBegin..PieceEnd)
+    ImGuiTableSortCacheStepKind_Copy,           // Copy [Offset+PieceBegin..Offset+PieceEnd) from one buffer into the other
+};
+
+struct ImGuiTableSortCacheJob
+{
+    const ImGuiTableColumnSortSpecs*    Specs;
+    int                                 SpecsCount;
+    ImGuiTableSortCompareFunc           CompareFunc;
+    void*                               UserData;
+    int*                                Data;
+    int*                                Temp;
+    const ImGuiTableSortCache::Step*    Steps;          // Steps of the pass being dispatched
+};
+
+static inline int TableSortCacheCompare(const ImGuiTableSortCacheJob* job, int item_a, int item_b)
+{
+    for (int n = 0; n < job->SpecsCount; n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &job->Specs[n];
+        int delta = job->CompareFunc(spec, item_a, item_b, job->UserData);
+        if (delta != 0)
+            return ((delta > 0) == (spec->SortDirection == ImGuiSortDirection_Descending)) ? -1 : +1; // Don't negate: comparators may return INT_MIN
+    }
+    return 0;
+}
+
+// Number of items of src[0..mid) among the first 'out_n' items output by a stable merge of src[0..mid) and src[mid..end) (merge path)
+static int TableSortCacheMergeRunsCoRank(const ImGuiTableSortCacheJob* job, const int* src, int mid, int end, int out_n)
+{
+    int lo = ImMax(0, out_n - (end - mid));
+    int hi = ImMin(out_n, mid);
+    while (lo < hi)
+    {
+        const int i = (lo + hi) / 2;
+        if (TableSortCacheCompare(job, src[mid + out_n - i - 1], src[i]) < 0)
+            hi = i;
+        else
+            lo = i + 1;
+    }
+    return lo;
+}
+
+// Stable merge of src[0..mid) and src[mid..end) into dst[0..end), only writing dst[out_begin..out_end)
+static void TableSortCacheMergeRuns(const ImGuiTableSortCacheJob* job, const int* src, int mid, int end, int* dst, int out_begin, int out_end)
+{
+    if (mid < end && mid > 0 && TableSortCacheCompare(job, src[mid - 1], src[mid]) <= 0)
+    {
+        memcpy(dst + out_begin, src + out_begin, (size_t)(out_end - out_begin) * sizeof(int)); // Already in order (common when appending sorted data)
+        return;
+    }
+    int i = TableSortCacheMergeRunsCoRank(job, src, mid, end, out_begin);
+    int j = mid + out_begin - i;
+    const int i_end = TableSortCacheMergeRunsCoRank(job, src, mid, end, out_end);
+    const int j_end = mid + out_end - i_end;
+    int out_n = out_begin;
+    while (i < i_end && j < j_end)
+        dst[out_n++] = (TableSortCacheCompare(job, src[j], src[i]) < 0) ? src[j++] : src[i++];
+    while (i < i_end)
+        dst[out_n++] = src[i++];
+    while (j < j_end)
+        dst[out_n++] = src[j++];
+}
+
+// Stable sort of data[0..count), using temp[0..count) as scratch
+static void TableSortCacheSortRange(const ImGuiTableSortCacheJob* job, int* data, int* temp, int count)
+{
+    const int INSERTION_RUN = 32;
+    for (int run_start = 0; run_start < count; run_start += INSERTION_RUN)
+    {
+        const int run_end = ImMin(run_start + INSERTION_RUN, count);
+        for (int n = run_start + 1; n < run_end; n++)
+        {
+            const int item = data[n];
+            int m = n;
+            for (; m > run_start && TableSortCacheCompare(job, item, data[m - 1]) < 0; m--)
+                data[m] = data[m - 1];
+            data[m] = item;
+        }
+    }
+    int* src = data;
+    int* dst = temp;
+    for (int width = INSERTION_RUN; width < count; width *= 2)
+    {
+        for (int run_start = 0; run_start < count; run_start += width * 2)
+        {
+            const int mid = ImMin(run_start + width, count);
+            const int end = ImMin(run_start + width * 2, count);
+            TableSortCacheMergeRuns(job, src + run_start, mid - run_start, end - run_start, dst + run_start, 0, end - run_start);
+        }
+        ImSwap(src, dst);
+    }
+    if (src != data)
+        memcpy(data, src, (size_t)count * sizeof(int));
+}
+
+// Add steps for [offset..end), split in pieces of 'piece_size' items for merge and copy steps
+static void TableSortCacheAddStep(ImVector<ImGuiTableSortCache::Step>* steps, ImGuiTableSortCacheStepKind kind, int offset, int mid, int end, int specs_count, int pass, bool src_is_temp, int piece_size)
+{
+    for (int piece_begin = 0; piece_begin < end - offset; piece_begin += piece_size)
+    {
+        ImGuiTableSortCache::Step step;
+        step.Kind = kind;
+        step.Offset = offset;
+        step.Mid = mid;
+        step.End = end;
+        step.PieceBegin = piece_begin;
+        step.PieceEnd = ImMin(piece_begin + piece_size, end - offset);
+        step.SpecsCount = specs_count;
+        step.Pass = pass;
+        step.SrcIsTemp = src_is_temp;
+        steps->push_back(step);
+    }
+}
+
+// Plan a stable sort of Data[offset..offset+count) on the first 'specs_count' specs. Result ends up in Data[].
+static void TableSortCacheAddSortSteps(ImGuiTableSortCache* cache, int offset, int count, int specs_count)
+{
+    if (count <= 1 || specs_count == 0)
+        return;
+    ImVector<ImGuiTableSortCache::Step>* steps = &cache->_Steps;
+    int pass = steps->Size > 0 ? steps->back().Pass + 1 : 0;
+    const int chunk_size = ImMax(cache->ItemsPerJob, 1024);
+    for (int chunk_start = 0; chunk_start < count; chunk_start += chunk_size)
+        TableSortCacheAddStep(steps, ImGuiTableSortCacheStepKind_SortRange, offset + chunk_start, 0, offset + ImMin(chunk_start + chunk_size, count), specs_count, pass, false, chunk_size);
+    bool src_is_temp = false;
+    for (int width = chunk_size; width < count; width *= 2)
+    {
+        pass++;
+        for (int run_start = 0; run_start < count; run_start += width * 2)
+            TableSortCacheAddStep(steps, ImGuiTableSortCacheStepKind_MergeRuns, offset + run_start, offset + ImMin(run_start + width, count), offset + ImMin(run_start + width * 2, count), specs_count, pass, src_is_temp, chunk_size);
+        src_is_temp = !src_is_temp;
+    }
+    if (src_is_temp)
+        TableSortCacheAddStep(steps, ImGuiTableSortCacheStepKind_Copy, offset, 0, offset + count, 0, pass + 1, true, chunk_size);
+}
+
+static void TableSortCacheRunStep(const ImGuiTableSortCacheJob* job_base, const ImGuiTableSortCache::Step* step)
+{
+    ImGuiTableSortCacheJob job = *job_base;
+    job.SpecsCount = step->SpecsCount;
+    int* src = step->SrcIsTemp ? job.Temp : job.Data;
+    int* dst = step->SrcIsTemp ? job.Data : job.Temp;
+    switch (step->Kind)
+    {
+    case ImGuiTableSortCacheStepKind_SortRange: TableSortCacheSortRange(&job, job.Data + step->Offset, job.Temp + step->Offset, step->End - step->Offset); break;
+    case ImGuiTableSortCacheStepKind_MergeRuns: TableSortCacheMergeRuns(&job, src + step->Offset, step->Mid - step->Offset, step->End - step->Offset, dst + step->Offset, step->PieceBegin, step->PieceEnd); break;
+    case ImGuiTableSortCacheStepKind_Copy:      memcpy(dst + step->Offset + step->PieceBegin, src + step->Offset + step->PieceBegin, (size_t)(step->PieceEnd - step->PieceBegin) * sizeof(int)); break;
+    }
+}
+
+static void TableSortCacheStepJob(void* job_data, int job_n)
+{
+    const ImGuiTableSortCacheJob* job = (const ImGuiTableSortCacheJob*)job_data;
+    TableSortCacheRunStep(job, &job->Steps[job_n]);
+}
+
+// Run pending steps, return true when all steps are done
+static bool TableSortCacheRunSteps(ImGuiTableSortCache* cache, ImGuiTableSortCacheJob* job)
+{
+    ImVector<ImGuiTableSortCache::Step>& steps = cache->_Steps;
+    if (cache->ItemsPerUpdate > 0)
+    {
+        // Incremental: run steps on the calling thread until the budget is spent (at least one step per call)
+        for (int budget = cache->ItemsPerUpdate; cache->_StepsDone < steps.Size && budget > 0; cache->_StepsDone++)
+        {
+            const ImGuiTableSortCache::Step* step = &steps[cache->_StepsDone];
+            TableSortCacheRunStep(job, step);
+            budget -= step->PieceEnd - step->PieceBegin;
+        }
+    }
+    else
+    {
+        // Dispatch one pass at a time
+        while (cache->_StepsDone < steps.Size)
+        {
+            const int pass_start = cache->_StepsDone;
+            int pass_end = pass_start + 1;
+            while (pass_end < steps.Size && steps[pass_end].Pass == steps[pass_start].Pass)
+                pass_end++;
+            job->Steps = &steps[pass_start];
+            if (cache->ParallelForFunc != NULL && pass_end - pass_start > 1)
+                cache->ParallelForFunc(TableSortCacheStepJob, job, pass_end - pass_start, cache->ParallelForUserData);
+            else
+                for (int job_n = 0; job_n < pass_end - pass_start; job_n++)
+                    TableSortCacheStepJob(job, job_n);
+            cache->_StepsDone = pass_end;
+        }
+    }
+    return cache->_StepsDone == steps.Size;
+}
+
+static bool TableSortCacheSpecsEqual(const ImGuiTableColumnSortSpecs* a, const ImGuiTableColumnSortSpecs* b)
+{
+    return a->ColumnIndex == b->ColumnIndex && a->ColumnUserID == b->ColumnUserID && a->SortDirection == b->SortDirection;
+}
+
+ImGuiTableSortCache::ImGuiTableSortCache()
+{
+    ParallelForFunc = NULL;
+    ParallelForUserData = NULL;
+    ItemsPerJob = 64 * 1024;
+    ItemsPerUpdate = 0;
+    SortCount = 0;
+    _SortedCount = 0;
+    _StepsDone = 0;
+    _Sorting = false;
+    _Dirty = false;
+}
+
+void ImGuiTableSortCache::Clear()
+{
+    Indices.clear();
+    SortedBy.clear();
+    _Pending.clear();
+    _PendingSpecs.clear();
+    _Temp.clear();
+    _Steps.clear();
+    _SortedCount = _StepsDone = 0;
+    _Sorting = _Dirty = false;
+}
+
+bool ImGuiTableSortCache::Update(ImGuiTableSortSpecs* sort_specs, int items_count, ImGuiTableSortCompareFunc compare_func, void* user_data)
+{
+    IM_ASSERT(sort_specs != NULL && compare_func != NULL && items_count >= 0);
+    const bool specs_dirty = sort_specs->SpecsDirty || _Dirty;
+    if (!specs_dirty && items_count == Indices.Size && !_Sorting)
+        return false;
+
+    bool indices_changed = false;
+    if (specs_dirty || items_count != Indices.Size)
+    {
+        // Start a new sort (abandoning the one in progress, if any)
+        sort_specs->SpecsDirty = false;
+        const int specs_count = sort_specs->SpecsCount;
+
+        // Removed items invalidate the permutation.
+        // Indices[0.._SortedCount) is a permutation sorted by SortedBy[], other items are listed in index order after it.
+        if (items_count < Indices.Size || (specs_count == 0 && SortedBy.Size > 0))
+        {
+            SortedBy.resize(0);
+            _SortedCount = 0;
+            _Dirty = true;
+            indices_changed = true;
+        }
+        const int prev_count = _SortedCount;
+        indices_changed |= (items_count != Indices.Size);
+        Indices.resize(items_count);
+        for (int n = prev_count; n < items_count; n++)
+            Indices.Data[n] = n;
+
+        // Re-sort existing items, only sorting on the leading specs that are not already satisfied by the previous ordering.
+        // If new specs are [A,B,C] and we were previously sorted by [B,C,...], a stable sort on [A] is sufficient.
+        int leading_count = specs_count;
+        if (!_Dirty)
+            for (int n = 0; n < specs_count; n++)
+            {
+                const int suffix_count = specs_count - n;
+                bool match = (suffix_count <= SortedBy.Size);
+                for (int m = 0; match && m < suffix_count; m++)
+                    match = TableSortCacheSpecsEqual(&sort_specs->Specs[n + m], &SortedBy[m]);
+                if (match)
+                {
+                    leading_count = n;
+                    break;
+                }
+            }
+        _Steps.resize(0);
+        _StepsDone = 0;
+        TableSortCacheAddSortSteps(this, 0, prev_count, leading_count);
+
+        // Sort appended items then merge them in
+        TableSortCacheAddSortSteps(this, prev_count, items_count - prev_count, specs_count);
+        if (prev_count > 0 && items_count > prev_count && specs_count > 0)
+        {
+            const int pass = _Steps.Size > 0 ? _Steps.back().Pass + 1 : 0;
+            const int piece_size = ImMax(ItemsPerJob, 1024);
+            TableSortCacheAddStep(&_Steps, ImGuiTableSortCacheStepKind_MergeRuns, 0, prev_count, items_count, specs_count, pass, false, piece_size);
+            TableSortCacheAddStep(&_Steps, ImGuiTableSortCacheStepKind_Copy, 0, 0, items_count, 0, pass + 1, true, piece_size);
+        }
+
+        _PendingSpecs.resize(specs_count);
+        if (specs_count > 0)
+            memcpy(_PendingSpecs.Data, sort_specs->Specs, (size_t)specs_count * sizeof(ImGuiTableColumnSortSpecs));
+        if (ItemsPerUpdate > 0)
+            _Pending = Indices; // Keep displaying Indices[] while sorting
+        _Temp.resize(items_count);
+        _Sorting = true;
+        _Dirty = false;
+    }
+
+    // Run the sort (all of it, or the budget of this call when ItemsPerUpdate > 0)
+    ImGuiTableSortCacheJob job;
+    job.Specs = _PendingSpecs.Data;
+    job.SpecsCount = _PendingSpecs.Size;
+    job.CompareFunc = compare_func;
+    job.UserData = user_data;
+    job.Data = (ItemsPerUpdate > 0) ? _Pending.Data : Indices.Data;
+    job.Temp = _Temp.Data;
+    job.Steps = NULL;
+    if (!TableSortCacheRunSteps(this, &job))
+        return indices_changed;
+
+    if (ItemsPerUpdate > 0)
+        Indices.swap(_Pending);
+    SortedBy.swap(_PendingSpecs);
+    _SortedCount = Indices.Size;
+    if (_Steps.Size > 0)
+        SortCount++;
+    _Steps.resize(0);
+    _StepsDone = 0;
+    _Pending.resize(0); // Keep capacity
+    _Temp.resize(0);
+    _Sorting = false;
+    return true;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Tables: Headers
 //-------------------------------------------------------------------------
@@ -3087,10 +3512,12 @@ void ImGui::TableHeadersRow()
     if (table->HostSkipItems) // Merely an optimization, you may skip in your own code.
         return;
 
+    // Headers are submitted in index order. Columns not requesting output (e.g. clipped columns of a wide table) are
+    // skipped without calling TableSetColumnIndex(), which would return false for them anyway.
     const int columns_count = TableGetColumnCount();
     for (int column_n = 0; column_n < columns_count; column_n++)
     {
-        if (!TableSetColumnIndex(column_n))
+        if (!table->Columns[column_n].IsRequestOutput || !TableSetColumnIndex(column_n))
             continue;
 
         // Push an id to allow empty/unnamed headers. This is also idiomatic as it ensure there is a consistent ID path to access columns (for e.g. automation)
@@ -3452,7 +3879,7 @@ void ImGui::TableOpenContextMenu(int column_n)
         table->IsContextPopupOpen = true;
         table->ContextPopupColumn = (ImGuiTableColumnIdx)column_n;
         table->InstanceInteracted = table->InstanceCurrent;
-        const ImGuiID context_menu_id = ImHashStr("##ContextMenu", 0, table->ID);
+        const ImGuiID context_menu_id = IM_HASH_STR_LITERAL("##ContextMenu", table->ID);
         OpenPopupEx(context_menu_id, ImGuiPopupFlags_None);
     }
 }
@@ -3461,7 +3888,7 @@ bool ImGui::TableBeginContextMenuPopup(ImGuiTable* table)
 {
     if (!table->IsContextPopupOpen || table->InstanceCurrent != table->InstanceInteracted)
         return false;
-    const ImGuiID context_menu_id = ImHashStr("##ContextMenu", 0, table->ID);
+    const ImGuiID context_menu_id = IM_HASH_STR_LITERAL("##ContextMenu", table->ID);
     if (BeginPopupEx(context_menu_id, ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoSavedSettings))
         return true;
     table->IsContextPopupOpen = false;
@@ -3888,7 +4315,7 @@ void ImGui::TableSettingsAddSettingsHandler()
 {
     ImGuiSettingsHandler ini_handler;
     ini_handler.TypeName = "Table";
-    ini_handler.TypeHash = ImHashStr("Table");
+    ini_handler.TypeHash = IM_HASH_STR_LITERAL("Table", 0);
     ini_handler.ClearAllFn = TableSettingsHandler_ClearAll;
     ini_handler.ReadOpenFn = TableSettingsHandler_ReadOpen;
     ini_handler.ReadLineFn = TableSettingsHandler_ReadLine;
@@ -3925,6 +4352,7 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     IM_ASSERT(table->MemoryCompacted == false);
     table->SortSpecs.Specs = NULL;
     table->SortSpecsMulti.clear();
+    table->ColumnsMaxXByOrder.clear();
     table->IsSortSpecsDirty = true; // FIXME: In theory shouldn't have to leak into user performing a sort on resume.
     table->ColumnsNames.clear();
     table->MemoryCompacted = true;
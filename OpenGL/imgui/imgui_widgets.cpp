@@ -15,6 +15,7 @@ Index of this file:
 // [SECTION] Widgets: SliderScalar, SliderFloat, SliderInt, etc.
 // [SECTION] Widgets: InputScalar, InputFloat, InputInt, etc.
 // [SECTION] Widgets: InputText, InputTextMultiline
+// [SECTION] Widgets: InputTextMultilineLarge
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 // [SECTION] Widgets: TreeNode, CollapsingHeader, etc.
 // [SECTION] Widgets: Selectable
@@ -1875,7 +1876,7 @@ bool ImGui::BeginCombo(const char* label, const char* preview_value, ImGuiComboF
     // Open on click
     bool hovered, held;
     bool pressed = ButtonBehavior(bb, id, &hovered, &held);
-    const ImGuiID popup_id = ImHashStr("##ComboPopup", 0, id);
+    const ImGuiID popup_id = IM_HASH_STR_LITERAL("##ComboPopup", id);
     bool popup_open = IsPopupOpen(popup_id, ImGuiPopupFlags_None);
     if (pressed && !popup_open)
     {
@@ -2206,8 +2207,106 @@ const ImGuiDataTypeInfo* ImGui::DataTypeGetInfo(ImGuiDataType data_type)
     return &GDataTypeInfo[data_type];
 }
 
+// Fast path for the formats used by most widgets: "%d", "%u", "%lld", "%llu", "%f", "%.Nf", with optional text around them.
+// Skips varargs and printf() format parsing. Return -1 for anything else (flags, width, other conversions), letting caller use ImFormatString().
+// Note that the decimal point is always '.', as with printf() in the default "C" locale.
+static int DataTypeFormatStringFast(char* buf, int buf_size, ImGuiDataType data_type, const void* p_data, const char* format)
+{
+    const char* fmt_start = ImParseFormatFindStart(format);
+    if (fmt_start[0] != '%')
+        return -1;
+    const char* fmt = fmt_start + 1;
+    int precision = -1;
+    bool is_64 = false;
+    if (fmt[0] == '.' && fmt[1] >= '0' && fmt[1] <= '9' && !(fmt[2] >= '0' && fmt[2] <= '9'))
+    {
+        precision = fmt[1] - '0';
+        fmt += 2;
+    }
+    else if (fmt[0] == 'l' && fmt[1] == 'l')
+    {
+        is_64 = true;
+        fmt += 2;
+    }
+    else if (fmt[0] == 'I' && fmt[1] == '6' && fmt[2] == '4')
+    {
+        is_64 = true;
+        fmt += 3;
+    }
+    const char conversion = *fmt++;
+    const char* suffix = fmt;
+    if (strchr(suffix, '%') != NULL)
+        return -1;
+
+    char value_buf[32];
+    int value_len = -1;
+    const bool is_floating_point = (data_type == ImGuiDataType_Float || data_type == ImGuiDataType_Double);
+    if (is_floating_point && conversion == 'f' && !is_64)
+    {
+        const double v = (data_type == ImGuiDataType_Float) ? (double)*(const float*)p_data : *(const double*)p_data;
+        value_len = ImFormatFloatFixed(value_buf, IM_ARRAYSIZE(value_buf), v, precision < 0 ? 6 : precision);
+    }
+    else if (!is_floating_point && (conversion == 'd' || conversion == 'i' || conversion == 'u') && precision < 0)
+    {
+        // Reproduce printf() reinterpreting the argument: small types are promoted to int, then read as signed or unsigned.
+        const bool is_64_data = (data_type == ImGuiDataType_S64 || data_type == ImGuiDataType_U64);
+        if (is_64 != is_64_data)
+            return -1;
+        ImU64 v;
+        switch (data_type)
+        {
+        case ImGuiDataType_S8:  v = (ImU64)(ImU32)(ImS32)*(const ImS8*)p_data; break;
+        case ImGuiDataType_U8:  v = (ImU64)(ImU32)*(const ImU8*)p_data; break;
+        case ImGuiDataType_S16: v = (ImU64)(ImU32)(ImS32)*(const ImS16*)p_data; break;
+        case ImGuiDataType_U16: v = (ImU64)(ImU32)*(const ImU16*)p_data; break;
+        case ImGuiDataType_S32:
+        case ImGuiDataType_U32: v = (ImU64)*(const ImU32*)p_data; break;
+        case ImGuiDataType_S64:
+        case ImGuiDataType_U64: v = *(const ImU64*)p_data; break;
+        default: return -1;
+        }
+        bool negative = false;
+        if (conversion != 'u')
+        {
+            const ImS64 v_signed = is_64 ? (ImS64)v : (ImS64)(ImS32)(ImU32)v;
+            negative = v_signed < 0;
+            v = negative ? (ImU64)0 - (ImU64)v_signed : (ImU64)v_signed;
+        }
+        char* p = value_buf + IM_ARRAYSIZE(value_buf);
+        do { *--p = (char)('0' + v % 10); v /= 10; } while (v != 0);
+        if (negative)
+            *--p = '-';
+        value_len = (int)(value_buf + IM_ARRAYSIZE(value_buf) - p);
+        memmove(value_buf, p, (size_t)value_len);
+    }
+    if (value_len < 0)
+        return -1;
+
+    // Assemble prefix + value + suffix
+    const int prefix_len = (int)(fmt_start - format);
+    const int suffix_len = (int)ImStrlen(suffix);
+    const int len = prefix_len + value_len + suffix_len;
+    if (len >= buf_size)
+        return -1;
+    char* out = buf;
+    for (const char* p = format; p < fmt_start; p++, out++) // Unescape "%%" in prefix
+    {
+        *out = *p;
+        if (p[0] == '%' && p[1] == '%')
+            p++;
+    }
+    memcpy(out, value_buf, (size_t)value_len);
+    out += value_len;
+    memcpy(out, suffix, (size_t)suffix_len + 1);
+    return (int)(out + suffix_len - buf);
+}
+
 int ImGui::DataTypeFormatString(char* buf, int buf_size, ImGuiDataType data_type, const void* p_data, const char* format)
 {
+    const int len = DataTypeFormatStringFast(buf, buf_size, data_type, p_data, format);
+    if (len >= 0)
+        return len;
+
     // Signedness doesn't matter when pushing integer arguments
     if (data_type == ImGuiDataType_S32 || data_type == ImGuiDataType_U32)
         return ImFormatString(buf, buf_size, format, *(const ImU32*)p_data);
@@ -2311,8 +2410,20 @@ bool ImGui::DataTypeApplyFromText(const char* buf, ImGuiDataType data_type, void
 
     // Small types need a 32-bit buffer to receive the result from scanf()
     int v32 = 0;
-    if (sscanf(buf, format, type_info->Size >= 4 ? p_data : &v32) < 1)
+    if (data_type == ImGuiDataType_Float)
+    {
+        if (ImParseFloat(buf, (float*)p_data) == NULL)
+            return false;
+    }
+    else if (data_type == ImGuiDataType_Double)
+    {
+        if (ImParseDouble(buf, (double*)p_data) == NULL)
+            return false;
+    }
+    else if (sscanf(buf, format, type_info->Size >= 4 ? p_data : &v32) < 1)
+    {
         return false;
+    }
     if (type_info->Size < 4)
     {
         if (data_type == ImGuiDataType_S8)
@@ -2404,7 +2515,6 @@ static float GetMinimumStepAtDecimalPrecision(int decimal_precision)
 template<typename TYPE>
 TYPE ImGui::RoundScalarWithFormatT(const char* format, ImGuiDataType data_type, TYPE v)
 {
-    IM_UNUSED(data_type);
     IM_ASSERT(data_type == ImGuiDataType_Float || data_type == ImGuiDataType_Double);
     const char* fmt_start = ImParseFormatFindStart(format);
     if (fmt_start[0] != '%' || fmt_start[1] == '%') // Don't apply if the value is not visible in the format string
@@ -2417,11 +2527,10 @@ TYPE ImGui::RoundScalarWithFormatT(const char* format, ImGuiDataType data_type,
 
     // Format value with our rounding, and read back
     char v_str[64];
-    ImFormatString(v_str, IM_ARRAYSIZE(v_str), fmt_start, v);
-    const char* p = v_str;
-    while (*p == ' ')
-        p++;
-    v = (TYPE)ImAtof(p);
+    DataTypeFormatString(v_str, IM_ARRAYSIZE(v_str), data_type, &v, fmt_start);
+    double v_rounded;
+    if (ImParseDouble(v_str, &v_rounded) != NULL)
+        v = (TYPE)v_rounded;
 
     return v;
 }
@@ -5453,6 +5562,861 @@ void ImGui::DebugNodeInputTextState(ImGuiInputTextState* state)
 #endif
 }
 
+//-------------------------------------------------------------------------
+// [SECTION] Widgets: InputTextMultilineLarge
+//-------------------------------------------------------------------------
+// - ImGuiTextDocument
+// - InputTextLargeXXX() [Internal]
+// - InputTextMultilineLarge()
+//-------------------------------------------------------------------------
+// InputTextEx() works on a flat buffer and measures it from the start every frame, and so does imstb_textedit.h which locates
+// rows by calling STB_TEXTEDIT_LAYOUTROW() from offset 0. Neither can scale to documents of tens of MB, whatever the storage.
+// InputTextMultilineLarge() implements the same editing behaviors over an ImGuiTextDocument, and only lays out visible lines.
+//-------------------------------------------------------------------------
+
+static int TextDocumentCountLineBreaks(const char* text, const char* text_end)
+{
+    int count = 0;
+    for (const char* p = text; p < text_end && (p = (const char*)ImMemchr(p, '\n', (size_t)(text_end - p))) != NULL; p++)
+        count++;
+    return count;
+}
+
+// Fenwick tree helpers. Tree[0] is unused, Tree[n+1] covers Chunks[n].
+static void TextDocumentTreeAdd(ImVector<int>& tree, int chunk_n, int delta)
+{
+    for (int i = chunk_n + 1; i < tree.Size; i += i & -i)
+        tree.Data[i] += delta;
+}
+
+// Sum of values for chunks [0..chunk_n)
+static int TextDocumentTreeSum(const ImVector<int>& tree, int chunk_n)
+{
+    int sum = 0;
+    for (int i = chunk_n; i > 0; i -= i & -i)
+        sum += tree.Data[i];
+    return sum;
+}
+
+// Return the largest number of leading chunks whose sum is <= value (or < value when 'strict'), and the remainder.
+static int TextDocumentTreeFind(const ImVector<int>& tree, int value, bool strict, int* out_remainder)
+{
+    const int count = tree.Size - 1;
+    int step = 1;
+    while (step * 2 <= count)
+        step *= 2;
+    int pos = 0;
+    for (; step > 0; step >>= 1)
+        if (pos + step <= count && (strict ? tree.Data[pos + step] < value : tree.Data[pos + step] <= value))
+        {
+            pos += step;
+            value -= tree.Data[pos];
+        }
+    *out_remainder = value;
+    return pos;
+}
+
+ImGuiTextDocument::ImGuiTextDocument()
+{
+    TextLen = LineBreaksCount = 0;
+    ChunkSizeMax = 16 * 1024;
+    Cursor = SelectStart = 0;
+    CursorPreferredX = -1.0f;
+    CursorAnim = 0.0f;
+    CursorFollow = false;
+    MaxLineWidth = 0.0f;
+    UndoPos = 0;
+    Chunks.push_back(Chunk());
+    _RebuildTrees();
+}
+
+ImGuiTextDocument::~ImGuiTextDocument()
+{
+    for (Chunk& chunk : Chunks)
+        chunk.Text.clear();
+}
+
+void ImGuiTextDocument::Clear()
+{
+    for (Chunk& chunk : Chunks)
+        chunk.Text.clear();
+    Chunks.resize(1);
+    Chunks[0].LineBreaks = 0;
+    Cursor = SelectStart = 0;
+    CursorPreferredX = -1.0f;
+    MaxLineWidth = 0.0f;
+    UndoRecords.clear();
+    UndoBuf.clear();
+    UndoPos = 0;
+    _RebuildTrees();
+}
+
+void ImGuiTextDocument::SetText(const char* text, const char* text_end)
+{
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    Clear();
+    _ReplaceChunk(0, text, (int)(text_end - text));
+}
+
+// Find chunk containing byte 'offset'. An offset on a chunk boundary maps to the start of the next non-empty chunk, TextLen maps to the end of last chunk.
+int ImGuiTextDocument::_FindChunk(int offset, int* out_offset_in_chunk) const
+{
+    int chunk_n = TextDocumentTreeFind(ChunksBytesTree, offset, false, out_offset_in_chunk);
+    if (chunk_n == Chunks.Size)
+    {
+        chunk_n = Chunks.Size - 1;
+        *out_offset_in_chunk += Chunks[chunk_n].Text.Size;
+    }
+    return chunk_n;
+}
+
+int ImGuiTextDocument::_GetChunkOffset(int chunk_n) const
+{
+    return TextDocumentTreeSum(ChunksBytesTree, chunk_n);
+}
+
+void ImGuiTextDocument::_RebuildTrees()
+{
+    const int count = Chunks.Size;
+    ChunksBytesTree.resize(count + 1);
+    ChunksLinesTree.resize(count + 1);
+    ChunksBytesTree[0] = ChunksLinesTree[0] = 0;
+    TextLen = LineBreaksCount = 0;
+    for (int n = 0; n < count; n++)
+    {
+        ChunksBytesTree[n + 1] = Chunks[n].Text.Size;
+        ChunksLinesTree[n + 1] = Chunks[n].LineBreaks;
+        TextLen += Chunks[n].Text.Size;
+        LineBreaksCount += Chunks[n].LineBreaks;
+    }
+    for (int i = 1; i <= count; i++)
+    {
+        const int parent = i + (i & -i);
+        if (parent <= count)
+        {
+            ChunksBytesTree[parent] += ChunksBytesTree[i];
+            ChunksLinesTree[parent] += ChunksLinesTree[i];
+        }
+    }
+}
+
+// Replace contents of a chunk, splitting the text into as many chunks as needed.
+void ImGuiTextDocument::_ReplaceChunk(int chunk_n, const char* text, int text_len)
+{
+    const int split_size = ImMax(ChunkSizeMax / 2, 1);
+    const int new_count = (text_len <= ChunkSizeMax) ? 1 : (text_len + split_size - 1) / split_size;
+    if (new_count > 1)
+    {
+        const int old_count = Chunks.Size;
+        Chunks.resize(old_count + new_count - 1);
+        memmove(Chunks.Data + chunk_n + new_count, Chunks.Data + chunk_n + 1, (size_t)(old_count - chunk_n - 1) * sizeof(Chunk));
+        for (int n = chunk_n + 1; n < chunk_n + new_count; n++)
+            IM_PLACEMENT_NEW(&Chunks[n]) Chunk();
+    }
+    for (int n = 0; n < new_count; n++)
+    {
+        const char* chunk_text = text + split_size * n;
+        const int chunk_len = (n == new_count - 1) ? text_len - split_size * n : split_size;
+        Chunk& chunk = Chunks[chunk_n + n];
+        chunk.Text.resize(chunk_len);
+        if (chunk_len > 0)
+            memcpy(chunk.Text.Data, chunk_text, (size_t)chunk_len);
+        chunk.LineBreaks = TextDocumentCountLineBreaks(chunk_text, chunk_text + chunk_len);
+    }
+    _RebuildTrees();
+}
+
+void ImGuiTextDocument::Insert(int offset, const char* text, const char* text_end)
+{
+    IM_ASSERT(offset >= 0 && offset <= TextLen);
+    if (text_end == NULL)
+        text_end = text + ImStrlen(text);
+    const int text_len = (int)(text_end - text);
+    if (text_len == 0)
+        return;
+
+    int offset_in_chunk;
+    const int chunk_n = _FindChunk(offset, &offset_in_chunk);
+    Chunk& chunk = Chunks[chunk_n];
+    const int old_len = chunk.Text.Size;
+    if (old_len + text_len <= ChunkSizeMax)
+    {
+        // Fast path: insert in place and update counts
+        const int line_breaks = TextDocumentCountLineBreaks(text, text_end);
+        chunk.Text.resize(old_len + text_len);
+        memmove(chunk.Text.Data + offset_in_chunk + text_len, chunk.Text.Data + offset_in_chunk, (size_t)(old_len - offset_in_chunk));
+        memcpy(chunk.Text.Data + offset_in_chunk, text, (size_t)text_len);
+        chunk.LineBreaks += line_breaks;
+        TextDocumentTreeAdd(ChunksBytesTree, chunk_n, text_len);
+        TextDocumentTreeAdd(ChunksLinesTree, chunk_n, line_breaks);
+        TextLen += text_len;
+        LineBreaksCount += line_breaks;
+        return;
+    }
+
+    // Chunk would grow too large: split it
+    ImVector<char> merged;
+    merged.resize(old_len + text_len);
+    memcpy(merged.Data, chunk.Text.Data, (size_t)offset_in_chunk);
+    memcpy(merged.Data + offset_in_chunk, text, (size_t)text_len);
+    memcpy(merged.Data + offset_in_chunk + text_len, chunk.Text.Data + offset_in_chunk, (size_t)(old_len - offset_in_chunk));
+    _ReplaceChunk(chunk_n, merged.Data, merged.Size);
+}
+
+void ImGuiTextDocument::Delete(int offset, int len)
+{
+    IM_ASSERT(offset >= 0 && len >= 0 && offset + len <= TextLen);
+    if (len == 0)
+        return;
+
+    int offset_in_chunk;
+    int chunk_n = _FindChunk(offset, &offset_in_chunk);
+    bool has_empty_chunks = false;
+    while (len > 0)
+    {
+        Chunk& chunk = Chunks[chunk_n];
+        const int del_len = ImMin(len, chunk.Text.Size - offset_in_chunk);
+        char* del_p = chunk.Text.Data + offset_in_chunk;
+        const int del_line_breaks = TextDocumentCountLineBreaks(del_p, del_p + del_len);
+        memmove(del_p, del_p + del_len, (size_t)(chunk.Text.Size - offset_in_chunk - del_len));
+        chunk.Text.resize(chunk.Text.Size - del_len);
+        chunk.LineBreaks -= del_line_breaks;
+        TextDocumentTreeAdd(ChunksBytesTree, chunk_n, -del_len);
+        TextDocumentTreeAdd(ChunksLinesTree, chunk_n, -del_line_breaks);
+        TextLen -= del_len;
+        LineBreaksCount -= del_line_breaks;
+        has_empty_chunks |= (chunk.Text.Size == 0);
+        len -= del_len;
+        offset_in_chunk = 0;
+        chunk_n++;
+    }
+
+    // Remove emptied chunks (keep at least one)
+    if (has_empty_chunks && Chunks.Size > 1)
+    {
+        int dst_n = 0;
+        for (int src_n = 0; src_n < Chunks.Size; src_n++)
+        {
+            if (Chunks[src_n].Text.Size == 0 && (dst_n > 0 || src_n < Chunks.Size - 1))
+            {
+                Chunks[src_n].Text.clear();
+                continue;
+            }
+            if (dst_n != src_n)
+                memcpy(&Chunks[dst_n], &Chunks[src_n], sizeof(Chunk));
+            dst_n++;
+        }
+        Chunks.resize(dst_n);
+        _RebuildTrees();
+    }
+}
+
+void ImGuiTextDocument::GetText(int offset, int len, ImVector<char>* out) const
+{
+    IM_ASSERT(offset >= 0 && len >= 0 && offset + len <= TextLen);
+    int out_pos = out->Size;
+    out->resize(out->Size + len);
+    int offset_in_chunk;
+    for (int chunk_n = _FindChunk(offset, &offset_in_chunk); len > 0; chunk_n++, offset_in_chunk = 0)
+    {
+        const Chunk& chunk = Chunks[chunk_n];
+        const int copy_len = ImMin(len, chunk.Text.Size - offset_in_chunk);
+        memcpy(out->Data + out_pos, chunk.Text.Data + offset_in_chunk, (size_t)copy_len);
+        out_pos += copy_len;
+        len -= copy_len;
+    }
+}
+
+char ImGuiTextDocument::GetChar(int offset) const
+{
+    if (offset < 0 || offset >= TextLen)
+        return 0;
+    int offset_in_chunk;
+    const int chunk_n = _FindChunk(offset, &offset_in_chunk);
+    return Chunks[chunk_n].Text.Data[offset_in_chunk];
+}
+
+int ImGuiTextDocument::GetLineStart(int line_no) const
+{
+    if (line_no <= 0)
+        return 0;
+    if (line_no > LineBreaksCount)
+        return TextLen;
+
+    // Find chunk holding the line_no-th line break, then scan it
+    int line_breaks_remaining;
+    const int chunk_n = TextDocumentTreeFind(ChunksLinesTree, line_no, true, &line_breaks_remaining);
+    const Chunk& chunk = Chunks[chunk_n];
+    const char* p = chunk.Text.Data;
+    const char* p_end = p + chunk.Text.Size;
+    for (;; p++)
+    {
+        p = (const char*)ImMemchr(p, '\n', (size_t)(p_end - p));
+        IM_ASSERT(p != NULL);
+        if (--line_breaks_remaining == 0)
+            break;
+    }
+    return _GetChunkOffset(chunk_n) + (int)(p - chunk.Text.Data) + 1;
+}
+
+int ImGuiTextDocument::GetLineEnd(int line_no) const
+{
+    return (line_no < LineBreaksCount) ? GetLineStart(line_no + 1) - 1 : TextLen;
+}
+
+int ImGuiTextDocument::GetLineFromOffset(int offset) const
+{
+    IM_ASSERT(offset >= 0 && offset <= TextLen);
+    int offset_in_chunk;
+    const int chunk_n = _FindChunk(offset, &offset_in_chunk);
+    const char* chunk_text = Chunks[chunk_n].Text.Data;
+    return TextDocumentTreeSum(ChunksLinesTree, chunk_n) + TextDocumentCountLineBreaks(chunk_text, chunk_text + offset_in_chunk);
+}
+
+static bool InputTextLargeIsWordChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || (c & 0x80) != 0;
+}
+
+static int InputTextLargePrevCharOffset(const ImGuiTextDocument* doc, int offset)
+{
+    if (offset <= 0)
+        return 0;
+    offset--;
+    while (offset > 0 && (doc->GetChar(offset) & 0xC0) == 0x80) // Skip UTF-8 continuation bytes
+        offset--;
+    return offset;
+}
+
+static int InputTextLargeNextCharOffset(const ImGuiTextDocument* doc, int offset)
+{
+    if (offset >= doc->TextLen)
+        return doc->TextLen;
+    offset++;
+    while (offset < doc->TextLen && (doc->GetChar(offset) & 0xC0) == 0x80)
+        offset++;
+    return offset;
+}
+
+static int InputTextLargeWordLeftOffset(const ImGuiTextDocument* doc, int offset)
+{
+    while (offset > 0 && !InputTextLargeIsWordChar(doc->GetChar(offset - 1)))
+        offset--;
+    while (offset > 0 && InputTextLargeIsWordChar(doc->GetChar(offset - 1)))
+        offset--;
+    return offset;
+}
+
+static int InputTextLargeWordRightOffset(const ImGuiTextDocument* doc, int offset)
+{
+    while (offset < doc->TextLen && InputTextLargeIsWordChar(doc->GetChar(offset)))
+        offset++;
+    while (offset < doc->TextLen && !InputTextLargeIsWordChar(doc->GetChar(offset)) && doc->GetChar(offset) != '\n')
+        offset++;
+    return offset;
+}
+
+// Load a line into doc->TempBuf, return its start offset
+static int InputTextLargeLoadLine(ImGuiTextDocument* doc, int line_no)
+{
+    const int line_start = doc->GetLineStart(line_no);
+    const int line_end = doc->GetLineEnd(line_no);
+    doc->TempBuf.resize(0);
+    doc->GetText(line_start, line_end - line_start, &doc->TempBuf);
+    return line_start;
+}
+
+// Return byte offset within a line closest to 'x'
+static int InputTextLargeLineOffsetFromX(ImGuiContext* ctx, const char* line_begin, const char* line_end, float x)
+{
+    ImGuiContext& g = *ctx;
+    ImFont* font = g.Font;
+    const float scale = g.FontSize / font->FontSize;
+    float line_x = 0.0f;
+    const char* s = line_begin;
+    while (s < line_end)
+    {
+        unsigned int c;
+        const int c_len = ImTextCharFromUtf8(&c, s, line_end);
+        const float char_width = font->GetCharAdvance((ImWchar)c) * scale;
+        if (x < line_x + char_width * 0.5f)
+            break;
+        line_x += char_width;
+        s += c_len;
+    }
+    return (int)(s - line_begin);
+}
+
+static int InputTextLargeOffsetFromLineAndX(ImGuiContext* ctx, ImGuiTextDocument* doc, int line_no, float x)
+{
+    line_no = ImClamp(line_no, 0, doc->LineBreaksCount);
+    const int line_start = InputTextLargeLoadLine(doc, line_no);
+    return line_start + InputTextLargeLineOffsetFromX(ctx, doc->TempBuf.begin(), doc->TempBuf.end(), x);
+}
+
+static float InputTextLargeCalcCursorX(ImGuiContext* ctx, ImGuiTextDocument* doc, int offset)
+{
+    const int line_start = InputTextLargeLoadLine(doc, doc->GetLineFromOffset(offset));
+    return InputTextCalcTextSize(ctx, doc->TempBuf.begin(), doc->TempBuf.begin() + (offset - line_start)).x;
+}
+
+static void InputTextLargeSetCursor(ImGuiTextDocument* doc, int offset, bool select)
+{
+    doc->Cursor = offset;
+    if (!select)
+        doc->SelectStart = offset;
+    doc->CursorFollow = true;
+    doc->CursorAnim = -0.30f; // Reset the blinking cycle so cursor is visible while moving
+}
+
+// Replace a range of text, recording the change for undo. Consecutive typed characters are merged into one record.
+static void InputTextLargeReplace(ImGuiTextDocument* doc, int offset, int delete_len, const char* text, int text_len, bool record_undo, bool merge_undo)
+{
+    if (delete_len == 0 && text_len == 0)
+        return;
+    if (record_undo)
+    {
+        // Discard redo history
+        ImGuiTextDocument::UndoRecord* last_rec = (doc->UndoPos > 0) ? &doc->UndoRecords[doc->UndoPos - 1] : NULL;
+        doc->UndoRecords.resize(doc->UndoPos);
+        doc->UndoBuf.resize(last_rec ? last_rec->BufOffset + last_rec->DeletedLen + last_rec->InsertedLen : 0);
+
+        if (merge_undo && delete_len == 0 && last_rec && last_rec->DeletedLen == 0 && last_rec->Offset + last_rec->InsertedLen == offset && text[0] != '\n')
+        {
+            last_rec->InsertedLen += text_len;
+        }
+        else
+        {
+            ImGuiTextDocument::UndoRecord rec;
+            rec.Offset = offset;
+            rec.DeletedLen = delete_len;
+            rec.InsertedLen = text_len;
+            rec.BufOffset = doc->UndoBuf.Size;
+            doc->GetText(offset, delete_len, &doc->UndoBuf);
+            doc->UndoRecords.push_back(rec);
+            doc->UndoPos++;
+        }
+        doc->UndoBuf.resize(doc->UndoBuf.Size + text_len);
+        if (text_len > 0)
+            memcpy(doc->UndoBuf.Data + doc->UndoBuf.Size - text_len, text, (size_t)text_len);
+    }
+    doc->Delete(offset, delete_len);
+    if (text_len > 0)
+        doc->Insert(offset, text, text + text_len);
+}
+
+static void InputTextLargeReplaceSelection(ImGuiTextDocument* doc, const char* text, int text_len, bool record_undo, bool merge_undo)
+{
+    const int sel_min = ImMin(doc->Cursor, doc->SelectStart);
+    const int sel_max = ImMax(doc->Cursor, doc->SelectStart);
+    InputTextLargeReplace(doc, sel_min, sel_max - sel_min, text, text_len, record_undo, merge_undo && sel_min == sel_max);
+    InputTextLargeSetCursor(doc, sel_min + text_len, false);
+}
+
+static void InputTextLargeUndoRedo(ImGuiTextDocument* doc, bool undo)
+{
+    if (undo ? (doc->UndoPos == 0) : (doc->UndoPos == doc->UndoRecords.Size))
+        return;
+    const ImGuiTextDocument::UndoRecord& rec = doc->UndoRecords[undo ? --doc->UndoPos : doc->UndoPos++];
+    const char* deleted_text = doc->UndoBuf.Data + rec.BufOffset;
+    const char* inserted_text = deleted_text + rec.DeletedLen;
+    if (undo)
+    {
+        doc->Delete(rec.Offset, rec.InsertedLen);
+        if (rec.DeletedLen > 0)
+            doc->Insert(rec.Offset, deleted_text, deleted_text + rec.DeletedLen);
+        InputTextLargeSetCursor(doc, rec.Offset + rec.DeletedLen, false);
+    }
+    else
+    {
+        doc->Delete(rec.Offset, rec.DeletedLen);
+        if (rec.InsertedLen > 0)
+            doc->Insert(rec.Offset, inserted_text, inserted_text + rec.InsertedLen);
+        InputTextLargeSetCursor(doc, rec.Offset + rec.InsertedLen, false);
+    }
+}
+
+bool ImGui::InputTextMultilineLarge(const char* label, ImGuiTextDocument* doc, const ImVec2& size_arg, ImGuiInputTextFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    ImGuiIO& io = g.IO;
+    const ImGuiStyle& style = g.Style;
+    IM_ASSERT((flags & (ImGuiInputTextFlags_Password | ImGuiInputTextFlags_CallbackCompletion | ImGuiInputTextFlags_CallbackHistory | ImGuiInputTextFlags_CallbackAlways | ImGuiInputTextFlags_CallbackCharFilter | ImGuiInputTextFlags_CallbackResize | ImGuiInputTextFlags_CallbackEdit)) == 0); // Not supported
+    flags |= ImGuiInputTextFlags_Multiline;
+
+    // Same layout as InputTextMultiline(): a group holding a child window + the label
+    BeginGroup();
+    const ImGuiID id = window->GetID(label);
+    const ImVec2 label_size = CalcTextSize(label, NULL, true);
+    const ImVec2 frame_size = CalcItemSize(size_arg, CalcItemWidth(), g.FontSize * 8.0f + style.FramePadding.y * 2.0f);
+    const ImVec2 total_size = ImVec2(frame_size.x + (label_size.x > 0.0f ? style.ItemInnerSpacing.x + label_size.x : 0.0f), frame_size.y);
+    const ImRect frame_bb(window->DC.CursorPos, window->DC.CursorPos + frame_size);
+    const ImRect total_bb(frame_bb.Min, frame_bb.Min + total_size);
+
+    ImVec2 backup_pos = window->DC.CursorPos;
+    ItemSize(total_bb, style.FramePadding.y);
+    if (!ItemAdd(total_bb, id, &frame_bb, ImGuiItemFlags_Inputable))
+    {
+        EndGroup();
+        return false;
+    }
+    ImGuiLastItemData item_data_backup = g.LastItemData;
+    window->DC.CursorPos = backup_pos;
+
+    if (g.NavActivateId == id && (g.NavActivateFlags & ImGuiActivateFlags_FromTabbing) && (flags & ImGuiInputTextFlags_AllowTabInput))
+        g.NavActivateId = 0;
+    const ImGuiID backup_activate_id = g.NavActivateId;
+    if (g.ActiveId == id) // Prevent reactivation
+        g.NavActivateId = 0;
+
+    PushStyleColor(ImGuiCol_ChildBg, style.Colors[ImGuiCol_FrameBg]);
+    PushStyleVar(ImGuiStyleVar_ChildRounding, style.FrameRounding);
+    PushStyleVar(ImGuiStyleVar_ChildBorderSize, style.FrameBorderSize);
+    PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 0));
+    bool child_visible = BeginChildEx(label, id, frame_bb.GetSize(), ImGuiChildFlags_Borders, ImGuiWindowFlags_NoMove | ImGuiWindowFlags_HorizontalScrollbar);
+    g.NavActivateId = backup_activate_id;
+    PopStyleVar(3);
+    PopStyleColor();
+    if (!child_visible)
+    {
+        EndChild();
+        EndGroup();
+        return false;
+    }
+    ImGuiWindow* draw_window = g.CurrentWindow;
+    draw_window->DC.NavLayersActiveMaskNext |= (1 << draw_window->DC.NavLayerCurrent);
+    const ImVec2 inner_size = draw_window->InnerRect.GetSize();
+    const float line_height = g.FontSize;
+    ImVec2 text_origin = draw_window->DC.CursorPos + style.FramePadding; // Already includes scrolling
+
+    bool hovered = ItemHoverable(frame_bb, id, g.LastItemData.ItemFlags | ImGuiItemFlags_NoNavDisableMouseHover);
+    if (hovered)
+        SetMouseCursor(ImGuiMouseCursor_TextInput);
+    if (hovered && g.NavHighlightItemUnderNav)
+        hovered = false;
+
+    if (g.LastItemData.ItemFlags & ImGuiItemFlags_ReadOnly)
+        flags |= ImGuiInputTextFlags_ReadOnly;
+    const bool is_readonly = (flags & ImGuiInputTextFlags_ReadOnly) != 0;
+    const bool is_undoable = (flags & ImGuiInputTextFlags_NoUndoRedo) == 0 && !is_readonly;
+    const bool is_osx = io.ConfigMacOSXBehaviors;
+    const bool user_clicked = hovered && io.MouseClicked[0];
+    const bool input_requested_by_nav = (g.ActiveId != id) && (g.NavActivateId == id);
+
+    // The document may have been modified by the application
+    doc->Cursor = ImClamp(doc->Cursor, 0, doc->TextLen);
+    doc->SelectStart = ImClamp(doc->SelectStart, 0, doc->TextLen);
+
+    if (g.ActiveId != id && (user_clicked || input_requested_by_nav))
+    {
+        SetActiveID(id, window);
+        SetFocusID(id, window);
+        FocusWindow(window);
+        doc->CursorAnim = -0.30f;
+    }
+    else if (g.ActiveId == id && io.MouseClicked[0] && !hovered)
+    {
+        ClearActiveID(); // Release focus when we click outside
+    }
+
+    bool value_changed = false;
+    if (g.ActiveId == id)
+    {
+        const ImGuiKey always_owned_keys[] = { ImGuiKey_LeftArrow, ImGuiKey_RightArrow, ImGuiKey_UpArrow, ImGuiKey_DownArrow, ImGuiKey_PageUp, ImGuiKey_PageDown, ImGuiKey_Enter, ImGuiKey_KeypadEnter, ImGuiKey_Delete, ImGuiKey_Backspace, ImGuiKey_Home, ImGuiKey_End };
+        for (ImGuiKey key : always_owned_keys)
+            SetKeyOwner(key, id);
+        if (user_clicked)
+            SetKeyOwner(ImGuiKey_MouseLeft, id);
+        g.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+        if (is_osx)
+            SetKeyOwner(ImGuiMod_Alt, id);
+
+        // Mouse: click, shift+click, double-click to select a word, drag to select
+        if (user_clicked || (io.MouseDown[0] && (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f)))
+        {
+            const ImVec2 mouse_pos = io.MousePos - text_origin;
+            const int offset = InputTextLargeOffsetFromLineAndX(&g, doc, (int)ImFloor(mouse_pos.y / line_height), mouse_pos.x);
+            if (user_clicked && io.MouseClickedCount[0] == 2)
+            {
+                doc->SelectStart = InputTextLargeIsWordChar(doc->GetChar(offset)) ? InputTextLargeWordLeftOffset(doc, InputTextLargeNextCharOffset(doc, offset)) : offset;
+                InputTextLargeSetCursor(doc, InputTextLargeWordRightOffset(doc, offset), true);
+            }
+            else
+            {
+                InputTextLargeSetCursor(doc, offset, io.KeyShift || !user_clicked);
+            }
+            doc->CursorFollow = !user_clicked; // Scroll when dragging outside
+            doc->CursorPreferredX = -1.0f;
+        }
+    }
+
+    // Process keyboard inputs
+    if (g.ActiveId == id && !g.ActiveIdIsJustActivated)
+    {
+        const bool ignore_char_inputs = (io.KeyCtrl && !io.KeyAlt) || (is_osx && io.KeyCtrl);
+        if (io.InputQueueCharacters.Size > 0)
+        {
+            if (!ignore_char_inputs && !is_readonly && !input_requested_by_nav)
+            {
+                char chars_utf8[64 + 1];
+                int chars_len = 0;
+                for (int n = 0; n < io.InputQueueCharacters.Size; n++)
+                {
+                    unsigned int c = (unsigned int)io.InputQueueCharacters[n];
+                    if (c == '\t') // Handled below with Tab key
+                        continue;
+                    if (!InputTextFilterCharacter(&g, &c, flags, NULL, NULL, false))
+                        continue;
+                    if (chars_len + 5 > IM_ARRAYSIZE(chars_utf8))
+                    {
+                        InputTextLargeReplaceSelection(doc, chars_utf8, chars_len, is_undoable, true);
+                        chars_len = 0;
+                    }
+                    chars_len += (int)ImStrlen(ImTextCharToUtf8(chars_utf8 + chars_len, c));
+                    value_changed = true;
+                }
+                if (chars_len > 0)
+                    InputTextLargeReplaceSelection(doc, chars_utf8, chars_len, is_undoable, true);
+            }
+            io.InputQueueCharacters.resize(0);
+        }
+
+        const ImGuiInputFlags f_repeat = ImGuiInputFlags_Repeat;
+        const bool is_wordmove_key_down = is_osx ? io.KeyAlt : io.KeyCtrl;
+        const bool is_cut   = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_X, f_repeat, id) || Shortcut(ImGuiMod_Shift | ImGuiKey_Delete, f_repeat, id)) && !is_readonly && doc->HasSelection();
+        const bool is_copy  = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_C, 0,        id) || Shortcut(ImGuiMod_Ctrl  | ImGuiKey_Insert, 0,        id)) && doc->HasSelection();
+        const bool is_paste = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_V, f_repeat, id) || Shortcut(ImGuiMod_Shift | ImGuiKey_Insert, f_repeat, id)) && !is_readonly;
+        const bool is_undo  = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_Z, f_repeat, id)) && is_undoable;
+        const bool is_redo  = (Shortcut(ImGuiMod_Ctrl | ImGuiKey_Y, f_repeat, id) || Shortcut(ImGuiMod_Ctrl | ImGuiMod_Shift | ImGuiKey_Z, f_repeat, id)) && is_undoable;
+        const bool is_select_all = Shortcut(ImGuiMod_Ctrl | ImGuiKey_A, 0, id);
+        const bool is_tab = (flags & ImGuiInputTextFlags_AllowTabInput) && !is_readonly && Shortcut(ImGuiKey_Tab, f_repeat, id);
+        const bool is_cancel = Shortcut(ImGuiKey_Escape, f_repeat, id);
+        const int sel_min = ImMin(doc->Cursor, doc->SelectStart);
+        const int sel_max = ImMax(doc->Cursor, doc->SelectStart);
+        const int row_count_per_page = ImMax((int)((inner_size.y - style.FramePadding.y * 2.0f) / line_height), 1);
+
+        bool is_vertical_move = false;
+        if (IsKeyPressed(ImGuiKey_LeftArrow))
+        {
+            int offset = is_wordmove_key_down ? InputTextLargeWordLeftOffset(doc, doc->Cursor) : (doc->HasSelection() && !io.KeyShift) ? sel_min : InputTextLargePrevCharOffset(doc, doc->Cursor);
+            InputTextLargeSetCursor(doc, offset, io.KeyShift);
+        }
+        else if (IsKeyPressed(ImGuiKey_RightArrow))
+        {
+            int offset = is_wordmove_key_down ? InputTextLargeWordRightOffset(doc, doc->Cursor) : (doc->HasSelection() && !io.KeyShift) ? sel_max : InputTextLargeNextCharOffset(doc, doc->Cursor);
+            InputTextLargeSetCursor(doc, offset, io.KeyShift);
+        }
+        else if (IsKeyPressed(ImGuiKey_UpArrow) || IsKeyPressed(ImGuiKey_DownArrow) || IsKeyPressed(ImGuiKey_PageUp) || IsKeyPressed(ImGuiKey_PageDown))
+        {
+            const int line_delta = IsKeyPressed(ImGuiKey_UpArrow) ? -1 : IsKeyPressed(ImGuiKey_DownArrow) ? +1 : IsKeyPressed(ImGuiKey_PageUp) ? -row_count_per_page : +row_count_per_page;
+            const int line_no = doc->GetLineFromOffset(doc->Cursor) + line_delta;
+            if (doc->CursorPreferredX < 0.0f)
+                doc->CursorPreferredX = InputTextLargeCalcCursorX(&g, doc, doc->Cursor);
+            const int offset = (line_no < 0) ? 0 : (line_no > doc->LineBreaksCount) ? doc->TextLen : InputTextLargeOffsetFromLineAndX(&g, doc, line_no, doc->CursorPreferredX);
+            InputTextLargeSetCursor(doc, offset, io.KeyShift);
+            is_vertical_move = true;
+        }
+        else if (IsKeyPressed(ImGuiKey_Home))
+        {
+            InputTextLargeSetCursor(doc, io.KeyCtrl ? 0 : doc->GetLineStart(doc->GetLineFromOffset(doc->Cursor)), io.KeyShift);
+        }
+        else if (IsKeyPressed(ImGuiKey_End))
+        {
+            InputTextLargeSetCursor(doc, io.KeyCtrl ? doc->TextLen : doc->GetLineEnd(doc->GetLineFromOffset(doc->Cursor)), io.KeyShift);
+        }
+        else if ((IsKeyPressed(ImGuiKey_Delete) || IsKeyPressed(ImGuiKey_Backspace)) && !is_readonly && !is_cut)
+        {
+            if (!doc->HasSelection())
+            {
+                if (IsKeyPressed(ImGuiKey_Delete))
+                    doc->Cursor = is_wordmove_key_down ? InputTextLargeWordRightOffset(doc, doc->Cursor) : InputTextLargeNextCharOffset(doc, doc->Cursor);
+                else
+                    doc->Cursor = is_wordmove_key_down ? InputTextLargeWordLeftOffset(doc, doc->Cursor) : InputTextLargePrevCharOffset(doc, doc->Cursor);
+            }
+            if (doc->HasSelection())
+            {
+                InputTextLargeReplaceSelection(doc, NULL, 0, is_undoable, false);
+                value_changed = true;
+            }
+        }
+        else if ((IsKeyPressed(ImGuiKey_Enter) || IsKeyPressed(ImGuiKey_KeypadEnter)) && !is_readonly)
+        {
+            InputTextLargeReplaceSelection(doc, "\n", 1, is_undoable, false);
+            value_changed = true;
+        }
+        else if (is_tab)
+        {
+            InputTextLargeReplaceSelection(doc, "\t", 1, is_undoable, true);
+            value_changed = true;
+        }
+        else if (is_undo || is_redo)
+        {
+            InputTextLargeUndoRedo(doc, is_undo);
+            value_changed = true;
+        }
+        else if (is_select_all)
+        {
+            doc->SelectStart = 0;
+            InputTextLargeSetCursor(doc, doc->TextLen, true);
+        }
+        else if (is_cut || is_copy)
+        {
+            doc->TempBuf.resize(0);
+            doc->GetText(sel_min, sel_max - sel_min, &doc->TempBuf);
+            doc->TempBuf.push_back(0);
+            SetClipboardText(doc->TempBuf.Data);
+            if (is_cut)
+            {
+                InputTextLargeReplaceSelection(doc, NULL, 0, is_undoable, false);
+                value_changed = true;
+            }
+        }
+        else if (is_paste)
+        {
+            if (const char* clipboard = GetClipboardText())
+            {
+                // Filter pasted characters
+                doc->TempBuf.resize(0);
+                const char* clipboard_end = clipboard + ImStrlen(clipboard);
+                for (const char* s = clipboard; s < clipboard_end; )
+                {
+                    unsigned int c;
+                    s += ImTextCharFromUtf8(&c, s, clipboard_end);
+                    if (!InputTextFilterCharacter(&g, &c, flags, NULL, NULL, true))
+                        continue;
+                    char c_utf8[5];
+                    const int c_len = (int)ImStrlen(ImTextCharToUtf8(c_utf8, c));
+                    doc->TempBuf.resize(doc->TempBuf.Size + c_len);
+                    memcpy(doc->TempBuf.Data + doc->TempBuf.Size - c_len, c_utf8, (size_t)c_len);
+                }
+                if (doc->TempBuf.Size > 0)
+                {
+                    InputTextLargeReplaceSelection(doc, doc->TempBuf.Data, doc->TempBuf.Size, is_undoable, false);
+                    value_changed = true;
+                }
+            }
+        }
+        else if (is_cancel)
+        {
+            ClearActiveID();
+        }
+        if (!is_vertical_move && doc->CursorFollow)
+            doc->CursorPreferredX = -1.0f;
+    }
+
+    // Scroll to keep cursor visible. Applied immediately to avoid a frame of lag.
+    const int line_count = doc->GetLineCount();
+    const float content_height = line_count * line_height + style.FramePadding.y * 2.0f;
+    if (g.ActiveId == id && doc->CursorFollow)
+    {
+        const float cursor_x = InputTextLargeCalcCursorX(&g, doc, doc->Cursor);
+        const float cursor_y = doc->GetLineFromOffset(doc->Cursor) * line_height;
+        const float visible_width = inner_size.x - style.FramePadding.x * 2.0f;
+        const float visible_height = inner_size.y - style.FramePadding.y * 2.0f;
+        ImVec2 scroll = draw_window->Scroll;
+        if (cursor_x < scroll.x)
+            scroll.x = IM_TRUNC(ImMax(0.0f, cursor_x - visible_width * 0.25f));
+        else if (cursor_x >= scroll.x + visible_width)
+            scroll.x = IM_TRUNC(cursor_x - visible_width * 0.75f);
+        if (cursor_y < scroll.y)
+            scroll.y = cursor_y;
+        else if (cursor_y + line_height > scroll.y + visible_height)
+            scroll.y = cursor_y + line_height - visible_height;
+        scroll.y = ImClamp(scroll.y, 0.0f, ImMax(content_height - inner_size.y, 0.0f));
+        doc->MaxLineWidth = ImMax(doc->MaxLineWidth, cursor_x);
+        text_origin -= scroll - draw_window->Scroll;
+        draw_window->Scroll = scroll;
+        doc->CursorFollow = false;
+    }
+
+    // Fetch visible lines only
+    const ImRect clip_rect = draw_window->ClipRect;
+    const int line_first = ImClamp((int)ImFloor((clip_rect.Min.y - text_origin.y) / line_height), 0, line_count - 1);
+    const int line_last = ImClamp((int)ImFloor((clip_rect.Max.y - text_origin.y) / line_height), line_first, line_count - 1);
+    const int block_start = doc->GetLineStart(line_first);
+    doc->TempBuf.resize(0);
+    doc->GetText(block_start, doc->GetLineEnd(line_last) - block_start, &doc->TempBuf);
+
+    // Render selection, text and cursor
+    const bool render_cursor = (g.ActiveId == id);
+    const int sel_min = ImMin(doc->Cursor, doc->SelectStart);
+    const int sel_max = ImMax(doc->Cursor, doc->SelectStart);
+    const ImU32 text_col = GetColorU32(ImGuiCol_Text);
+    const ImU32 sel_col = GetColorU32(ImGuiCol_TextSelectedBg, render_cursor ? 1.0f : 0.6f);
+    const char* block_begin = doc->TempBuf.begin();
+    const char* block_end = doc->TempBuf.end();
+    const char* line_begin = block_begin;
+    for (int line_no = line_first; line_no <= line_last; line_no++)
+    {
+        const char* line_end = (const char*)ImMemchr(line_begin, '\n', (size_t)(block_end - line_begin));
+        if (line_end == NULL)
+            line_end = block_end;
+        const int line_start_offset = block_start + (int)(line_begin - block_begin);
+        const int line_end_offset = block_start + (int)(line_end - block_begin);
+        const ImVec2 line_pos(text_origin.x, text_origin.y + line_no * line_height);
+
+        if (sel_min != sel_max && sel_min <= line_end_offset && sel_max > line_start_offset)
+        {
+            const char* sel_begin = line_begin + ImMax(sel_min - line_start_offset, 0);
+            const char* sel_end = line_begin + ImMin(sel_max - line_start_offset, (int)(line_end - line_begin));
+            const float sel_x0 = InputTextCalcTextSize(&g, line_begin, sel_begin).x;
+            float sel_x1 = sel_x0 + InputTextCalcTextSize(&g, sel_begin, sel_end).x;
+            if (sel_max > line_end_offset)
+                sel_x1 += IM_TRUNC(g.Font->GetCharAdvance((ImWchar)' ') * 0.50f); // So we can see selected line breaks
+            draw_window->DrawList->AddRectFilled(ImVec2(line_pos.x + sel_x0, line_pos.y), ImVec2(line_pos.x + sel_x1, line_pos.y + line_height), sel_col);
+        }
+
+        draw_window->DrawList->AddText(g.Font, g.FontSize, line_pos, text_col, line_begin, line_end);
+        doc->MaxLineWidth = ImMax(doc->MaxLineWidth, InputTextCalcTextSize(&g, line_begin, line_end).x);
+
+        if (render_cursor && doc->Cursor >= line_start_offset && doc->Cursor <= line_end_offset)
+        {
+            doc->CursorAnim += io.DeltaTime;
+            const bool cursor_is_visible = (!g.IO.ConfigInputTextCursorBlink) || (doc->CursorAnim <= 0.0f) || ImFmod(doc->CursorAnim, 1.20f) <= 0.80f;
+            const ImVec2 cursor_screen_pos = ImTrunc(ImVec2(line_pos.x + InputTextCalcTextSize(&g, line_begin, line_begin + (doc->Cursor - line_start_offset)).x, line_pos.y));
+            if (cursor_is_visible)
+                draw_window->DrawList->AddLine(ImVec2(cursor_screen_pos.x, cursor_screen_pos.y + 0.5f), ImVec2(cursor_screen_pos.x, cursor_screen_pos.y + line_height - 1.5f), text_col);
+            if (!is_readonly)
+            {
+                g.PlatformImeData.WantVisible = true;
+                g.PlatformImeData.InputPos = ImVec2(cursor_screen_pos.x - 1.0f, cursor_screen_pos.y);
+                g.PlatformImeData.InputLineHeight = line_height;
+            }
+        }
+        line_begin = line_end + 1;
+    }
+
+    if (g.ActiveId == id)
+        g.WantTextInputNextFrame = 1;
+
+    // Declare contents size. Width only grows as wider lines get displayed: we never measure the whole document.
+    Dummy(ImVec2(doc->MaxLineWidth + style.FramePadding.x * 2.0f + 1.0f, content_height));
+    g.NextItemData.ItemFlags |= (ImGuiItemFlags)ImGuiItemFlags_Inputable | ImGuiItemFlags_NoTabStop;
+    EndChild();
+    item_data_backup.StatusFlags |= (g.LastItemData.StatusFlags & ImGuiItemStatusFlags_HoveredWindow);
+    EndGroup();
+    if (g.LastItemData.ID == 0 || g.LastItemData.ID != GetWindowScrollbarID(draw_window, ImGuiAxis_Y))
+    {
+        g.LastItemData.ID = id;
+        g.LastItemData.ItemFlags = item_data_backup.ItemFlags;
+        g.LastItemData.StatusFlags = item_data_backup.StatusFlags;
+    }
+
+    if (label_size.x > 0)
+        RenderText(ImVec2(frame_bb.Max.x + style.ItemInnerSpacing.x, frame_bb.Min.y + style.FramePadding.y), label);
+
+    if (value_changed)
+        MarkItemEdited(id);
+
+    IMGUI_TEST_ENGINE_ITEM_INFO(id, label, g.LastItemData.StatusFlags | ImGuiItemStatusFlags_Inputable);
+    return value_changed;
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ColorEdit, ColorPicker, ColorButton, etc.
 //-------------------------------------------------------------------------
@@ -6395,6 +7359,8 @@ void ImGui::ColorPickerOptionsPopup(const float* ref_col, ImGuiColorEditFlags fl
 // - GetTreeNodeToLabelSpacing()
 // - SetNextItemOpen()
 // - CollapsingHeader()
+// - TreeViewNode()
+// - ImGuiTreeView
 //-------------------------------------------------------------------------
 
 bool ImGui::TreeNode(const char* str_id, const char* fmt, ...)
@@ -6510,7 +7476,12 @@ bool ImGui::TreeNodeUpdateNextOpen(ImGuiID storage_id, ImGuiTreeNodeFlags flags)
     ImGuiStorage* storage = window->DC.StateStorage;
 
     bool is_open;
-    if (g.NextItemData.HasFlags & ImGuiNextItemDataFlags_HasOpen)
+    if (flags & ImGuiTreeNodeFlags_NoStoreOpen)
+    {
+        IM_ASSERT((g.NextItemData.HasFlags & ImGuiNextItemDataFlags_HasOpen) && "ImGuiTreeNodeFlags_NoStoreOpen requires calling SetNextItemOpen()!");
+        is_open = g.NextItemData.OpenVal;
+    }
+    else if (g.NextItemData.HasFlags & ImGuiNextItemDataFlags_HasOpen)
     {
         if (g.NextItemData.OpenCond & ImGuiCond_Always)
         {
@@ -6747,7 +7718,8 @@ bool ImGui::TreeNodeBehavior(ImGuiID id, ImGuiTreeNodeFlags flags, const char* l
         if (toggled)
         {
             is_open = !is_open;
-            window->DC.StateStorage->SetInt(storage_id, is_open);
+            if (!(flags & ImGuiTreeNodeFlags_NoStoreOpen))
+                window->DC.StateStorage->SetInt(storage_id, is_open);
             g.LastItemData.StatusFlags |= ImGuiItemStatusFlags_ToggledOpen;
         }
     }
@@ -6954,6 +7926,178 @@ bool ImGui::CollapsingHeader(const char* label, bool* p_visible, ImGuiTreeNodeFl
     return is_open;
 }
 
+// Open state is read from and written to 'tree', toggling a node is applied to tree->Rows[] on next tree->UpdateRows() call.
+// Node index is used as identifier, so nodes keep their ID (for focus, nav, active state) when rows above them are opened/closed.
+bool ImGui::TreeViewNode(ImGuiTreeView* tree, int row_n, const char* label, ImGuiTreeNodeFlags flags)
+{
+    ImGuiWindow* window = GetCurrentWindow();
+    if (window->SkipItems)
+        return false;
+
+    ImGuiContext& g = *GImGui;
+    const int node_n = tree->Rows[row_n];
+    ImGuiTreeViewNode* node = &tree->Nodes[node_n];
+    const float indent = node->Depth * g.Style.IndentSpacing;
+    if (indent > 0.0f)
+        Indent(indent);
+    if (node->FirstChild == -1)
+        flags |= ImGuiTreeNodeFlags_Leaf;
+    flags |= ImGuiTreeNodeFlags_NoTreePushOnOpen | ImGuiTreeNodeFlags_NoStoreOpen;
+    SetNextItemOpen(node->Open);
+    const bool is_open = TreeNodeBehavior(window->GetID((void*)(intptr_t)node_n), flags, label);
+    if ((g.LastItemData.StatusFlags & ImGuiItemStatusFlags_ToggledOpen) && node->FirstChild != -1)
+    {
+        node->Open = is_open;
+        tree->_ToggledRows.push_back(row_n);
+    }
+    if (indent > 0.0f)
+        Unindent(indent);
+    return is_open;
+}
+
+ImGuiTreeView::ImGuiTreeView()
+{
+    _FirstRoot = _LastRoot = -1;
+    _RowsDirty = false;
+}
+
+void ImGuiTreeView::Clear()
+{
+    Nodes.clear();
+    Rows.clear();
+    _FirstRoot = _LastRoot = -1;
+    _RowsDirty = false;
+    _ToggledRows.clear();
+    _TempRows.clear();
+}
+
+int ImGuiTreeView::AddNode(int parent)
+{
+    IM_ASSERT(parent >= -1 && parent < Nodes.Size);
+    const int node_n = Nodes.Size;
+    ImGuiTreeViewNode node;
+    node.Parent = parent;
+    node.FirstChild = node.LastChild = node.NextSibling = -1;
+    node.Depth = (parent != -1) ? Nodes[parent].Depth + 1 : 0;
+    node.Open = false;
+    Nodes.push_back(node);
+    int* p_last = (parent != -1) ? &Nodes[parent].LastChild : &_LastRoot;
+    if (*p_last != -1)
+        Nodes[*p_last].NextSibling = node_n;
+    else if (parent != -1)
+        Nodes[parent].FirstChild = node_n;
+    else
+        _FirstRoot = node_n;
+    *p_last = node_n;
+    _RowsDirty = true;
+    return node_n;
+}
+
+void ImGuiTreeView::SetNodeOpen(int node_n, bool open)
+{
+    if (Nodes[node_n].Open == open)
+        return;
+    Nodes[node_n].Open = open;
+    if (_RowsDirty || Nodes[node_n].FirstChild == -1)
+        return;
+    const int row_n = FindNodeRow(node_n);
+    if (row_n != -1)
+        _ToggledRows.push_back(row_n);
+}
+
+void ImGuiTreeView::SetAllNodesOpen(bool open)
+{
+    for (ImGuiTreeViewNode& node : Nodes)
+        node.Open = open;
+    _RowsDirty = true;
+}
+
+int ImGuiTreeView::FindNodeRow(int node_n) const
+{
+    IM_ASSERT(!_RowsDirty && "Call UpdateRows() first!");
+    if (_ToggledRows.Size == 0) // Otherwise Rows[] doesn't match open state of ancestors yet
+        for (int parent = Nodes[node_n].Parent; parent != -1; parent = Nodes[parent].Parent)
+            if (!Nodes[parent].Open)
+                return -1;
+    for (int row_n = 0; row_n < Rows.Size; row_n++)
+        if (Rows.Data[row_n] == node_n)
+            return row_n;
+    return -1;
+}
+
+// Append nodes of sibling list starting at 'first', followed each by their visible descendants. 'parent' is their parent (-1 for roots).
+static void ImGuiTreeView_AppendVisibleNodes(const ImGuiTreeViewNode* nodes, int first, int parent, ImVector<int>* out)
+{
+    int node_n = first;
+    while (node_n != -1)
+    {
+        out->push_back(node_n);
+        if (nodes[node_n].Open && nodes[node_n].FirstChild != -1)
+        {
+            node_n = nodes[node_n].FirstChild;
+            continue;
+        }
+        while (nodes[node_n].NextSibling == -1)
+        {
+            node_n = nodes[node_n].Parent;
+            if (node_n == parent)
+                return;
+        }
+        node_n = nodes[node_n].NextSibling;
+    }
+}
+
+static int IMGUI_CDECL ImGuiTreeView_CompareRowsDescending(const void* lhs, const void* rhs)
+{
+    const int a = *(const int*)lhs;
+    const int b = *(const int*)rhs;
+    return (a < b) ? +1 : (a > b) ? -1 : 0;
+}
+
+void ImGuiTreeView::UpdateRows()
+{
+    if (_RowsDirty)
+    {
+        Rows.resize(0);
+        ImGuiTreeView_AppendVisibleNodes(Nodes.Data, _FirstRoot, -1, &Rows);
+        _RowsDirty = false;
+        _ToggledRows.resize(0);
+        return;
+    }
+
+    // Rows were recorded before any change: apply from the bottom up so that rows above stay valid.
+    // A node is currently expanded if the next row is deeper, which also makes applying the same row twice harmless.
+    if (_ToggledRows.Size > 1)
+        ImQsort(_ToggledRows.Data, (size_t)_ToggledRows.Size, sizeof(int), ImGuiTreeView_CompareRowsDescending);
+    for (int row_n : _ToggledRows)
+    {
+        const int node_n = Rows[row_n];
+        const ImGuiTreeViewNode& node = Nodes[node_n];
+        const bool was_expanded = (row_n + 1 < Rows.Size) && Nodes[Rows[row_n + 1]].Depth > node.Depth;
+        const bool expanded = node.Open && node.FirstChild != -1;
+        if (expanded == was_expanded)
+            continue;
+        if (expanded)
+        {
+            _TempRows.resize(0);
+            ImGuiTreeView_AppendVisibleNodes(Nodes.Data, node.FirstChild, node_n, &_TempRows);
+            const int tail_count = Rows.Size - (row_n + 1);
+            Rows.resize(Rows.Size + _TempRows.Size);
+            memmove(Rows.Data + row_n + 1 + _TempRows.Size, Rows.Data + row_n + 1, (size_t)tail_count * sizeof(int));
+            memcpy(Rows.Data + row_n + 1, _TempRows.Data, (size_t)_TempRows.Size * sizeof(int));
+        }
+        else
+        {
+            int row_end = row_n + 1;
+            while (row_end < Rows.Size && Nodes[Rows.Data[row_end]].Depth > node.Depth)
+                row_end++;
+            memmove(Rows.Data + row_n + 1, Rows.Data + row_end, (size_t)(Rows.Size - row_end) * sizeof(int));
+            Rows.resize(Rows.Size - (row_end - row_n - 1));
+        }
+    }
+    _ToggledRows.resize(0);
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: Selectable
 //-------------------------------------------------------------------------
@@ -8093,6 +9237,7 @@ void ImGui::DebugNodeMultiSelectState(ImGuiMultiSelectState* storage)
 //-------------------------------------------------------------------------
 // - ImGuiSelectionBasicStorage
 // - ImGuiSelectionExternalStorage
+// - ImGuiSelectionRangeStorage
 //-------------------------------------------------------------------------
 
 ImGuiSelectionBasicStorage::ImGuiSelectionBasicStorage()
@@ -8108,7 +9253,7 @@ void ImGuiSelectionBasicStorage::Clear()
 {
     Size = 0;
     _SelectionOrder = 1; // Always >0
-    _Storage.Data.resize(0);
+    _Storage.Clear();
 }
 
 void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
@@ -8116,6 +9261,9 @@ void ImGuiSelectionBasicStorage::Swap(ImGuiSelectionBasicStorage& r)
     ImSwap(Size, r.Size);
     ImSwap(_SelectionOrder, r._SelectionOrder);
     _Storage.Data.swap(r._Storage.Data);
+#ifdef IMGUI_USE_HASHED_STORAGE
+    _Storage.Slots.swap(r._Storage.Slots);
+#endif
 }
 
 bool ImGuiSelectionBasicStorage::Contains(ImGuiID id) const
@@ -8163,8 +9311,14 @@ void ImGuiSelectionBasicStorage::SetItemSelected(ImGuiID id, bool selected)
 static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicStorage* selection, ImGuiID id, bool selected, int size_before_amends, int selection_order)
 {
     ImGuiStorage* storage = &selection->_Storage;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    IM_UNUSED(size_before_amends);
+    ImGuiStoragePair* it = storage->GetPair(id); // Pairs appended during this batch are not indexed until BuildSortByKey(), same as with the sorted range below.
+    const bool is_contained = (it != NULL);
+#else
     ImGuiStoragePair* it = ImLowerBound(storage->Data.Data, storage->Data.Data + size_before_amends, id);
     const bool is_contained = (it != storage->Data.Data + size_before_amends) && (it->key == id);
+#endif
     if (selected == (is_contained && it->val_i != 0))
         return;
     if (selected && !is_contained)
@@ -8177,7 +9331,7 @@ static void ImGuiSelectionBasicStorage_BatchSetItemSelected(ImGuiSelectionBasicS
 static void ImGuiSelectionBasicStorage_BatchFinish(ImGuiSelectionBasicStorage* selection, bool selected, int size_before_amends)
 {
     ImGuiStorage* storage = &selection->_Storage;
-    if (selected && selection->Size != size_before_amends)
+    if (selected && storage->Data.Size != size_before_amends)
         storage->BuildSortByKey(); // When done selecting: sort everything
 }
 
@@ -8280,6 +9434,196 @@ void ImGuiSelectionExternalStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
     }
 }
 
+//-------------------------------------------------------------------------
+
+ImGuiSelectionRangeStorage::ImGuiSelectionRangeStorage()
+{
+    Size = 0;
+}
+
+void ImGuiSelectionRangeStorage::Clear()
+{
+    Size = 0;
+    _Ranges.clear();
+    _Bits.clear();
+}
+
+void ImGuiSelectionRangeStorage::Swap(ImGuiSelectionRangeStorage& r)
+{
+    ImSwap(Size, r.Size);
+    _Ranges.swap(r._Ranges);
+    _Bits.swap(r._Bits);
+}
+
+// Return index of first boundary > idx. An item is selected when an odd number of boundaries are <= its index.
+static int ImGuiSelectionRangeStorage_UpperBound(const ImVector<int>& ranges, int idx)
+{
+    int first = 0;
+    int count = ranges.Size;
+    while (count > 0)
+    {
+        const int step = count >> 1;
+        if (ranges.Data[first + step] <= idx)
+        {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else
+        {
+            count = step;
+        }
+    }
+    return first;
+}
+
+static inline int ImGuiSelectionRangeStorage_CountBits(ImU32 v)
+{
+    v = v - ((v >> 1) & 0x55555555);
+    v = (v & 0x33333333) + ((v >> 2) & 0x33333333);
+    return (int)((((v + (v >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24);
+}
+
+bool ImGuiSelectionRangeStorage::Contains(int idx) const
+{
+    if (_Bits.Size > 0)
+        return idx >= 0 && idx < (_Bits.Size << 5) && IM_BITARRAY_TESTBIT(_Bits.Data, idx);
+    return (ImGuiSelectionRangeStorage_UpperBound(_Ranges, idx) & 1) != 0;
+}
+
+void ImGuiSelectionRangeStorage::SetRangeSelected(int idx_first, int idx_last, bool selected)
+{
+    IM_ASSERT(idx_first >= 0 && idx_first <= idx_last && idx_last < IM_S32_MAX);
+    const int a = idx_first;
+    int b = idx_last + 1;
+
+    if (_Bits.Size > 0)
+    {
+        // Bit array: update one word at a time, counting bits which changed.
+        if (b > (_Bits.Size << 5))
+        {
+            if (selected)
+                _Bits.resize((b + 31) >> 5, 0);
+            else
+                b = _Bits.Size << 5;
+        }
+        int changes = 0;
+        for (int n = a; n < b; n = (n + 32) & ~31)
+        {
+            const int a_mod = (n & 31);
+            const int b_mod = (b - 1 > (n | 31) ? 31 : ((b - 1) & 31)) + 1;
+            const ImU32 mask = (ImU32)(((ImU64)1 << b_mod) - 1) & ~(ImU32)(((ImU64)1 << a_mod) - 1);
+            ImU32* word = &_Bits.Data[n >> 5];
+            const ImU32 changed = selected ? (mask & ~*word) : (mask & *word);
+            changes += ImGuiSelectionRangeStorage_CountBits(changed);
+            *word ^= changed;
+        }
+        Size += selected ? changes : -changes;
+        if (Size == 0)
+            Clear(); // Back to ranges
+        return;
+    }
+
+    // Ranges: replace boundaries within [a..b] with the ones needed for [a..b) to have the requested state, leaving other items unchanged.
+    const int lo = ImGuiSelectionRangeStorage_UpperBound(_Ranges, a - 1); // First boundary >= a
+    const int hi = ImGuiSelectionRangeStorage_UpperBound(_Ranges, b);     // First boundary > b
+    const bool selected_before = (lo & 1) != 0;                           // State of item a - 1
+    const bool selected_after = (hi & 1) != 0;                            // State of item b
+
+    // Count items of [a..b) currently selected, to maintain Size
+    int selected_count = 0;
+    int pos = a;
+    bool pos_selected = selected_before;
+    for (int n = lo; n < hi; n++)
+    {
+        if (pos_selected)
+            selected_count += _Ranges.Data[n] - pos;
+        pos = _Ranges.Data[n];
+        pos_selected = !pos_selected;
+    }
+    if (pos_selected)
+        selected_count += b - pos;
+    Size += selected ? (b - a) - selected_count : -selected_count;
+
+    int new_boundaries[2];
+    int new_count = 0;
+    if (selected != selected_before)
+        new_boundaries[new_count++] = a;
+    if (selected != selected_after)
+        new_boundaries[new_count++] = b;
+    const int old_count = hi - lo;
+    const int tail_count = _Ranges.Size - hi;
+    if (new_count > old_count)
+        _Ranges.resize(_Ranges.Size + new_count - old_count);
+    if (new_count != old_count)
+        memmove(_Ranges.Data + lo + new_count, _Ranges.Data + hi, (size_t)tail_count * sizeof(int));
+    if (new_count < old_count)
+        _Ranges.resize(_Ranges.Size + new_count - old_count);
+    for (int n = 0; n < new_count; n++)
+        _Ranges.Data[lo + n] = new_boundaries[n];
+
+    // Switch to a bit array when ranges use more memory than it would (4 bytes per boundary vs 1 bit per item).
+    // We only switch back on Clear(), so selection doesn't flip between both when Ctrl+Clicking around the threshold.
+    if (_Ranges.Size > 64 && _Ranges.Size > _Ranges.back() / 32)
+    {
+        _Bits.resize((_Ranges.back() + 31) >> 5, 0);
+        for (int n = 0; n < _Ranges.Size; n += 2)
+            ImBitArraySetBitRange(_Bits.Data, _Ranges.Data[n], _Ranges.Data[n + 1]);
+        _Ranges.clear();
+    }
+}
+
+// Iterator stores the next index to look at.
+bool ImGuiSelectionRangeStorage::GetNextSelectedItem(void** opaque_it, int* out_idx)
+{
+    int idx = (int)(intptr_t)*opaque_it;
+    bool has_more = false;
+    if (_Bits.Size > 0)
+    {
+        int word_n = idx >> 5;
+        if (word_n < _Bits.Size)
+        {
+            ImU32 word = _Bits.Data[word_n] & ~(ImU32)(((ImU64)1 << (idx & 31)) - 1);
+            while (word == 0 && ++word_n < _Bits.Size)
+                word = _Bits.Data[word_n];
+            if (word != 0)
+            {
+                idx = (word_n << 5) + ImGuiSelectionRangeStorage_CountBits((word & (~word + 1)) - 1); // Lowest bit set
+                has_more = true;
+            }
+        }
+    }
+    else
+    {
+        const int n = ImGuiSelectionRangeStorage_UpperBound(_Ranges, idx);
+        if ((n & 1) == 0 && n < _Ranges.Size)
+            idx = _Ranges.Data[n]; // Start of next range
+        has_more = (n & 1) != 0 || n < _Ranges.Size;
+    }
+    *opaque_it = has_more ? (void*)(intptr_t)(idx + 1) : *opaque_it;
+    *out_idx = has_more ? idx : 0;
+    return has_more;
+}
+
+// Apply requests coming from BeginMultiSelect() and EndMultiSelect().
+// Items are identified by the index passed to SetNextItemSelectionUserData(), e.g. their index in a ImGuiListClipper loop.
+void ImGuiSelectionRangeStorage::ApplyRequests(ImGuiMultiSelectIO* ms_io)
+{
+    IM_ASSERT(ms_io->ItemsCount != -1 && "Missing value for items_count in BeginMultiSelect() call!");
+    for (ImGuiSelectionRequest& req : ms_io->Requests)
+    {
+        if (req.Type == ImGuiSelectionRequestType_SetAll)
+        {
+            Clear();
+            if (req.Selected && ms_io->ItemsCount > 0)
+                SetRangeSelected(0, ms_io->ItemsCount - 1, true);
+        }
+        else if (req.Type == ImGuiSelectionRequestType_SetRange)
+        {
+            SetRangeSelected((int)req.RangeFirstItem, (int)req.RangeLastItem, req.Selected);
+        }
+    }
+}
+
 //-------------------------------------------------------------------------
 // [SECTION] Widgets: ListBox
 //-------------------------------------------------------------------------
@@ -7,6 +7,9 @@
 #include "imgui/imgui.h"
 #include "imgui/imgui_impl_glfw.h"
 #include "imgui/imgui_impl_opengl3.h"
+#include "imgui/imgui_allocator.h"
+#include "imgui/imgui_remote.h"
+#include "imgui/imgui_impl_softraster.h"
 
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
@@ -20,6 +23,11 @@
 #define _USE_MATH_DEFINES
 #include <cmath>
 #include <cstddef>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
@@ -75,6 +83,104 @@ float cameraZoom = 1.0f;
 bool isDragging = false;
 double lastMouseX = 0.0, lastMouseY = 0.0;
 
+// Input latency probe: age of the oldest camera input when the frame showing it is swapped
+const int LATENCY_SAMPLES = 256;
+float latencySamples[LATENCY_SAMPLES] = {};
+int latencySampleCount = 0, latencySampleIdx = 0;
+double cameraInputTime = -1.0;   // glfwGetTime() in the GLFW callback of the oldest camera input not yet drawn, -1 if none
+bool lateLatchCamera = true;     // Sample the cursor again right before drawing the scene
+bool latencyFinishAfterSwap = false;
+
+// Power saving: wait for events instead of redrawing at vsync rate while nothing changes
+const double REDRAW_GRACE_TIME = 0.5;      // Keep drawing after an event, to let ImGui hover delays and fades complete
+const double TEXT_CURSOR_BLINK_TIME = 0.2; // Wake-up interval while a text field is active
+bool powerSaveMode = false;
+double redrawUntil = 0.0;
+std::atomic<bool> redrawRequested(true);
+bool windowIconified = false;
+int framesRendered = 0, framesSkipped = 0; // framesSkipped counts display refreshes spent waiting
+int displayRefreshRate = 60;
+
+// Control Panel drawn from a cached texture while not hovered (ImGuiWindowFlags_CachedRender).
+// Live readouts refresh at a few Hz, as a window whose contents change every frame can't be cached.
+const double PERF_READOUT_INTERVAL = 0.5;
+bool cacheControlPanel = true;
+double perfReadoutTime = -1.0;
+float perfFramerate = 0.0f;
+int perfFramesRendered = 0, perfFramesSkipped = 0;
+ImGui_ImplOpenGL3_RenderCacheStats perfCacheStats = {};
+ImGui_ImplOpenGL3_UploadStats perfUploadStats = {};
+
+// Remote viewing: the UI draw data is streamed to instances started with "--remote-view <address>", which display it instead of running the application
+const char* REMOTE_VIEW_ARG = "--remote-view";
+const double REMOTE_ACCEPT_INTERVAL = 0.25;     // Power saving: wake-up interval to accept viewers while none is connected
+const double REMOTE_VIEW_POLL_INTERVAL = 0.004; // Viewer: socket polling interval while waiting for events
+const double REMOTE_RECONNECT_INTERVAL = 1.0;
+bool remoteStreaming = false;
+bool remoteListenFailed = false;
+char remoteAddress[128] = "127.0.0.1:7070";
+ImGuiRemoteServer remoteServer;
+double remoteReadoutTime = -1.0;
+ImGuiRemoteStats remoteReadoutStats = {};
+int remoteReadoutFramesDropped = 0;
+
+// UI recording: draw data written to a file, replayed at maximum rate with "--replay <file>" to benchmark the renderer on identical frames
+const char* REPLAY_ARG = "--replay";
+const int REPLAY_LOOPS = 5; // The first loop warms up caches and isn't measured
+char uiRecordingFile[128] = "ui_recording.imrec";
+ImGuiRemoteRecorder uiRecorder;
+
+// Input macros: GLFW input events recorded with their frame index, replayed at a fixed timestep for reproducible performance runs.
+// Replay starts from the recorded window size, camera and ImGui window layout, and reports frame times and ImGui allocations.
+const char* REPLAY_INPUT_ARG = "--replay-input";
+const double INPUT_REPLAY_TIMESTEP = 1.0 / 60.0;
+enum class InputEventType { CURSOR_POS, MOUSE_BUTTON, SCROLL, KEY, CHAR };
+struct InputEvent {
+    int frame;          // Frames since the start of the recording
+    double time;        // Seconds since the start of the recording
+    InputEventType type;
+    double x, y;        // Cursor position, or scroll offsets
+    int code;           // Mouse button, key or character
+    int scancode, action, mods;
+};
+struct InputMacro {
+    std::vector<InputEvent> events;
+    int frames = 0;
+    int windowWidth = SCR_WIDTH, windowHeight = SCR_HEIGHT;
+    glm::vec2 cameraOffset = glm::vec2(0.0f, 0.0f);
+    float cameraZoom = 1.0f;
+    std::string imguiIni;
+};
+char inputMacroFile[128] = "input_macro.txt";
+InputMacro inputMacro;
+bool inputRecording = false, inputReplaying = false;
+bool inputReplayRequested = false; // Replay button: start before next frame
+bool exitAfterInputReplay = false;
+int inputMacroFrame = 0;            // Frames since the start of the recording or replay
+size_t inputReplayNext = 0;         // Next event to replay
+double inputMacroStartTime = 0.0;
+double inputReplayCursorX = 0.0, inputReplayCursorY = 0.0;
+double inputReplayFrameStart = 0.0;
+std::vector<float> inputReplayFrameTimes;
+std::vector<int> inputReplayFrameAllocs;
+int inputReplayAllocCount = 0;
+std::string inputReplayReport;
+
+// Headless dashboards: "--dashboards <count>" renders that many independent dashboards with the CPU rasterizer, each in its own ImGui context,
+// on 1, 2, 4... worker threads, and reports dashboards/second. Contexts share the font atlas, locked by the context owning it on the main thread.
+// Dashboard contents only depend on the dashboard id, so every thread count must produce the same pixels.
+// Worker threads need IMGUI_USE_THREAD_LOCAL_CONTEXT, only defined by the Dashboards build configuration so the interactive app doesn't pay for TLS accesses.
+const char* DASHBOARDS_ARG = "--dashboards";
+const int DASHBOARD_WIDTH = 1280, DASHBOARD_HEIGHT = 720;
+const int DASHBOARD_LAYOUT_FRAMES = 2; // Frames submitted before the rasterized one, so auto-sized windows and tables settle
+const int DASHBOARD_SERIES_SIZE = 120;
+struct Dashboard {
+    int id = 0;
+    unsigned long long checksum = 0;
+};
+
+ImGuiPoolAllocator imguiAllocator;
+
 void checkCompileErrors(GLuint shader, std::string type) {
     GLint success;
     GLchar infoLog[1024];
@@ -273,6 +379,389 @@ void setupCircle(int numSegments) {
     glBindBuffer(GL_ARRAY_BUFFER, 0); glBindVertexArray(0);
 }
 
+// Thread-safe: call from any thread when data shown on screen changed
+void requestRedraw() {
+    redrawRequested = true;
+    glfwPostEmptyEvent();
+}
+
+// Replaces glfwPollEvents(). Returns false when there is nothing new to draw.
+bool pollOrWaitEvents() {
+    if (!powerSaveMode || inputReplaying) { glfwPollEvents(); return true; }
+    double now = glfwGetTime();
+    bool timedRedraw = false;
+    if (now < redrawUntil && !windowIconified) {
+        glfwPollEvents();
+    }
+    else {
+        bool blink = ImGui::GetIO().WantTextInput && !windowIconified;
+        bool acceptViewer = remoteStreaming && !remoteServer.IsClientConnected();
+        if (blink || acceptViewer) glfwWaitEventsTimeout(blink ? TEXT_CURSOR_BLINK_TIME : REMOTE_ACCEPT_INTERVAL); else glfwWaitEvents();
+        double waited = glfwGetTime() - now;
+        framesSkipped += static_cast<int>(waited * displayRefreshRate);
+        timedRedraw = blink && waited >= TEXT_CURSOR_BLINK_TIME;
+    }
+    if (remoteStreaming && remoteServer.AcceptClient()) redrawRequested = true; // A new viewer needs a frame
+    if (redrawRequested.exchange(false)) redrawUntil = glfwGetTime() + REDRAW_GRACE_TIME;
+    return !windowIconified && (timedRedraw || glfwGetTime() < redrawUntil);
+}
+
+void setRemoteStreaming(bool enable) {
+    remoteStreaming = enable && remoteServer.Listen(remoteAddress);
+    remoteListenFailed = enable && !remoteStreaming;
+    if (remoteListenFailed) std::cerr << "Failed to listen for remote viewers on " << remoteAddress << std::endl;
+    if (!remoteStreaming) remoteServer.Close();
+}
+
+void showRemoteStreaming() {
+    ImGui::BeginDisabled(remoteStreaming);
+    ImGui::InputText("Address", remoteAddress, IM_ARRAYSIZE(remoteAddress));
+    ImGui::EndDisabled();
+    bool enable = remoteStreaming;
+    if (ImGui::Checkbox("Stream UI to remote viewers", &enable)) setRemoteStreaming(enable);
+    if (remoteListenFailed) { ImGui::SameLine(); ImGui::TextColored(ImVec4(1, 0, 0, 1), " (Failed to listen!)"); }
+    if (!remoteStreaming) { ImGui::TextDisabled("View with: OpenGL %s <address>", REMOTE_VIEW_ARG); return; }
+    if (!remoteServer.IsClientConnected()) { ImGui::Text("Waiting for a viewer..."); return; }
+    double now = glfwGetTime();
+    if (remoteReadoutTime < 0.0 || now - remoteReadoutTime >= PERF_READOUT_INTERVAL) {
+        remoteReadoutTime = now;
+        remoteReadoutStats = remoteServer.Encoder.Stats;
+        remoteReadoutFramesDropped = remoteServer.FramesDropped;
+    }
+    ImGui::Text("Viewer connected: %.2f KB/frame (%.1f KB before encoding), %d/%d lists changed", remoteReadoutStats.FrameBytes / 1024.0f,
+        remoteReadoutStats.FrameRawBytes / 1024.0f, remoteReadoutStats.FrameListsChanged, remoteReadoutStats.FrameListsChanged + remoteReadoutStats.FrameListsUnchanged);
+    ImGui::Text("Encode: %.3f ms/frame, frames dropped: %d", remoteReadoutStats.FrameTime * 1000.0, remoteReadoutFramesDropped);
+}
+
+ImTextureID createRemoteTexture(const ImU32* pixels, int width, int height, void*) {
+    GLuint texture = 0;
+    glGenTextures(1, &texture);
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return (ImTextureID)texture;
+}
+
+void destroyRemoteTexture(ImTextureID texId, void*) {
+    GLuint texture = (GLuint)texId;
+    glDeleteTextures(1, &texture);
+}
+
+// Viewer mode: display the UI streamed by another instance. The window follows the streamed display size.
+void runRemoteViewer(const char* address) {
+    ImGuiRemoteClient client;
+    client.Decoder.CreateTextureFunc = createRemoteTexture;
+    client.Decoder.DestroyTextureFunc = destroyRemoteTexture;
+    glfwSetWindowTitle(window, (std::string(WINDOW_TITLE) + " - remote view of " + address).c_str());
+    double nextConnectTime = 0.0;
+    while (!glfwWindowShouldClose(window)) {
+        glfwWaitEventsTimeout(REMOTE_VIEW_POLL_INTERVAL);
+        double now = glfwGetTime();
+        if (!client.IsConnected() && now >= nextConnectTime) {
+            nextConnectTime = now + REMOTE_RECONNECT_INTERVAL;
+            if (client.Connect(address)) std::cout << "Connected to " << address << std::endl;
+        }
+        bool newFrame = client.Poll();
+        if (!newFrame && !redrawRequested.exchange(false)) continue;
+
+        ImDrawData* drawData = client.Decoder.GetDrawData();
+        int windowW, windowH;
+        glfwGetWindowSize(window, &windowW, &windowH);
+        if (client.Decoder.HasFrame() && (windowW != (int)drawData->DisplaySize.x || windowH != (int)drawData->DisplaySize.y))
+            glfwSetWindowSize(window, (int)drawData->DisplaySize.x, (int)drawData->DisplaySize.y);
+        int display_w, display_h;
+        glfwGetFramebufferSize(window, &display_w, &display_h);
+        glViewport(0, 0, display_w, display_h);
+        glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+        glClear(GL_COLOR_BUFFER_BIT);
+        if (client.Decoder.HasFrame()) {
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
+        }
+        glfwSwapBuffers(window);
+    }
+    client.Close();
+    client.Decoder.Clear();
+}
+
+void showUiRecording() {
+    ImGui::BeginDisabled(uiRecorder.IsRecording());
+    ImGui::InputText("File", uiRecordingFile, IM_ARRAYSIZE(uiRecordingFile));
+    ImGui::EndDisabled();
+    if (!uiRecorder.IsRecording()) {
+        if (ImGui::Button("Start Recording") && !uiRecorder.Open(uiRecordingFile))
+            std::cerr << "Failed to create UI recording: " << uiRecordingFile << std::endl;
+        ImGui::TextDisabled("Replay with: OpenGL %s <file>", REPLAY_ARG);
+        return;
+    }
+    if (ImGui::Button("Stop Recording")) { uiRecorder.Close(); return; }
+    ImGui::SameLine(); ImGui::Text("%d frames recorded", uiRecorder.FramesRecorded);
+}
+
+// Replay mode: render a UI recording offscreen at maximum rate, then report CPU cost and OpenGL calls per frame, and a checksum of the rendered frames
+int runReplayBenchmark(const char* filename) {
+    ImGuiRemotePlayer player;
+    player.Decoder.CreateTextureFunc = createRemoteTexture;
+    player.Decoder.DestroyTextureFunc = destroyRemoteTexture;
+    if (!player.Load(filename)) { std::cerr << "Failed to load UI recording: " << filename << std::endl; return -1; }
+    glfwSetWindowTitle(window, (std::string(WINDOW_TITLE) + " - replaying " + filename).c_str());
+    glfwSwapInterval(0);
+
+    GLuint framebuffer = 0, colorTexture = 0;
+    int fbWidth = 0, fbHeight = 0;
+    std::vector<unsigned char> pixels;
+    std::vector<double> frameTimes;
+    ImGui_ImplOpenGL3_CallStats calls = {}, callsTotal = {};
+    unsigned long long firstChecksum = 0;
+    bool checksumsMatch = true;
+    for (int loop = 0; loop < REPLAY_LOOPS && !glfwWindowShouldClose(window); loop++) {
+        unsigned long long checksum = 14695981039346656037ull; // FNV-1a over the pixels of all frames
+        while (player.NextFrame()) {
+            ImDrawData* drawData = player.Decoder.GetDrawData();
+            int width = (int)(drawData->DisplaySize.x * drawData->FramebufferScale.x);
+            int height = (int)(drawData->DisplaySize.y * drawData->FramebufferScale.y);
+            if (width != fbWidth || height != fbHeight) {
+                fbWidth = width; fbHeight = height;
+                if (framebuffer) { glDeleteFramebuffers(1, &framebuffer); glDeleteTextures(1, &colorTexture); }
+                colorTexture = (GLuint)createRemoteTexture(nullptr, fbWidth, fbHeight, nullptr);
+                glGenFramebuffers(1, &framebuffer);
+                glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+                glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, colorTexture, 0);
+                pixels.resize((size_t)fbWidth * fbHeight * 4);
+            }
+            glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+            glViewport(0, 0, fbWidth, fbHeight);
+            glClearColor(clearColor[0], clearColor[1], clearColor[2], clearColor[3]);
+            glClear(GL_COLOR_BUFFER_BIT);
+            double start = glfwGetTime();
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplOpenGL3_RenderDrawData(drawData);
+            double cpuTime = glfwGetTime() - start;
+            ImGui_ImplOpenGL3_GetCallStats(&calls);
+            if (loop > 0) {
+                frameTimes.push_back(cpuTime * 1000.0);
+                callsTotal.FrameDrawCalls += calls.FrameDrawCalls;
+                callsTotal.FrameBufferUploads += calls.FrameBufferUploads;
+                callsTotal.FrameTextureBinds += calls.FrameTextureBinds;
+                callsTotal.FrameScissorCalls += calls.FrameScissorCalls;
+                callsTotal.FrameFramebufferBinds += calls.FrameFramebufferBinds;
+            }
+            glPixelStorei(GL_PACK_ALIGNMENT, 1);
+            glReadPixels(0, 0, fbWidth, fbHeight, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+            for (unsigned char byte : pixels) checksum = (checksum ^ byte) * 1099511628211ull;
+
+            int display_w, display_h;
+            glfwGetFramebufferSize(window, &display_w, &display_h);
+            glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+            glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+            glBlitFramebuffer(0, 0, fbWidth, fbHeight, 0, 0, display_w, display_h, GL_COLOR_BUFFER_BIT, GL_LINEAR);
+            glBindFramebuffer(GL_FRAMEBUFFER, 0);
+            glfwSwapBuffers(window);
+            glfwPollEvents();
+        }
+        if (!player.Decoder.HasFrame()) { std::cerr << "Invalid UI recording: " << filename << std::endl; break; }
+        if (loop == 0) firstChecksum = checksum;
+        else if (checksum != firstChecksum) checksumsMatch = false;
+    }
+    if (framebuffer) { glDeleteFramebuffers(1, &framebuffer); glDeleteTextures(1, &colorTexture); }
+    player.Clear();
+    if (frameTimes.empty()) return -1;
+
+    int frames = (int)frameTimes.size();
+    double sum = 0.0;
+    for (double t : frameTimes) sum += t;
+    std::sort(frameTimes.begin(), frameTimes.end());
+    char line[256];
+    snprintf(line, sizeof(line), "Replayed %s: %d frames x %d loops at %dx%d", filename, player.GetFrameCount(), REPLAY_LOOPS - 1, fbWidth, fbHeight);
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "CPU ms/frame: avg %.3f, p50 %.3f, p99 %.3f, max %.3f", sum / frames, frameTimes[frames / 2], frameTimes[frames * 99 / 100], frameTimes[frames - 1]);
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "GL calls/frame: %.1f draws, %.1f buffer uploads, %.1f texture binds, %.1f scissors, %.1f framebuffer binds",
+        (double)callsTotal.FrameDrawCalls / frames, (double)callsTotal.FrameBufferUploads / frames, (double)callsTotal.FrameTextureBinds / frames,
+        (double)callsTotal.FrameScissorCalls / frames, (double)callsTotal.FrameFramebufferBinds / frames);
+    std::cout << line << std::endl;
+    snprintf(line, sizeof(line), "Framebuffer checksum: %016llx (%s)", firstChecksum, checksumsMatch ? "identical on every loop" : "DIFFERS between loops");
+    std::cout << line << std::endl;
+    return checksumsMatch ? 0 : 1;
+}
+
+void addFonts(ImFontAtlas* atlas) {
+    static const ImWchar font_ranges[] = { 0x0020, 0x00FF, 0x0100, 0x017F, 0x00C7,0x00C7, 0x00E7,0x00E7, 0x00D6,0x00D6, 0x00F6,0x00F6, 0x00DC,0x00DC, 0x00FC,0x00FC, 0, };
+    const char* font_path = "C:/Windows/Fonts/Arial.ttf";
+    float font_size = 15.0f;
+    ImFont* font = atlas->AddFontFromFileTTF(font_path, font_size, nullptr, font_ranges);
+    if (!font) { std::cerr << "Warning: Failed to load font! -> " << font_path << std::endl; atlas->AddFontDefault(); }
+    else { std::cout << "Font loaded successfully: " << font_path << std::endl; }
+}
+
+void drawDashboard(const Dashboard& dashboard) {
+    float load[DASHBOARD_SERIES_SIZE], latency[DASHBOARD_SERIES_SIZE];
+    for (int n = 0; n < DASHBOARD_SERIES_SIZE; n++) {
+        load[n] = 0.5f + 0.4f * sinf(n * 0.11f + dashboard.id * 0.7f) * cosf(n * 0.023f + dashboard.id);
+        latency[n] = 20.0f + 15.0f * fabsf(sinf(n * 0.31f + dashboard.id * 1.3f));
+    }
+
+    ImGui::SetNextWindowPos(ImVec2(10, 10), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(620, 340), ImGuiCond_Always);
+    char title[64];
+    snprintf(title, sizeof(title), "Service %d", dashboard.id);
+    ImGui::Begin(title, nullptr, ImGuiWindowFlags_NoCollapse);
+    ImGui::PlotLines("Load", load, DASHBOARD_SERIES_SIZE, 0, nullptr, 0.0f, 1.0f, ImVec2(0, 100));
+    ImGui::PlotHistogram("Latency (ms)", latency, DASHBOARD_SERIES_SIZE, 0, nullptr, 0.0f, 40.0f, ImVec2(0, 100));
+    const char* resources[] = { "CPU", "Memory", "Disk", "Network" };
+    for (int n = 0; n < IM_ARRAYSIZE(resources); n++) {
+        char overlay[32];
+        float fraction = load[(dashboard.id * 7 + n * 29) % DASHBOARD_SERIES_SIZE];
+        snprintf(overlay, sizeof(overlay), "%s %.0f%%", resources[n], fraction * 100.0f);
+        ImGui::ProgressBar(fraction, ImVec2(-1, 0), overlay);
+    }
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(10, 360), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(620, 350), ImGuiCond_Always);
+    ImGui::Begin("Summary", nullptr, ImGuiWindowFlags_NoCollapse);
+    ImGui::Text("Dashboard %d, %d samples", dashboard.id, DASHBOARD_SERIES_SIZE);
+    ImGui::Separator();
+    for (int n = 0; n < 12; n++) {
+        float value = latency[(n * 11 + dashboard.id) % DASHBOARD_SERIES_SIZE];
+        ImGui::Bullet();
+        ImGui::TextColored(value > 30.0f ? ImVec4(1.0f, 0.4f, 0.3f, 1.0f) : ImVec4(0.5f, 0.9f, 0.5f, 1.0f), "Endpoint /api/v1/resource/%d: p99 %.1f ms", n, value);
+    }
+    ImGui::End();
+
+    ImGui::SetNextWindowPos(ImVec2(650, 10), ImGuiCond_Always);
+    ImGui::SetNextWindowSize(ImVec2(620, 700), ImGuiCond_Always);
+    ImGui::Begin("Requests", nullptr, ImGuiWindowFlags_NoCollapse);
+    if (ImGui::BeginTable("requests", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Host");
+        ImGui::TableSetupColumn("Requests/s");
+        ImGui::TableSetupColumn("Errors");
+        ImGui::TableSetupColumn("Load");
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 30; row++) {
+            float value = load[(row * 13 + dashboard.id) % DASHBOARD_SERIES_SIZE];
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("node-%02d-%03d", dashboard.id % 100, row);
+            ImGui::TableNextColumn(); ImGui::Text("%.1f", value * 2500.0f);
+            ImGui::TableNextColumn(); ImGui::Text("%d", (int)(value * 40.0f) % 7);
+            ImGui::TableNextColumn(); ImGui::ProgressBar(value, ImVec2(-1, 0));
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Render a dashboard in its own context, on the calling thread. 'pixels' is the render target, reused between dashboards of a thread.
+void renderDashboard(ImFontAtlas* atlas, Dashboard& dashboard, std::vector<ImU32>& pixels) {
+    ImGuiContext* previousContext = ImGui::GetCurrentContext();
+    ImGuiContext* context = ImGui::CreateContext(atlas);
+    ImGui::SetCurrentContext(context);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = nullptr;
+    io.LogFilename = nullptr;
+    io.DisplaySize = ImVec2((float)DASHBOARD_WIDTH, (float)DASHBOARD_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui::StyleColorsDark();
+    ImGui_ImplSoftRaster_Init(1);
+    for (int frame = 0; frame <= DASHBOARD_LAYOUT_FRAMES; frame++) {
+        ImGui_ImplSoftRaster_NewFrame();
+        ImGui::NewFrame();
+        drawDashboard(dashboard);
+        ImGui::Render();
+    }
+
+    pixels.assign((size_t)DASHBOARD_WIDTH * DASHBOARD_HEIGHT, IM_COL32((int)(clearColor[0] * 255), (int)(clearColor[1] * 255), (int)(clearColor[2] * 255), 255));
+    ImGui_ImplSoftRaster_Target target = { pixels.data(), DASHBOARD_WIDTH, DASHBOARD_HEIGHT, DASHBOARD_WIDTH };
+    ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), &target);
+    unsigned long long checksum = 14695981039346656037ull; // FNV-1a over the pixels
+    for (ImU32 pixel : pixels) checksum = (checksum ^ pixel) * 1099511628211ull;
+    dashboard.checksum = checksum;
+
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext(context);
+    ImGui::SetCurrentContext(previousContext);
+}
+
+int runDashboardBenchmark(int count) {
+    // The main thread context owns the font atlas and its texture. Locking the atlas makes it read-only for all dashboard contexts.
+    imguiAllocator.Install();
+    IMGUI_CHECKVERSION(); ImGui::CreateContext();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    addFonts(atlas);
+    ImGui_ImplSoftRaster_Init(1);
+    ImGui_ImplSoftRaster_CreateFontsTexture();
+    atlas->Locked = true;
+
+    int maxThreads = std::max(1, (int)std::thread::hardware_concurrency());
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+    std::cerr << "Warning: built without IMGUI_USE_THREAD_LOCAL_CONTEXT (Dashboards configuration), dashboards are rendered on a single thread" << std::endl;
+    maxThreads = 1;
+#endif
+    std::vector<Dashboard> dashboards(count);
+    for (int n = 0; n < count; n++) dashboards[n].id = n;
+    std::vector<ImU32> warmupPixels;
+    Dashboard warmup;
+    renderDashboard(atlas, warmup, warmupPixels);
+
+    char line[256];
+    snprintf(line, sizeof(line), "Rendering %d dashboards of %dx%d, one ImGui context each, with the CPU rasterizer", count, DASHBOARD_WIDTH, DASHBOARD_HEIGHT);
+    std::cout << line << std::endl;
+    std::vector<unsigned long long> referenceChecksums;
+    double singleThreadRate = 0.0;
+    bool checksumsMatch = true;
+    for (int threads = 1; ; threads = std::min(threads * 2, maxThreads)) {
+        std::atomic<int> next(0);
+        auto worker = [&]() {
+            std::vector<ImU32> pixels;
+            for (int n = next++; n < count; n = next++)
+                renderDashboard(atlas, dashboards[n], pixels);
+        };
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> pool;
+        for (int n = 1; n < threads; n++) pool.emplace_back(worker);
+        worker();
+        for (std::thread& thread : pool) thread.join();
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        bool match = true;
+        if (referenceChecksums.empty()) {
+            for (const Dashboard& dashboard : dashboards) referenceChecksums.push_back(dashboard.checksum);
+        }
+        else {
+            for (int n = 0; n < count; n++) match &= (dashboards[n].checksum == referenceChecksums[n]);
+        }
+        checksumsMatch &= match;
+        double rate = count / seconds;
+        if (threads == 1) singleThreadRate = rate;
+        snprintf(line, sizeof(line), "%2d thread(s): %8.1f dashboards/s, %.2fx, %.2f ms/dashboard per thread, output %s", threads, rate, rate / singleThreadRate,
+            seconds * 1000.0 * threads / count, match ? "identical" : "DIFFERS");
+        std::cout << line << std::endl;
+        if (threads == maxThreads) break;
+    }
+
+    atlas->Locked = false;
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext();
+    imguiAllocator.Uninstall();
+    return checksumsMatch ? 0 : 1;
+}
+
+void shutdownImGuiAndWindow() {
+    remoteServer.Close(); // Releases its memory before the allocator is uninstalled
+    uiRecorder.Close();
+    ImGui_ImplOpenGL3_Shutdown();
+    ImGui_ImplGlfw_Shutdown();
+    ImGui::DestroyContext();
+    imguiAllocator.Uninstall();
+
+    glfwDestroyWindow(window);
+    glfwTerminate();
+}
+
 void saveSettings() {
     std::ofstream outFile(SETTINGS_FILENAME);
     if (!outFile) { std::cerr << "Failed to write settings file: " << SETTINGS_FILENAME << std::endl; return; }
@@ -289,6 +778,11 @@ void saveSettings() {
     outFile << "CameraOffset " << cameraOffset.x << " " << cameraOffset.y << std::endl;
     outFile << "CameraZoom " << cameraZoom << std::endl;
     outFile << "ShowMenu " << showMenu << std::endl;
+    outFile << "LateLatchCamera " << lateLatchCamera << std::endl;
+    outFile << "PowerSaveMode " << powerSaveMode << std::endl;
+    outFile << "CacheControlPanel " << cacheControlPanel << std::endl;
+    outFile << "RemoteAddress " << remoteAddress << std::endl;
+    outFile << "RemoteStreaming " << remoteStreaming << std::endl;
     std::cout << "Settings saved: " << SETTINGS_FILENAME << std::endl;
 }
 
@@ -297,6 +791,7 @@ void loadSettings() {
     if (!inFile) { std::cerr << "Settings file not found or could not be read: " << SETTINGS_FILENAME << std::endl; return; }
     std::string line;
     int loadedSegments = circleSegments;
+    bool loadedRemoteStreaming = remoteStreaming;
     while (std::getline(inFile, line)) {
         std::stringstream ss(line); std::string key; ss >> key;
         if (key == "Shape") { int i; ss >> i; currentShape = static_cast<ShapeType>(i); }
@@ -312,11 +807,18 @@ void loadSettings() {
         else if (key == "CameraOffset") ss >> cameraOffset.x >> cameraOffset.y;
         else if (key == "CameraZoom") ss >> cameraZoom;
         else if (key == "ShowMenu") ss >> showMenu;
+        else if (key == "LateLatchCamera") ss >> lateLatchCamera;
+        else if (key == "PowerSaveMode") ss >> powerSaveMode;
+        else if (key == "CacheControlPanel") ss >> cacheControlPanel;
+        else if (key == "RemoteAddress" && !remoteStreaming) { std::string address; ss >> address; snprintf(remoteAddress, sizeof(remoteAddress), "%s", address.c_str()); }
+        else if (key == "RemoteStreaming") ss >> loadedRemoteStreaming;
     }
     if (loadedSegments != circleSegments) {
         circleSegments = loadedSegments;
         setupCircle(circleSegments);
     }
+    if (loadedRemoteStreaming != remoteStreaming) setRemoteStreaming(loadedRemoteStreaming);
+    requestRedraw();
     std::cout << "Settings loaded: " << SETTINGS_FILENAME << std::endl;
 }
 
@@ -324,43 +826,129 @@ void glfwErrorCallback(int error, const char* description) {
     std::cerr << "GLFW Error (" << error << "): " << description << std::endl;
 }
 
-void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
-    ImGui_ImplGlfw_MouseButtonCallback(window, button, action, mods);
+void recordInputEvent(InputEventType type, double x, double y, int code, int scancode, int action, int mods) {
+    if (!inputRecording) return;
+    inputMacro.events.push_back({ inputMacroFrame, glfwGetTime() - inputMacroStartTime, type, x, y, code, scancode, action, mods });
+}
+
+// Camera input handlers, shared by the GLFW callbacks and input macro replay
+void handleMouseButton(int button, int action, double xpos, double ypos) {
     if (ImGui::GetIO().WantCaptureMouse) return;
     if (button == GLFW_MOUSE_BUTTON_MIDDLE && action == GLFW_PRESS) {
-        isDragging = true; glfwGetCursorPos(window, &lastMouseX, &lastMouseY);
+        isDragging = true; lastMouseX = xpos; lastMouseY = ypos;
     }
     else if (button == GLFW_MOUSE_BUTTON_MIDDLE && action == GLFW_RELEASE) {
         isDragging = false;
     }
 }
 
+void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+    if (inputReplaying) return;
+    ImGui_ImplGlfw_MouseButtonCallback(window, button, action, mods);
+    redrawRequested = true;
+    double xpos, ypos; glfwGetCursorPos(window, &xpos, &ypos);
+    recordInputEvent(InputEventType::MOUSE_BUTTON, xpos, ypos, button, 0, action, mods);
+    handleMouseButton(button, action, xpos, ypos);
+}
+
+bool panCamera(GLFWwindow* window, double xpos, double ypos) {
+    if (xpos == lastMouseX && ypos == lastMouseY) return false;
+    float dx = static_cast<float>(xpos - lastMouseX); float dy = static_cast<float>(ypos - lastMouseY);
+    int width, height; glfwGetFramebufferSize(window, &width, &height);
+    if (width > 0 && height > 0) {
+        cameraOffset.x += dx * (2.0f / width) * (1.0f / cameraZoom);
+        cameraOffset.y -= dy * (2.0f / height) * (1.0f / cameraZoom);
+    }
+    lastMouseX = xpos; lastMouseY = ypos;
+    return true;
+}
+
+// Return true when the camera moved
+bool handleCursorPos(double xpos, double ypos) {
+    if (ImGui::GetIO().WantCaptureMouse) return false;
+    return isDragging && panCamera(window, xpos, ypos);
+}
+
 void cursorPosCallback(GLFWwindow* window, double xpos, double ypos) {
+    if (inputReplaying) return;
     ImGui_ImplGlfw_CursorPosCallback(window, xpos, ypos);
-    if (ImGui::GetIO().WantCaptureMouse) return;
-    if (isDragging) {
-        float dx = static_cast<float>(xpos - lastMouseX); float dy = static_cast<float>(ypos - lastMouseY);
-        int width, height; glfwGetFramebufferSize(window, &width, &height);
-        if (width > 0 && height > 0) {
-            cameraOffset.x += dx * (2.0f / width) * (1.0f / cameraZoom);
-            cameraOffset.y -= dy * (2.0f / height) * (1.0f / cameraZoom);
-        }
-        lastMouseX = xpos; lastMouseY = ypos;
+    redrawRequested = true;
+    recordInputEvent(InputEventType::CURSOR_POS, xpos, ypos, 0, 0, 0, 0);
+    if (handleCursorPos(xpos, ypos) && cameraInputTime < 0.0) cameraInputTime = glfwGetTime();
+}
+
+// Events are only delivered by glfwPollEvents() at the start of the frame: read the cursor again
+// so the scene uses the freshest position. Queued events with older positions are applied as deltas
+// from this one on the next poll, so the camera still ends up at the right place.
+// The latency probe keeps the time of the input event delivered by GLFW, latching doesn't make input younger.
+void latchCamera(GLFWwindow* window) {
+    if (!lateLatchCamera || !isDragging || inputReplaying || ImGui::GetIO().WantCaptureMouse) return;
+    double xpos, ypos; glfwGetCursorPos(window, &xpos, &ypos);
+    panCamera(window, xpos, ypos);
+}
+
+void addLatencySample(float ms) {
+    latencySamples[latencySampleIdx] = ms;
+    latencySampleIdx = (latencySampleIdx + 1) % LATENCY_SAMPLES;
+    if (latencySampleCount < LATENCY_SAMPLES) latencySampleCount++;
+}
+
+void showLatencyStats() {
+    ImGui::Checkbox("Late-latch camera", &lateLatchCamera); ImGui::SameLine();
+    ImGui::Checkbox("glFinish after swap", &latencyFinishAfterSwap);
+    if (latencySampleCount == 0) { ImGui::TextDisabled("Pan or zoom the view to collect samples."); return; }
+    float sorted[LATENCY_SAMPLES];
+    std::copy(latencySamples, latencySamples + latencySampleCount, sorted);
+    std::sort(sorted, sorted + latencySampleCount);
+    float sum = 0.0f;
+    for (int i = 0; i < latencySampleCount; i++) sum += sorted[i];
+    ImGui::Text("%d samples: avg %.2f ms, p50 %.2f ms, p95 %.2f ms, max %.2f ms", latencySampleCount, sum / latencySampleCount,
+        sorted[latencySampleCount / 2], sorted[latencySampleCount * 95 / 100], sorted[latencySampleCount - 1]);
+    const int BUCKETS = 50; // 1 ms each, last one holds everything above
+    float buckets[BUCKETS] = {};
+    for (int i = 0; i < latencySampleCount; i++) buckets[std::min((int)sorted[i], BUCKETS - 1)] += 1.0f;
+    ImGui::PlotHistogram("##LatencyHistogram", buckets, BUCKETS, 0, "input to swap, 0-50 ms", 0.0f, FLT_MAX, ImVec2(0, 60));
+    if (ImGui::Button("Reset##Latency")) { latencySampleCount = latencySampleIdx = 0; }
+}
+
+void showPerformanceReadouts() {
+    double now = glfwGetTime();
+    if (perfReadoutTime < 0.0 || now - perfReadoutTime >= PERF_READOUT_INTERVAL) {
+        perfReadoutTime = now;
+        perfFramerate = ImGui::GetIO().Framerate;
+        perfFramesRendered = framesRendered;
+        perfFramesSkipped = framesSkipped;
+        ImGui_ImplOpenGL3_GetRenderCacheStats(&perfCacheStats);
+        ImGui_ImplOpenGL3_GetUploadStats(&perfUploadStats);
     }
+    ImGui::Text("Avg. %.3f ms/frame (%.1f FPS)", 1000.0f / perfFramerate, perfFramerate);
+    ImGui::Text("Frames rendered: %d, skipped: %d", perfFramesRendered, perfFramesSkipped);
+    int lookups = perfCacheStats.TotalHits + perfCacheStats.TotalMisses;
+    ImGui::Text("UI cache: %.1f%% hits (%d/%d), %d textures, %.1f KB", lookups ? 100.0f * perfCacheStats.TotalHits / lookups : 0.0f,
+        perfCacheStats.TotalHits, lookups, perfCacheStats.CachedTextures, perfCacheStats.CachedTextureBytes / 1024.0f);
+    ImGui::Text("UI cache fill saved: %.0f pixels/frame", perfCacheStats.FrameFillPixelsSaved);
+    ImGui::Text("UI upload: %.1f KB/frame (%d lists), skipped %.1f KB (%d unchanged lists)", perfUploadStats.FrameBytesUploaded / 1024.0f,
+        perfUploadStats.FrameListsUploaded, perfUploadStats.FrameBytesReused / 1024.0f, perfUploadStats.FrameListsReused);
 }
 
-void scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
-    ImGui_ImplGlfw_ScrollCallback(window, xoffset, yoffset);
-    if (ImGui::GetIO().WantCaptureMouse) return;
+bool handleScroll(double yoffset) {
+    if (ImGui::GetIO().WantCaptureMouse) return false;
     float zoomSensitivity = 0.1f;
     cameraZoom += static_cast<float>(yoffset) * zoomSensitivity * cameraZoom;
     if (cameraZoom < 0.05f) cameraZoom = 0.05f;
     if (cameraZoom > 20.0f) cameraZoom = 20.0f;
+    return true;
 }
 
-void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
-{
-    ImGui_ImplGlfw_KeyCallback(window, key, scancode, action, mods);
+void scrollCallback(GLFWwindow* window, double xoffset, double yoffset) {
+    if (inputReplaying) return;
+    ImGui_ImplGlfw_ScrollCallback(window, xoffset, yoffset);
+    redrawRequested = true;
+    recordInputEvent(InputEventType::SCROLL, xoffset, yoffset, 0, 0, 0, 0);
+    if (handleScroll(yoffset) && cameraInputTime < 0.0) cameraInputTime = glfwGetTime();
+}
+
+void handleKey(int key, int action) {
     if (key == GLFW_KEY_INSERT && action == GLFW_PRESS) {
         showMenu = !showMenu;
     }
@@ -369,7 +957,255 @@ void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods
     }
 }
 
-int main() {
+void stopInputReplay();
+
+void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
+{
+    if (inputReplaying) {
+        if (key == GLFW_KEY_ESCAPE && action == GLFW_PRESS) stopInputReplay(); // Abort
+        return;
+    }
+    ImGui_ImplGlfw_KeyCallback(window, key, scancode, action, mods);
+    redrawRequested = true;
+    if (action != GLFW_REPEAT) recordInputEvent(InputEventType::KEY, 0.0, 0.0, key, scancode, action, mods);
+    handleKey(key, action);
+}
+
+void charCallback(GLFWwindow* window, unsigned int c) {
+    if (inputReplaying) return;
+    ImGui_ImplGlfw_CharCallback(window, c);
+    redrawRequested = true;
+    recordInputEvent(InputEventType::CHAR, 0.0, 0.0, (int)c, 0, 0, 0);
+}
+
+// Ignored during input macro replay: losing focus would release keys and buttons held by the macro
+void windowFocusCallback(GLFWwindow* window, int focused) {
+    if (inputReplaying) return;
+    ImGui_ImplGlfw_WindowFocusCallback(window, focused);
+    redrawRequested = true;
+}
+
+void cursorEnterCallback(GLFWwindow* window, int entered) {
+    if (inputReplaying) return;
+    ImGui_ImplGlfw_CursorEnterCallback(window, entered);
+    redrawRequested = true;
+}
+
+void windowIconifyCallback(GLFWwindow*, int iconified) {
+    windowIconified = iconified != 0;
+    redrawRequested = true;
+}
+
+// Resize and expose events: also covers the OS asking for a repaint while we are waiting
+void windowDamageCallback(GLFWwindow*) { redrawRequested = true; }
+void framebufferSizeCallback(GLFWwindow*, int, int) { redrawRequested = true; }
+
+// Defined in imgui_impl_glfw.cpp, not declared in its header
+ImGuiKey ImGui_ImplGlfw_KeyToImGuiKey(int keycode, int scancode);
+
+void startInputRecording() {
+    inputMacro = InputMacro();
+    glfwGetWindowSize(window, &inputMacro.windowWidth, &inputMacro.windowHeight);
+    inputMacro.cameraOffset = cameraOffset;
+    inputMacro.cameraZoom = cameraZoom;
+    inputMacro.imguiIni = ImGui::SaveIniSettingsToMemory();
+    inputRecording = true;
+    inputMacroFrame = 0;
+    inputMacroStartTime = glfwGetTime();
+    double xpos, ypos; glfwGetCursorPos(window, &xpos, &ypos);
+    recordInputEvent(InputEventType::CURSOR_POS, xpos, ypos, 0, 0, 0, 0);
+}
+
+bool saveInputMacro(const char* filename) {
+    std::ofstream outFile(filename, std::ios::binary);
+    if (!outFile) return false;
+    outFile.precision(10);
+    outFile << "InputMacro 1" << std::endl;
+    outFile << "Frames " << inputMacro.frames << std::endl;
+    outFile << "Window " << inputMacro.windowWidth << " " << inputMacro.windowHeight << std::endl;
+    outFile << "Camera " << inputMacro.cameraOffset.x << " " << inputMacro.cameraOffset.y << " " << inputMacro.cameraZoom << std::endl;
+    for (const InputEvent& e : inputMacro.events)
+        outFile << "Event " << e.frame << " " << e.time << " " << static_cast<int>(e.type) << " " << e.x << " " << e.y << " " << e.code << " " << e.scancode << " " << e.action << " " << e.mods << std::endl;
+    outFile << "ImGuiIni " << inputMacro.imguiIni.size() << std::endl << inputMacro.imguiIni; // Last: raw multi-line text
+    return static_cast<bool>(outFile);
+}
+
+bool loadInputMacro(const char* filename) {
+    std::ifstream inFile(filename, std::ios::binary);
+    std::string line;
+    if (!inFile || !std::getline(inFile, line) || line != "InputMacro 1") return false;
+    InputMacro macro;
+    while (std::getline(inFile, line)) {
+        std::istringstream ss(line);
+        std::string key;
+        ss >> key;
+        if (key == "Frames") ss >> macro.frames;
+        else if (key == "Window") ss >> macro.windowWidth >> macro.windowHeight;
+        else if (key == "Camera") ss >> macro.cameraOffset.x >> macro.cameraOffset.y >> macro.cameraZoom;
+        else if (key == "Event") {
+            InputEvent e = {};
+            int type = 0;
+            ss >> e.frame >> e.time >> type >> e.x >> e.y >> e.code >> e.scancode >> e.action >> e.mods;
+            if (!ss || type < 0 || type > static_cast<int>(InputEventType::CHAR)) return false;
+            e.type = static_cast<InputEventType>(type);
+            macro.events.push_back(e);
+        }
+        else if (key == "ImGuiIni") {
+            size_t size = 0;
+            ss >> size;
+            macro.imguiIni.resize(size);
+            inFile.read(&macro.imguiIni[0], size);
+            break;
+        }
+    }
+    inputMacro = macro;
+    return true;
+}
+
+void stopInputRecording() {
+    inputRecording = false;
+    inputMacro.frames = inputMacroFrame;
+    if (saveInputMacro(inputMacroFile)) std::cout << "Input macro saved: " << inputMacroFile << " (" << inputMacro.events.size() << " events, " << inputMacro.frames << " frames)" << std::endl;
+    else std::cerr << "Failed to save input macro: " << inputMacroFile << std::endl;
+}
+
+bool startInputReplay(const char* filename) {
+    if (!loadInputMacro(filename)) { std::cerr << "Failed to load input macro: " << filename << std::endl; return false; }
+    glfwSetWindowSize(window, inputMacro.windowWidth, inputMacro.windowHeight);
+    cameraOffset = inputMacro.cameraOffset;
+    cameraZoom = inputMacro.cameraZoom;
+    isDragging = false;
+    ImGui::LoadIniSettingsFromMemory(inputMacro.imguiIni.c_str(), inputMacro.imguiIni.size());
+    ImGui::GetIO().ClearInputKeys();
+    glfwSwapInterval(0); // Measure frame times, not vsync
+    inputReplaying = true;
+    inputMacroFrame = 0;
+    inputReplayNext = 0;
+    inputReplayFrameTimes.clear();
+    inputReplayFrameAllocs.clear();
+    inputReplayAllocCount = imguiAllocator.TotalAllocCount;
+    inputReplayReport.clear();
+    return true;
+}
+
+void stopInputReplay() {
+    inputReplaying = false;
+    glfwSwapInterval(1);
+    redrawRequested = true;
+    if (inputReplayFrameTimes.empty()) return;
+    std::vector<float> sorted = inputReplayFrameTimes;
+    std::sort(sorted.begin(), sorted.end());
+    int frames = (int)sorted.size();
+    double sum = 0.0;
+    for (float t : sorted) sum += t;
+    long long allocs = 0;
+    int allocFrames = 0, allocMax = 0;
+    for (int count : inputReplayFrameAllocs) { allocs += count; allocFrames += count > 0; allocMax = std::max(allocMax, count); }
+    char report[512];
+    snprintf(report, sizeof(report), "%d frames: avg %.3f ms, p50 %.3f ms, p99 %.3f ms, max %.3f ms\n"
+        "ImGui allocations: %lld (%.1f/frame, max %d), %d frames with allocations, %.1f KB in use at most",
+        frames, sum / frames, sorted[frames / 2], sorted[frames * 99 / 100], sorted[frames - 1],
+        allocs, (double)allocs / frames, allocMax, allocFrames, imguiAllocator.BytesInUseMax / 1024.0);
+    inputReplayReport = report;
+    std::cout << "Input replay of " << inputMacroFile << ": " << inputMacroFrame << "/" << inputMacro.frames << " frames" << std::endl << inputReplayReport << std::endl;
+    if (exitAfterInputReplay) glfwSetWindowShouldClose(window, GLFW_TRUE);
+}
+
+void addKeyModifiers(ImGuiIO& io, int mods) {
+    io.AddKeyEvent(ImGuiMod_Ctrl, (mods & GLFW_MOD_CONTROL) != 0);
+    io.AddKeyEvent(ImGuiMod_Shift, (mods & GLFW_MOD_SHIFT) != 0);
+    io.AddKeyEvent(ImGuiMod_Alt, (mods & GLFW_MOD_ALT) != 0);
+    io.AddKeyEvent(ImGuiMod_Super, (mods & GLFW_MOD_SUPER) != 0);
+}
+
+// Same as the GLFW callbacks, with ImGui_ImplGlfw_*Callback() replaced by ImGuiIO calls: the backend queries the real keyboard and cursor
+void applyInputEvent(const InputEvent& e) {
+    ImGuiIO& io = ImGui::GetIO();
+    switch (e.type) {
+    case InputEventType::CURSOR_POS:
+        io.AddMousePosEvent((float)e.x, (float)e.y);
+        inputReplayCursorX = e.x; inputReplayCursorY = e.y;
+        handleCursorPos(e.x, e.y);
+        break;
+    case InputEventType::MOUSE_BUTTON:
+        addKeyModifiers(io, e.mods);
+        if (e.code >= 0 && e.code < ImGuiMouseButton_COUNT) io.AddMouseButtonEvent(e.code, e.action == GLFW_PRESS);
+        handleMouseButton(e.code, e.action, e.x, e.y);
+        break;
+    case InputEventType::SCROLL:
+        io.AddMouseWheelEvent((float)e.x, (float)e.y);
+        handleScroll(e.y);
+        break;
+    case InputEventType::KEY: {
+        addKeyModifiers(io, e.mods);
+        ImGuiKey imguiKey = ImGui_ImplGlfw_KeyToImGuiKey(e.code, e.scancode);
+        io.AddKeyEvent(imguiKey, e.action == GLFW_PRESS);
+        io.SetKeyEventNativeData(imguiKey, e.code, e.scancode);
+        handleKey(e.code, e.action);
+        break;
+    }
+    case InputEventType::CHAR:
+        io.AddInputCharacter((unsigned int)e.code);
+        break;
+    }
+}
+
+// Call after ImGui_ImplGlfw_NewFrame(), which sets the delta time and may poll the real cursor position
+void replayInputEvents() {
+    if (inputReplayRequested) { inputReplayRequested = false; startInputReplay(inputMacroFile); }
+    if (!inputReplaying) return;
+    ImGuiIO& io = ImGui::GetIO();
+    io.DeltaTime = (float)INPUT_REPLAY_TIMESTEP;
+    io.AddMousePosEvent((float)inputReplayCursorX, (float)inputReplayCursorY);
+    for (; inputReplayNext < inputMacro.events.size() && inputMacro.events[inputReplayNext].frame <= inputMacroFrame; inputReplayNext++)
+        applyInputEvent(inputMacro.events[inputReplayNext]);
+    inputReplayFrameStart = glfwGetTime();
+}
+
+// Call after swapping buffers
+void endInputMacroFrame() {
+    if (!inputRecording && !inputReplaying) return;
+    inputMacroFrame++;
+    if (!inputReplaying) return;
+    inputReplayFrameAllocs.push_back(imguiAllocator.TotalAllocCount - inputReplayAllocCount);
+    inputReplayAllocCount = imguiAllocator.TotalAllocCount;
+    inputReplayFrameTimes.push_back(static_cast<float>((glfwGetTime() - inputReplayFrameStart) * 1000.0));
+    if (inputMacroFrame >= inputMacro.frames && inputReplayNext >= inputMacro.events.size()) stopInputReplay();
+}
+
+void showInputMacro() {
+    ImGui::BeginDisabled(inputRecording || inputReplaying);
+    ImGui::InputText("File", inputMacroFile, IM_ARRAYSIZE(inputMacroFile));
+    ImGui::EndDisabled();
+    if (inputRecording) {
+        if (ImGui::Button("Stop Recording")) stopInputRecording();
+        ImGui::SameLine(); ImGui::Text("%d events, %d frames", (int)inputMacro.events.size(), inputMacroFrame);
+        return;
+    }
+    if (inputReplaying) {
+        ImGui::Text("Replaying: frame %d/%d (Escape to stop)", inputMacroFrame, inputMacro.frames);
+        return;
+    }
+    if (ImGui::Button("Record")) startInputRecording();
+    ImGui::SameLine();
+    if (ImGui::Button("Replay")) inputReplayRequested = true;
+    ImGui::SameLine(); ImGui::TextDisabled("or: OpenGL %s <file>", REPLAY_INPUT_ARG);
+    if (!inputReplayReport.empty()) ImGui::TextUnformatted(inputReplayReport.c_str());
+}
+
+int main(int argc, char** argv) {
+    const char* remoteViewAddress = nullptr;
+    const char* replayFile = nullptr;
+    const char* replayInputFile = nullptr;
+    int dashboardCount = 0;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::string(argv[i]) == REMOTE_VIEW_ARG) remoteViewAddress = argv[i + 1];
+        else if (std::string(argv[i]) == REPLAY_ARG) replayFile = argv[i + 1];
+        else if (std::string(argv[i]) == REPLAY_INPUT_ARG) replayInputFile = argv[i + 1];
+        else if (std::string(argv[i]) == DASHBOARDS_ARG) dashboardCount = std::atoi(argv[i + 1]);
+    }
+    if (dashboardCount > 0) return runDashboardBenchmark(dashboardCount); // Headless: no window nor GL context
+
     glfwSetErrorCallback(glfwErrorCallback);
     if (!glfwInit()) return -1;
     glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3); glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
@@ -383,23 +1219,36 @@ int main() {
     if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress)) { return -1; }
     std::cout << "OpenGL Version: " << glGetString(GL_VERSION) << std::endl;
 
+    imguiAllocator.Install();
     IMGUI_CHECKVERSION(); ImGui::CreateContext(); ImGuiIO& io = ImGui::GetIO();
     ImGui::StyleColorsDark();
     ImGui_ImplGlfw_InitForOpenGL(window, false);
     ImGui_ImplOpenGL3_Init(GLSL_VERSION);
 
-    static const ImWchar font_ranges[] = { 0x0020, 0x00FF, 0x0100, 0x017F, 0x00C7,0x00C7, 0x00E7,0x00E7, 0x00D6,0x00D6, 0x00F6,0x00F6, 0x00DC,0x00DC, 0x00FC,0x00FC, 0, };
-    const char* font_path = "C:/Windows/Fonts/Arial.ttf";
-    float font_size = 15.0f;
-    ImFont* font = io.Fonts->AddFontFromFileTTF(font_path, font_size, nullptr, font_ranges);
-    if (!font) { std::cerr << "Warning: Failed to load font! -> " << font_path << std::endl; io.Fonts->AddFontDefault(); }
-    else { std::cout << "Font loaded successfully: " << font_path << std::endl; }
+    addFonts(io.Fonts);
 
     glfwSetKeyCallback(window, keyCallback);
     glfwSetMouseButtonCallback(window, mouseButtonCallback);
     glfwSetCursorPosCallback(window, cursorPosCallback);
     glfwSetScrollCallback(window, scrollCallback);
-    glfwSetCharCallback(window, ImGui_ImplGlfw_CharCallback);
+    glfwSetCharCallback(window, charCallback);
+    glfwSetWindowFocusCallback(window, windowFocusCallback);
+    glfwSetCursorEnterCallback(window, cursorEnterCallback);
+    glfwSetWindowIconifyCallback(window, windowIconifyCallback);
+    glfwSetWindowRefreshCallback(window, windowDamageCallback);
+    glfwSetFramebufferSizeCallback(window, framebufferSizeCallback);
+    if (const GLFWvidmode* mode = glfwGetVideoMode(glfwGetPrimaryMonitor())) displayRefreshRate = mode->refreshRate;
+
+    if (remoteViewAddress) {
+        runRemoteViewer(remoteViewAddress);
+        shutdownImGuiAndWindow();
+        return 0;
+    }
+    if (replayFile) {
+        int result = runReplayBenchmark(replayFile);
+        shutdownImGuiAndWindow();
+        return result;
+    }
 
     if (!setupShaders() || !getUniformLocations()) return -1;
 
@@ -409,17 +1258,33 @@ int main() {
     textureID = loadTexture("container.jpg");
 
     loadSettings();
+    if (replayInputFile) {
+        snprintf(inputMacroFile, sizeof(inputMacroFile), "%s", replayInputFile);
+        if (!startInputReplay(inputMacroFile)) { shutdownImGuiAndWindow(); return -1; }
+        exitAfterInputReplay = true;
+    }
 
     while (!glfwWindowShouldClose(window)) {
-        glfwPollEvents();
+        if (!pollOrWaitEvents()) continue;
+        framesRendered++;
 
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
+        replayInputEvents();
+        imguiAllocator.NewFrame();
         ImGui::NewFrame();
 
         if (showMenu) {
-            ImGui::Begin("Control Panel");
-            if (ImGui::CollapsingHeader("Performance", ImGuiTreeNodeFlags_DefaultOpen)) { ImGui::Text("Avg. %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate); }
+            ImGui::Begin("Control Panel", nullptr, cacheControlPanel ? ImGuiWindowFlags_CachedRender : ImGuiWindowFlags_None);
+            if (ImGui::CollapsingHeader("Performance", ImGuiTreeNodeFlags_DefaultOpen)) {
+                showPerformanceReadouts();
+                if (ImGui::TreeNode("ImGui Memory")) { imguiAllocator.ShowStats(); ImGui::TreePop(); }
+                if (ImGui::TreeNode("Input Latency")) { showLatencyStats(); ImGui::TreePop(); }
+                if (ImGui::TreeNode("UI Recording")) { showUiRecording(); ImGui::TreePop(); }
+                if (ImGui::TreeNode("Input Macro")) { showInputMacro(); ImGui::TreePop(); }
+                if (ImGui::Checkbox("Power Saving (redraw on events only)", &powerSaveMode)) { requestRedraw(); }
+                ImGui::Checkbox("Cache Control Panel when idle", &cacheControlPanel);
+            }
             if (ImGui::CollapsingHeader("Shape Selection", ImGuiTreeNodeFlags_DefaultOpen)) {
                 if (ImGui::RadioButton("None", currentShape == ShapeType::NONE)) { currentShape = ShapeType::NONE; } ImGui::SameLine();
                 if (ImGui::RadioButton("Triangle", currentShape == ShapeType::TRIANGLE)) { currentShape = ShapeType::TRIANGLE; } ImGui::SameLine();
@@ -453,6 +1318,9 @@ int main() {
                 if (ImGui::Button("Save Settings")) { saveSettings(); } ImGui::SameLine();
                 if (ImGui::Button("Load Settings")) { loadSettings(); }
             }
+            if (ImGui::CollapsingHeader("Remote Viewing")) {
+                showRemoteStreaming();
+            }
             ImGui::End();
         }
 
@@ -463,6 +1331,9 @@ int main() {
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         glPolygonMode(GL_FRONT_AND_BACK, wireframeMode ? GL_LINE : GL_FILL);
 
+        latchCamera(window);
+        double frameInputTime = cameraInputTime;
+        cameraInputTime = -1.0;
         if (currentShape != ShapeType::NONE && shaderProgram != 0) {
             glUseProgram(shaderProgram);
             glm::mat4 model = glm::mat4(1.0f);
@@ -502,12 +1373,20 @@ int main() {
 
         glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
         ImGui::Render();
+        if (remoteStreaming && !remoteServer.SendFrame(ImGui::GetDrawData())) redrawRequested = true; // Viewer is behind: send again next frame
+        if (uiRecorder.IsRecording() && !uiRecorder.RecordFrame(ImGui::GetDrawData())) std::cerr << "UI recording stopped: failed to write " << uiRecordingFile << std::endl;
         ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
         glfwSwapBuffers(window);
+        endInputMacroFrame();
+        if (frameInputTime >= 0.0) {
+            if (latencyFinishAfterSwap) glFinish(); // Closer to the actual flip, at the cost of stalling the CPU
+            addLatencySample(static_cast<float>((glfwGetTime() - frameInputTime) * 1000.0));
+        }
     }
 
     std::cout << "Cleaning up..." << std::endl;
-    saveSettings();
+    if (inputRecording) stopInputRecording();
+    if (!exitAfterInputReplay) saveSettings(); // Replay changed the camera
 
     glDeleteTextures(1, &textureID);
     glDeleteVertexArrays(1, &triangleVAO); glDeleteBuffers(1, &triangleVBO);
@@ -517,12 +1396,7 @@ int main() {
         glDeleteProgram(shaderProgram);
     }
 
-    ImGui_ImplOpenGL3_Shutdown();
-    ImGui_ImplGlfw_Shutdown();
-    ImGui::DestroyContext();
-
-    glfwDestroyWindow(window);
-    glfwTerminate();
+    shutdownImGuiAndWindow();
     std::cout << "Program terminated." << std::endl;
 
     return 0;
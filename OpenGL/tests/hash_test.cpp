@@ -0,0 +1,116 @@
+// Test and benchmark for ImHashData()/ImHashStr(): "###" handling, collision rate over 1M generated IDs, throughput.
+// Built twice by tests/Makefile: 'hash_test' with the default CRC32 hash, 'hash_test_fast' with IMGUI_USE_FAST_HASH.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
+static int failures = 0;
+#define CHECK(_EXPR)    do { if (!(_EXPR)) { printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); failures++; } } while (0)
+
+static void TestIdMarker()
+{
+    // Only the part starting at the last "###" is hashed, but the seed is still used
+    CHECK(ImHashStr("Label###id") == ImHashStr("Other label###id"));
+    CHECK(ImHashStr("Label###id") == ImHashStr("###id"));
+    CHECK(ImHashStr("a###b###id") == ImHashStr("###id"));
+    CHECK(ImHashStr("Label###id") != ImHashStr("Label###id2"));
+    CHECK(ImHashStr("Label##a") != ImHashStr("Label##b"));
+    CHECK(ImHashStr("Label###id", 0, 1) != ImHashStr("Label###id", 0, 2));
+
+    // Explicit size == zero-terminated, ImHashStr() == ImHashData() without "###"
+    CHECK(ImHashStr("Hello world", 5) == ImHashStr("Hello"));
+    CHECK(ImHashStr("Hello", 0, 42) == ImHashData("Hello", 5, 42));
+#ifdef IMGUI_USE_FAST_HASH
+    CHECK(IM_HASH_STR_LITERAL("Hello", 42) == ImHashStr("Hello", 0, 42));
+    CHECK(IM_HASH_STR_LITERAL("Label###id", 7) == ImHashStr("###id", 0, 7));
+    CHECK(IM_HASH_STR_LITERAL("A label longer than sixteen bytes", 0) == ImHashStr("A label longer than sixteen bytes"));
+#endif
+}
+
+// Count IDs equal to a previous one. Expected for a good 32-bit hash: N*(N-1)/2 / 2^32 (~116 for N=1M).
+static int CountCollisions(std::vector<ImGuiID>& ids)
+{
+    std::sort(ids.begin(), ids.end());
+    int collisions = 0;
+    for (size_t n = 1; n < ids.size(); n++)
+        if (ids[n] == ids[n - 1])
+            collisions++;
+    return collisions;
+}
+
+static void TestCollisions()
+{
+    const int ID_COUNT = 1000000;
+    const double expected = (double)ID_COUNT * (ID_COUNT - 1) / 2.0 / 4294967296.0;
+    char buf[64];
+    std::vector<ImGuiID> ids;
+    ids.reserve(ID_COUNT);
+
+    // Labels typical of generated UIs, hashed with the same seed
+    for (int n = 0; n < ID_COUNT; n++)
+        ids.push_back(ImHashStr(buf, snprintf(buf, sizeof(buf), "Item %d##row", n)));
+    int collisions_labels = CountCollisions(ids);
+
+    // Same short label under many distinct parent IDs (e.g. "Delete" button on every row of a list)
+    ids.clear();
+    for (int n = 0; n < ID_COUNT; n++)
+        ids.push_back(ImHashStr("Delete", 0, (ImGuiID)n * 2654435761u));
+    int collisions_seeds = CountCollisions(ids);
+
+    // Integer IDs pushed with PushID(int)
+    ids.clear();
+    ImGuiID seed = ImHashStr("Root");
+    for (int n = 0; n < ID_COUNT; n++)
+        ids.push_back(ImHashData(&n, sizeof(n), seed));
+    int collisions_ints = CountCollisions(ids);
+
+    printf("Collisions over %d IDs (expected ~%.0f): labels %d, seeds %d, ints %d\n", ID_COUNT, expected, collisions_labels, collisions_seeds, collisions_ints);
+    CHECK(collisions_labels < expected * 2 + 20);
+    CHECK(collisions_seeds < expected * 2 + 20);
+    CHECK(collisions_ints < expected * 2 + 20);
+}
+
+static void BenchmarkHash(const char* name, int label_len)
+{
+    const int LABELS_COUNT = 1024;
+    std::vector<char> labels((size_t)LABELS_COUNT * (label_len + 1));
+    for (int n = 0; n < LABELS_COUNT; n++)
+    {
+        char* label = &labels[(size_t)n * (label_len + 1)];
+        for (int c = 0; c < label_len; c++)
+            label[c] = (char)('a' + (n * 7 + c * 13) % 26);
+        label[label_len] = 0;
+    }
+
+    const int ITERATIONS = (label_len < 64) ? 10000 : 1000;
+    ImGuiID acc = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++)
+        for (int n = 0; n < LABELS_COUNT; n++)
+            acc += ImHashStr(&labels[(size_t)n * (label_len + 1)], 0, acc);
+    auto t1 = std::chrono::steady_clock::now();
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    double hashes = (double)ITERATIONS * LABELS_COUNT;
+    printf("ImHashStr() %-8s %4d bytes: %7.2f ns/hash, %8.1f MB/s (%08X)\n", name, label_len, secs * 1e9 / hashes, hashes * label_len / secs / (1024.0 * 1024.0), acc);
+}
+
+int main()
+{
+#ifdef IMGUI_USE_FAST_HASH
+    const char* hash_name = "fast";
+#else
+    const char* hash_name = "crc32";
+#endif
+    TestIdMarker();
+    TestCollisions();
+    const int label_lens[] = { 4, 12, 24, 64, 256 };
+    for (int label_len : label_lens)
+        BenchmarkHash(hash_name, label_len);
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
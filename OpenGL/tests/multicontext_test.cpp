@@ -0,0 +1,128 @@
+// Test for IMGUI_USE_THREAD_LOCAL_CONTEXT: N contexts sharing a locked font atlas, driven concurrently by worker threads
+// and rasterized with imgui_impl_softraster. Every context must produce the same pixels as when rendered alone on the main thread.
+// Built by tests/Makefile with IMGUI_USE_THREAD_LOCAL_CONTEXT. Run with SANITIZE=thread to check for data races.
+
+#include "imgui.h"
+#include "imgui_impl_softraster.h"
+#include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#ifndef IMGUI_USE_THREAD_LOCAL_CONTEXT
+#error "Build with IMGUI_USE_THREAD_LOCAL_CONTEXT"
+#endif
+
+static int failures = 0;
+#define CHECK(_EXPR)    do { if (!(_EXPR)) { printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); failures++; } } while (0)
+
+static const int TARGET_WIDTH = 640, TARGET_HEIGHT = 360;
+
+// Contents only depend on 'id'
+static void DrawContents(int id)
+{
+    ImGui::SetNextWindowPos(ImVec2(10, 10));
+    ImGui::SetNextWindowSize(ImVec2(600, 320));
+    ImGui::Begin("Dashboard");
+    ImGui::Text("Context %d", id);
+    float values[32];
+    for (int n = 0; n < IM_ARRAYSIZE(values); n++)
+        values[n] = (float)((n * 7 + id * 13) % 17);
+    ImGui::PlotLines("Values", values, IM_ARRAYSIZE(values), 0, NULL, 0.0f, 17.0f, ImVec2(0, 60));
+    if (ImGui::BeginTable("Table", 3, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+    {
+        ImGui::TableSetupColumn("Row");
+        ImGui::TableSetupColumn("Value");
+        ImGui::TableSetupColumn("Load");
+        ImGui::TableHeadersRow();
+        for (int row = 0; row < 8; row++)
+        {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn(); ImGui::Text("row-%02d-%02d", id, row);
+            ImGui::TableNextColumn(); ImGui::Text("%d", values[row] > 8.0f ? row * id : -row);
+            ImGui::TableNextColumn(); ImGui::ProgressBar(values[row] / 17.0f, ImVec2(-1, 0));
+        }
+        ImGui::EndTable();
+    }
+    ImGui::End();
+}
+
+// Render a context on the calling thread, return FNV-1a of its pixels
+static unsigned long long RenderContext(ImFontAtlas* atlas, int id)
+{
+    ImGuiContext* previous_ctx = ImGui::GetCurrentContext();
+    ImGuiContext* ctx = ImGui::CreateContext(atlas);
+    ImGui::SetCurrentContext(ctx);
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.LogFilename = NULL;
+    io.DisplaySize = ImVec2((float)TARGET_WIDTH, (float)TARGET_HEIGHT);
+    io.DeltaTime = 1.0f / 60.0f;
+    ImGui_ImplSoftRaster_Init(1);
+    for (int frame_n = 0; frame_n < 3; frame_n++)
+    {
+        ImGui_ImplSoftRaster_NewFrame();
+        ImGui::NewFrame();
+        CHECK(ImGui::GetCurrentContext() == ctx);
+        DrawContents(id);
+        ImGui::Render();
+    }
+
+    std::vector<ImU32> pixels((size_t)TARGET_WIDTH * TARGET_HEIGHT, IM_COL32_BLACK);
+    ImGui_ImplSoftRaster_Target target = { pixels.data(), TARGET_WIDTH, TARGET_HEIGHT, TARGET_WIDTH };
+    ImGui_ImplSoftRaster_RenderDrawData(ImGui::GetDrawData(), &target);
+    unsigned long long checksum = 14695981039346656037ull;
+    for (ImU32 pixel : pixels)
+        checksum = (checksum ^ pixel) * 1099511628211ull;
+
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext(ctx);
+    ImGui::SetCurrentContext(previous_ctx);
+    return checksum;
+}
+
+int main()
+{
+    // Owner context, building and locking the shared atlas
+    ImGuiContext* owner_ctx = ImGui::CreateContext();
+    ImFontAtlas* atlas = ImGui::GetIO().Fonts;
+    ImGui_ImplSoftRaster_Init(1);
+    ImGui_ImplSoftRaster_CreateFontsTexture();
+    atlas->Locked = true;
+
+    const int CONTEXTS_COUNT = 24;
+    const int THREADS_COUNT = 4;
+    std::vector<unsigned long long> reference(CONTEXTS_COUNT);
+    for (int n = 0; n < CONTEXTS_COUNT; n++)
+        reference[n] = RenderContext(atlas, n);
+    CHECK(reference[0] != reference[1]);
+
+    // A new thread starts without a current context
+    ImGuiContext* thread_initial_ctx = owner_ctx;
+    std::thread([&]() { thread_initial_ctx = ImGui::GetCurrentContext(); }).join();
+    CHECK(thread_initial_ctx == NULL);
+
+    std::vector<unsigned long long> results(CONTEXTS_COUNT);
+    std::atomic<int> next(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS_COUNT; t++)
+        threads.emplace_back([&]()
+        {
+            for (int n = next++; n < CONTEXTS_COUNT; n = next++)
+                results[n] = RenderContext(atlas, n);
+            CHECK(ImGui::GetCurrentContext() == NULL);
+        });
+    for (std::thread& thread : threads)
+        thread.join();
+    for (int n = 0; n < CONTEXTS_COUNT; n++)
+        CHECK(results[n] == reference[n]);
+
+    // Worker threads didn't change the main thread context
+    CHECK(ImGui::GetCurrentContext() == owner_ctx);
+    CHECK(atlas->Locked);
+    atlas->Locked = false;
+    ImGui_ImplSoftRaster_Shutdown();
+    ImGui::DestroyContext(owner_ctx);
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,161 @@
+// Test and benchmark for ImGuiStorage: random operations checked against std::unordered_map, insert-heavy and lookup-heavy workloads.
+// Built twice by tests/Makefile: 'storage_test' with the default sorted storage, 'storage_test_hashed' with IMGUI_USE_HASHED_STORAGE.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+static int failures = 0;
+#define CHECK(_EXPR)    do { if (!(_EXPR)) { printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); failures++; } } while (0)
+
+static unsigned int rng = 1;
+static ImGuiID RandomKey(unsigned int range)
+{
+    rng = rng * 1664525u + 1013904223u;
+    return (rng >> 8) % range;
+}
+
+static bool Matches(const ImGuiStorage& storage, const std::unordered_map<ImGuiID, int>& ref)
+{
+    if (storage.Data.Size != (int)ref.size())
+        return false;
+    for (const auto& it : ref)
+        if (storage.GetInt(it.first, -1) != it.second)
+            return false;
+    return true;
+}
+
+static void TestStorage()
+{
+    // Random Set/Get/GetRef over a mix of sequential keys (e.g. selection indices) and hashed IDs
+    ImGuiStorage storage;
+    std::unordered_map<ImGuiID, int> ref;
+    for (int n = 0; n < 200000; n++)
+    {
+        const ImGuiID key = (n & 1) ? RandomKey(50000) : ImHashData(&n, sizeof(n), 0) % 200000;
+        switch (n % 4)
+        {
+        case 0: storage.SetInt(key, n); ref[key] = n; break;
+        case 1: *storage.GetIntRef(key, 0) += 1; ref[key] += 1; break;
+        case 2: CHECK(storage.GetInt(key, -1) == (ref.count(key) ? ref[key] : -1)); break;
+        case 3: CHECK((storage.GetPair(key) != NULL) == (ref.count(key) != 0)); break;
+        }
+    }
+    CHECK(Matches(storage, ref));
+    CHECK(storage.GetInt(0xFFFFFFFF, 42) == 42);
+
+    ImGuiStorage misc;
+    misc.SetFloat(0xFFFFFFFF, 1.5f);
+    CHECK(misc.GetFloat(0xFFFFFFFF) == 1.5f);
+    CHECK(*misc.GetVoidPtrRef(0xFFFFFFFE, &misc) == &misc && misc.GetVoidPtr(0xFFFFFFFE) == &misc);
+    CHECK(misc.GetBoolRef(0, true) && *misc.GetBoolRef(0) && misc.Data.Size == 3);
+
+    // Batch rebuild: append directly then BuildSortByKey()
+    ImGuiStorage batch;
+    for (const auto& it : ref)
+        batch.Data.push_back(ImGuiStoragePair(it.first, it.second));
+    batch.BuildSortByKey();
+    CHECK(Matches(batch, ref));
+    for (int n = 1; n < batch.Data.Size; n++)
+        CHECK(batch.Data[n - 1].key < batch.Data[n].key);
+    batch.SetAllInt(7);
+    CHECK(batch.GetInt(batch.Data[0].key) == 7);
+    batch.Clear();
+    CHECK(batch.GetInt(storage.Data[0].key, -1) == -1);
+
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // Data[] reordered or shrunk directly, without BuildSortByKey(): lookups must not return another key's pair
+    std::sort(storage.Data.begin(), storage.Data.end(), [](const ImGuiStoragePair& a, const ImGuiStoragePair& b) { return a.val_i < b.val_i; });
+    CHECK(Matches(storage, ref));
+    const ImGuiID removed_key = storage.Data.back().key;
+    storage.Data.pop_back();
+    ref.erase(removed_key);
+    CHECK(storage.GetPair(removed_key) == NULL);
+    CHECK(Matches(storage, ref));
+#endif
+
+    // Selection with PreserveOrder sorts its storage by selection order while iterating
+    ImGuiSelectionBasicStorage selection;
+    selection.PreserveOrder = true;
+    for (int n = 0; n < 1000; n++)
+        selection.SetItemSelected((ImGuiID)(n * 7919 % 1000), true);
+    void* it = NULL;
+    ImGuiID id;
+    int count = 0;
+    while (selection.GetNextSelectedItem(&it, &id))
+    {
+#ifdef IMGUI_USE_HASHED_STORAGE
+        CHECK(selection.Contains(id) && selection.Contains((id + 1) % 1000) && !selection.Contains(1000 + id));
+#endif
+        CHECK(id == (ImGuiID)(count * 7919 % 1000));
+        count++;
+    }
+    CHECK(count == 1000 && selection.Size == 1000);
+}
+
+#ifdef IMGUI_USE_HASHED_STORAGE
+static const char* storage_name = "hashed";
+#else
+static const char* storage_name = "sorted";
+#endif
+
+// Insert 'count' new keys one at a time, e.g. tree nodes being opened or items being selected
+static void BenchmarkInsert(int count)
+{
+    std::vector<ImGuiID> keys(count);
+    for (int n = 0; n < count; n++)
+        keys[n] = ImHashData(&n, sizeof(n), 0);
+    ImGuiStorage storage;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < count; n++)
+        storage.SetInt(keys[n], n);
+    auto t1 = std::chrono::steady_clock::now();
+    CHECK(storage.Data.Size == count);
+    const double secs = std::chrono::duration<double>(t1 - t0).count();
+    printf("ImGuiStorage %s insert %8d keys: %8.2f ms total, %7.1f ns/insert\n", storage_name, count, secs * 1000.0, secs * 1e9 / count);
+}
+
+// Look up keys in a storage of 'count' keys, half of them missing, e.g. tree nodes queried every frame
+static void BenchmarkLookup(int count)
+{
+    std::vector<ImGuiID> keys(count);
+    ImGuiStorage storage;
+    for (int n = 0; n < count; n++)
+    {
+        keys[n] = ImHashData(&n, sizeof(n), 0);
+        storage.Data.push_back(ImGuiStoragePair(keys[n], 1));
+    }
+    storage.BuildSortByKey();
+
+    const int LOOKUPS_COUNT = 4000000;
+    int found = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n = 0; n < LOOKUPS_COUNT; n++)
+        found += storage.GetInt(keys[RandomKey((unsigned int)count)] ^ (n & 1), 0); // Odd lookups are (most likely) missing
+    auto t1 = std::chrono::steady_clock::now();
+    CHECK(found >= LOOKUPS_COUNT / 2);
+    const double secs = std::chrono::duration<double>(t1 - t0).count();
+    printf("ImGuiStorage %s lookup %8d keys: %8.2f ms total, %7.1f ns/lookup\n", storage_name, count, secs * 1000.0, secs * 1e9 / LOOKUPS_COUNT);
+}
+
+int main()
+{
+    TestStorage();
+    const int counts[] = { 1000, 10000, 100000, 1000000 };
+    for (int count : counts)
+    {
+#ifndef IMGUI_USE_HASHED_STORAGE
+        if (count > 100000) // Sorted insertion is O(N), so filling 1M keys one at a time takes minutes
+            continue;
+#endif
+        BenchmarkInsert(count);
+    }
+    for (int count : counts)
+        BenchmarkLookup(count);
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,223 @@
+// Test and benchmark for ImGuiTableSortCache: blocking, parallel (ParallelForFunc) and incremental (ItemsPerUpdate) sorting,
+// checked against std::stable_sort. Run with SANITIZE=thread to check the parallel path, SANITIZE=undefined for comparator overflows.
+
+#include "imgui.h"
+#include <limits.h>
+#include <stdio.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+#define CHECK(_EXPR)    do { if (!(_EXPR)) { printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); failures++; } } while (0)
+
+struct Item { int Group; int Value; int Id; };
+static std::vector<Item> items;
+
+// Column 0: Group (many ties), column 1: Value, returning INT_MIN/INT_MAX like some comparators do, column 2: Id (unique)
+static int CompareItems(const ImGuiTableColumnSortSpecs* spec, int item_a, int item_b, void*)
+{
+    const Item& a = items[item_a];
+    const Item& b = items[item_b];
+    switch (spec->ColumnIndex)
+    {
+    case 0: return a.Group - b.Group;
+    case 1: return (a.Value < b.Value) ? INT_MIN : (a.Value > b.Value) ? INT_MAX : 0;
+    case 2: return (a.Id > b.Id) - (a.Id < b.Id);
+    }
+    return 0;
+}
+
+static void GenerateItems(int count)
+{
+    unsigned int rng = 1234;
+    while ((int)items.size() < count)
+    {
+        rng = rng * 1664525u + 1013904223u;
+        items.push_back({ (int)(rng >> 24) % 16, (int)((rng >> 4) % 50000), (int)((long long)items.size() * 7919 % 2147483647) });
+    }
+}
+
+struct Specs
+{
+    ImGuiTableColumnSortSpecs   Columns[3];
+    ImGuiTableSortSpecs         SortSpecs;
+    void Set(int count, const int* columns, const ImGuiSortDirection* directions)
+    {
+        for (int n = 0; n < count; n++)
+        {
+            Columns[n].ColumnIndex = (ImS16)columns[n];
+            Columns[n].SortOrder = (ImS16)n;
+            Columns[n].SortDirection = directions[n];
+        }
+        SortSpecs.Specs = Columns;
+        SortSpecs.SpecsCount = count;
+        SortSpecs.SpecsDirty = true;
+    }
+};
+
+// Indices[] must be a permutation of [0..items_count) ordered by specs
+static bool IsSortedPermutation(const ImGuiTableSortCache& cache, const ImGuiTableSortSpecs& specs, int items_count)
+{
+    if (cache.Indices.Size != items_count)
+        return false;
+    std::vector<char> seen(items_count, 0);
+    for (int n = 0; n < items_count; n++)
+    {
+        const int item = cache.Indices[n];
+        if (item < 0 || item >= items_count || seen[item])
+            return false;
+        seen[item] = 1;
+    }
+    for (int n = 1; n < items_count; n++)
+        for (int spec_n = 0; spec_n < specs.SpecsCount; spec_n++)
+        {
+            int delta = CompareItems(&specs.Specs[spec_n], cache.Indices[n - 1], cache.Indices[n], NULL);
+            if (delta == 0)
+                continue;
+            if ((delta > 0) != (specs.Specs[spec_n].SortDirection == ImGuiSortDirection_Descending))
+                return false;
+            break;
+        }
+    return true;
+}
+
+// Reference: std::stable_sort of [0..items_count) with a unique last key, so the order is fully defined
+static std::vector<int> ReferenceSort(const ImGuiTableSortSpecs& specs, int items_count)
+{
+    std::vector<int> ref(items_count);
+    for (int n = 0; n < items_count; n++)
+        ref[n] = n;
+    std::stable_sort(ref.begin(), ref.end(), [&](int a, int b)
+    {
+        for (int spec_n = 0; spec_n < specs.SpecsCount; spec_n++)
+            if (int delta = CompareItems(&specs.Specs[spec_n], a, b, NULL))
+                return (delta > 0) == (specs.Specs[spec_n].SortDirection == ImGuiSortDirection_Descending);
+        return false;
+    });
+    return ref;
+}
+
+static bool Equals(const ImGuiTableSortCache& cache, const std::vector<int>& ref)
+{
+    return cache.Indices.Size == (int)ref.size() && std::equal(ref.begin(), ref.end(), cache.Indices.Data);
+}
+
+static void ThreadsParallelFor(void (*job_func)(void* job_data, int job_n), void* job_data, int job_count, void*)
+{
+    std::vector<std::thread> threads;
+    for (int job_n = 0; job_n < job_count; job_n++)
+        threads.emplace_back(job_func, job_data, job_n);
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// Update() until the sort is done, return number of calls
+static int UpdateUntilDone(ImGuiTableSortCache& cache, ImGuiTableSortSpecs& specs, int items_count)
+{
+    int calls = 0;
+    do
+    {
+        cache.Update(&specs, items_count, CompareItems, NULL);
+        calls++;
+        // Indices[] stays displayable while sorting
+        CHECK(cache.Indices.Size == items_count);
+    } while (cache.IsSorting());
+    return calls;
+}
+
+static void TestSortCache(const char* name, int items_per_job, int items_per_update, bool parallel)
+{
+    const int ITEMS_COUNT = 300000;
+    ImGuiTableSortCache cache;
+    cache.ItemsPerJob = items_per_job;
+    cache.ItemsPerUpdate = items_per_update;
+    cache.ParallelForFunc = parallel ? ThreadsParallelFor : NULL;
+    Specs specs;
+    const ImGuiSortDirection asc = ImGuiSortDirection_Ascending, desc = ImGuiSortDirection_Descending;
+
+    // Single column, with INT_MIN/INT_MAX comparator, then descending
+    const int cols_value[] = { 1, 2 };
+    const ImGuiSortDirection dirs_asc[] = { asc, asc };
+    specs.Set(2, cols_value, dirs_asc);
+    int calls = UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT);
+    CHECK(!specs.SortSpecs.SpecsDirty);
+    CHECK(Equals(cache, ReferenceSort(specs.SortSpecs, ITEMS_COUNT)));
+    CHECK(items_per_update > 0 ? calls > 1 : calls == 1);
+    const ImGuiSortDirection dirs_desc[] = { desc, asc };
+    specs.Set(2, cols_value, dirs_desc);
+    UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT);
+    CHECK(Equals(cache, ReferenceSort(specs.SortSpecs, ITEMS_COUNT)));
+
+    // New primary column, reusing previous ordering for ties: only column 0 is sorted
+    const int cols_group[] = { 0, 1, 2 };
+    const ImGuiSortDirection dirs_group[] = { asc, desc, asc };
+    specs.Set(3, cols_group, dirs_group);
+    UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT);
+    CHECK(Equals(cache, ReferenceSort(specs.SortSpecs, ITEMS_COUNT)));
+
+    // Append items, then append more while sorting (restarts)
+    const int sort_count = cache.SortCount;
+    CHECK(!cache.Update(&specs.SortSpecs, ITEMS_COUNT, CompareItems, NULL));
+    cache.Update(&specs.SortSpecs, ITEMS_COUNT + 20000, CompareItems, NULL);
+    UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT + 50000);
+    CHECK(cache.SortCount > sort_count);
+    CHECK(Equals(cache, ReferenceSort(specs.SortSpecs, ITEMS_COUNT + 50000)));
+
+    // Change specs while sorting
+    if (items_per_update > 0)
+    {
+        specs.Set(2, cols_value, dirs_asc);
+        cache.Update(&specs.SortSpecs, ITEMS_COUNT, CompareItems, NULL); // Also removes items
+        CHECK(cache.IsSorting());
+        specs.Set(1, cols_group, dirs_asc);
+        UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT);
+        CHECK(IsSortedPermutation(cache, specs.SortSpecs, ITEMS_COUNT));
+    }
+
+    // Remove items, sort without unique key
+    specs.Set(1, cols_group, dirs_asc);
+    UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT / 2);
+    CHECK(IsSortedPermutation(cache, specs.SortSpecs, ITEMS_COUNT / 2));
+
+    // No specs (tristate): back to index order
+    specs.Set(0, NULL, NULL);
+    UpdateUntilDone(cache, specs.SortSpecs, ITEMS_COUNT / 2);
+    CHECK(Equals(cache, ReferenceSort(specs.SortSpecs, ITEMS_COUNT / 2)));
+    printf("%-12s OK\n", name);
+}
+
+static void BenchmarkSort(const char* name, int items_count, int items_per_update)
+{
+    ImGuiTableSortCache cache;
+    cache.ItemsPerUpdate = items_per_update;
+    Specs specs;
+    const int cols[] = { 1, 2 };
+    const ImGuiSortDirection dirs[] = { ImGuiSortDirection_Ascending, ImGuiSortDirection_Ascending };
+    specs.Set(2, cols, dirs);
+    double max_update_ms = 0.0;
+    int calls = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    do
+    {
+        auto u0 = std::chrono::steady_clock::now();
+        cache.Update(&specs.SortSpecs, items_count, CompareItems, NULL);
+        max_update_ms = std::max(max_update_ms, std::chrono::duration<double>(std::chrono::steady_clock::now() - u0).count() * 1000.0);
+        calls++;
+    } while (cache.IsSorting());
+    const double total_ms = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() * 1000.0;
+    printf("%-12s %d items: %8.1f ms total, %4d Update() calls, longest %6.1f ms\n", name, items_count, total_ms, calls, max_update_ms);
+}
+
+int main()
+{
+    GenerateItems(2000000);
+    TestSortCache("blocking", 64 * 1024, 0, false);
+    TestSortCache("parallel", 1024, 0, true);
+    TestSortCache("incremental", 1024, 20000, false);
+    BenchmarkSort("blocking", 2000000, 0);
+    BenchmarkSort("incremental", 2000000, 64 * 1024);
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,127 @@
+// Test and benchmark for ImGuiTextDocument/InputTextMultilineLarge(): typing into a 50 MB document, headless.
+
+#include "imgui.h"
+#include "imgui_internal.h"
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <string>
+#include <type_traits>
+
+static int failures = 0;
+#define CHECK(_EXPR)    do { if (!(_EXPR)) { printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); failures++; } } while (0)
+
+static_assert(!std::is_copy_constructible<ImGuiTextDocument>::value && !std::is_copy_assignable<ImGuiTextDocument>::value, "ImGuiTextDocument must not be copyable");
+
+static std::string MakeText(int size)
+{
+    std::string text;
+    text.reserve(size);
+    for (int line_n = 0; (int)text.size() < size; line_n++)
+    {
+        char buf[128];
+        snprintf(buf, sizeof(buf), "%08d: the quick brown fox jumps over the lazy dog %u\n", line_n, (unsigned int)line_n * 7919u);
+        text += buf;
+    }
+    text.resize(size);
+    return text;
+}
+
+static std::string GetDocText(const ImGuiTextDocument& doc)
+{
+    ImVector<char> out;
+    doc.GetText(0, doc.GetTextLen(), &out);
+    return std::string(out.Data, out.Size);
+}
+
+// Edits through the API, checked against a std::string
+static void TestEdits()
+{
+    ImGuiTextDocument doc;
+    doc.ChunkSizeMax = 256;
+    std::string expected = MakeText(100000);
+    doc.SetText(expected.c_str(), expected.c_str() + expected.size());
+    unsigned int rng = 1;
+    for (int n = 0; n < 2000; n++)
+    {
+        rng = rng * 1664525u + 1013904223u;
+        const int offset = (int)((rng >> 8) % (expected.size() + 1));
+        if (n & 1)
+        {
+            const int len = ImMin((int)(rng % 700), (int)expected.size() - offset);
+            doc.Delete(offset, len);
+            expected.erase(offset, len);
+        }
+        else
+        {
+            const std::string text = MakeText((int)(rng % 900));
+            doc.Insert(offset, text.c_str(), text.c_str() + text.size());
+            expected.insert(offset, text);
+        }
+    }
+    CHECK(GetDocText(doc) == expected);
+    int line_breaks = 0;
+    for (char c : expected)
+        line_breaks += (c == '\n');
+    CHECK(doc.GetLineCount() == line_breaks + 1);
+    const int line_n = doc.GetLineCount() / 2;
+    const int line_start = doc.GetLineStart(line_n);
+    CHECK(doc.GetLineFromOffset(line_start) == line_n && expected[line_start - 1] == '\n');
+}
+
+// Type 'frames_count' characters in the middle of a document of 'doc_size' bytes, one character and one frame at a time
+static double BenchmarkTyping(int doc_size, int frames_count)
+{
+    ImGuiContext* ctx = ImGui::CreateContext();
+    ImGuiIO& io = ImGui::GetIO();
+    io.IniFilename = NULL;
+    io.DisplaySize = ImVec2(1280, 800);
+    io.DeltaTime = 1.0f / 60.0f;
+    unsigned char* pixels; int w, h;
+    io.Fonts->GetTexDataAsRGBA32(&pixels, &w, &h);
+
+    ImGuiTextDocument doc;
+    const std::string text = MakeText(doc_size);
+    auto t0 = std::chrono::steady_clock::now();
+    doc.SetText(text.c_str(), text.c_str() + text.size());
+    auto t1 = std::chrono::steady_clock::now();
+    doc.Cursor = doc.SelectStart = doc.GetLineStart(doc.GetLineCount() / 2);
+    doc.CursorFollow = true;
+
+    double frames_secs = 0.0;
+    for (int frame_n = 0; frame_n < frames_count + 3; frame_n++)
+    {
+        if (frame_n >= 3) // Frame 0: submit, frame 1: request activation, frame 2: activated
+            io.AddInputCharacter((frame_n % 40 == 0) ? '\n' : 'a' + frame_n % 26);
+        auto f0 = std::chrono::steady_clock::now();
+        ImGui::NewFrame();
+        ImGui::SetNextWindowPos(ImVec2(0, 0));
+        ImGui::SetNextWindowSize(io.DisplaySize);
+        ImGui::Begin("Editor", NULL, ImGuiWindowFlags_NoDecoration);
+        if (frame_n == 1)
+            ImGui::ActivateItemByID(ImGui::GetID("##doc"));
+        ImGui::InputTextMultilineLarge("##doc", &doc, ImVec2(-1, -1));
+        ImGui::End();
+        ImGui::Render();
+        auto f1 = std::chrono::steady_clock::now();
+        if (frame_n >= 3)
+            frames_secs += std::chrono::duration<double>(f1 - f0).count();
+    }
+    CHECK(doc.GetTextLen() == doc_size + frames_count);
+
+    const double frame_ms = frames_secs * 1000.0 / frames_count;
+    printf("Typing into %9.1f KB document (%d lines): SetText() %7.2f ms, %.3f ms/frame with 1 char typed per frame\n",
+        doc_size / 1024.0, doc.GetLineCount(), std::chrono::duration<double>(t1 - t0).count() * 1000.0, frame_ms);
+    ImGui::DestroyContext(ctx);
+    return frame_ms;
+}
+
+int main()
+{
+    TestEdits();
+    const double frame_ms_small = BenchmarkTyping(4 * 1024, 600);
+    const double frame_ms_large = BenchmarkTyping(50 * 1024 * 1024, 600);
+    CHECK(frame_ms_large < frame_ms_small * 10.0 + 1.0); // Frame cost doesn't depend on document size
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}
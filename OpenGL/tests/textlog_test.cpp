@@ -0,0 +1,170 @@
+// Test for ImGuiTextLog: chunked storage, filtering, and queue (QueueAppend/QueueAppendf/DrainQueue).
+// Build and run with 'make -C tests textlog_test' from the OpenGL/ folder.
+
+#include "imgui.h"
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+static int failures = 0;
+#define CHECK(_EXPR)    do { if (!(_EXPR)) { printf("%s(%d): check failed: %s\n", __FILE__, __LINE__, #_EXPR); failures++; } } while (0)
+
+static std::string GetLogText(const ImGuiTextLog& log)
+{
+    std::string text;
+    for (int line_n = 0; line_n < log.GetLineCount(); line_n++)
+    {
+        text.append(log.GetLineBegin(line_n), log.GetLineEnd(line_n));
+        if (line_n + 1 < log.GetLineCount() || log._IsLastLineComplete())
+            text += '\n';
+    }
+    return text;
+}
+
+static unsigned int rng_state = 12345;
+static int Rand(int n) { rng_state = rng_state * 1664525u + 1013904223u; return (int)((rng_state >> 8) % (unsigned int)n); }
+
+// Random appends crossing chunk boundaries: pieces with and without '\n', incomplete lines continued by later appends, lines larger than a chunk.
+static void TestChunks()
+{
+    ImGuiTextLog log;
+    std::string expected;
+    std::vector<const char*> line_ptrs;
+    for (int step = 0; step < 4000; step++)
+    {
+        std::string piece;
+        const int kind = Rand(100);
+        const int len = (kind < 2) ? IMGUI_TEXTLOG_CHUNK_SIZE + Rand(IMGUI_TEXTLOG_CHUNK_SIZE * 2) : (kind < 10) ? Rand(8000) : Rand(120);
+        for (int n = 0; n < len; n++)
+            piece += (Rand(40) == 0) ? '\n' : (char)('a' + Rand(26));
+        if (Rand(3) != 0)
+            piece += '\n';
+        if (Rand(2))
+            log.Append(piece.c_str(), piece.c_str() + piece.size());
+        else
+            log.Appendf("%s", piece.c_str());
+        expected += piece;
+
+        // Complete lines never move
+        const int lines_complete = log._IsLastLineComplete() ? log.GetLineCount() : log.GetLineCount() - 1;
+        for (int line_n = 0; line_n < (int)line_ptrs.size() && line_n < lines_complete; line_n++)
+            if (line_ptrs[line_n] != log.GetLineBegin(line_n))
+            {
+                CHECK(line_ptrs[line_n] == log.GetLineBegin(line_n));
+                break;
+            }
+        for (int line_n = (int)line_ptrs.size(); line_n < lines_complete; line_n++)
+            line_ptrs.push_back(log.GetLineBegin(line_n));
+    }
+    CHECK(GetLogText(log) == expected);
+    CHECK(log.Chunks.Size > 10);
+
+    // Filtering through chunks, single term (searching whole chunks) and multiple terms (line by line), against a line by line reference
+    const char* filters[] = { "abc", "zz", "q,xyz", "abc,-abcd", "ab" };
+    for (const char* filter : filters)
+    {
+        snprintf(log.Filter.InputBuf, IM_ARRAYSIZE(log.Filter.InputBuf), "%s", filter);
+        log.Filter.Build();
+        log.Update();
+        ImVector<int> reference;
+        for (int line_n = 0; line_n < log.GetLineCount(); line_n++)
+            if (log.Filter.PassFilter(log.GetLineBegin(line_n), log.GetLineEnd(line_n)))
+                reference.push_back(line_n);
+        CHECK(reference.Size > 0 && reference.Size == log.FilteredLines.Size && memcmp(reference.Data, log.FilteredLines.Data, reference.size_in_bytes()) == 0);
+    }
+
+    log.Clear();
+    CHECK(log.GetLineCount() == 0 && GetLogText(log).empty());
+    log.Append("after clear\n");
+    CHECK(GetLogText(log) == "after clear\n");
+}
+
+// Every text length modulo 8, through both append functions, with records wrapping around a small ring.
+static void TestAllLengths()
+{
+    ImGuiTextLog log;
+    log.InitQueue(256);
+    std::string expected;
+    for (int pass = 0; pass < 8; pass++)
+        for (int len = 0; len < 40; len++)
+        {
+            std::string text(len, (char)('a' + (len % 26)));
+            text += '\n';
+            if (pass & 1)
+                CHECK(log.QueueAppendf("%s", text.c_str()));
+            else
+                CHECK(log.QueueAppend(text.c_str()));
+            expected += text;
+            CHECK(log.DrainQueue() == 1);
+        }
+    CHECK(log.GetQueueDroppedCount() == 0);
+    CHECK(expected == GetLogText(log));
+}
+
+// Fill the ring without draining, then check everything accepted comes out, and the ring is usable again.
+static void TestFullQueue()
+{
+    ImGuiTextLog log;
+    log.InitQueue(256);
+    int accepted = 0;
+    for (int n = 0; n < 100; n++)
+        accepted += log.QueueAppendf("%s\n", "abc") ? 1 : 0;
+    CHECK(accepted > 0 && accepted < 100);
+    CHECK(log.GetQueueDroppedCount() == 100 - accepted);
+    CHECK(log.DrainQueue() == accepted);
+    for (int n = 0; n < 100; n++)
+    {
+        CHECK(log.QueueAppendf("%s\n", "abc"));
+        CHECK(log.DrainQueue() == 1);
+    }
+    CHECK(log.GetQueueDroppedCount() == 100 - accepted);
+}
+
+// Several producers while the owner drains: no record lost or torn.
+static void TestThreads()
+{
+    const int THREADS_COUNT = 4;
+    const int RECORDS_PER_THREAD = 20000;
+    ImGuiTextLog log;
+    log.InitQueue(64 * 1024);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS_COUNT; t++)
+        threads.emplace_back([&log, t]()
+        {
+            for (int n = 0; n < RECORDS_PER_THREAD; n++)
+                while (!log.QueueAppendf("thread %d record %d %.*s\n", t, n, n % 13, "xxxxxxxxxxxxx"))
+                    std::this_thread::yield();
+        });
+    int records_count = 0;
+    while (records_count < THREADS_COUNT * RECORDS_PER_THREAD)
+        records_count += log.DrainQueue();
+    for (std::thread& thread : threads)
+        thread.join();
+    CHECK(log.DrainQueue() == 0);
+
+    int next_record[THREADS_COUNT] = {};
+    for (int line_n = 0; line_n < log.GetLineCount(); line_n++)
+    {
+        int t = -1, n = -1;
+        std::string line(log.GetLineBegin(line_n), log.GetLineEnd(line_n)); // Lines are not zero-terminated
+        CHECK(sscanf(line.c_str(), "thread %d record %d", &t, &n) == 2 && t >= 0 && t < THREADS_COUNT);
+        if (t >= 0 && t < THREADS_COUNT)
+            CHECK(n == next_record[t]++);
+    }
+    for (int t = 0; t < THREADS_COUNT; t++)
+        CHECK(next_record[t] == RECORDS_PER_THREAD);
+}
+
+int main()
+{
+    ImGui::CreateContext();
+    TestChunks();
+    TestAllLengths();
+    TestFullQueue();
+    TestThreads();
+    ImGui::DestroyContext();
+    printf("%s\n", failures ? "FAILED" : "OK");
+    return failures ? 1 : 0;
+}